@@ -0,0 +1,37 @@
+#pragma once
+
+/**
+ * @file BenchmarkReport.hpp
+ * @brief CSV reports of benchmark results and their comparison against a checked-in baseline.
+ */
+
+#include "RenderGraphWorkloads.hpp"
+
+#include <iosfwd>
+#include <span>
+
+namespace Mixture::Benchmarks
+{
+    /** @brief Writes a header row and one row per result. */
+    void WriteCsv(std::ostream& stream, std::span<const BenchmarkResult> results);
+
+    /**
+     * @brief Reads a report written by WriteCsv. Lines starting with '#' are comments.
+     * @throws std::runtime_error If the header or a row is malformed.
+     */
+    Vector<BenchmarkResult> ReadCsv(std::istream& stream);
+
+    /** @brief Prints the results as an aligned table. */
+    void PrintTable(std::ostream& stream, std::span<const BenchmarkResult> results);
+
+    /**
+     * @brief Compares results against a baseline and describes every regression.
+     *
+     * Timings regress when they exceed the baseline by more than @p tolerance (a fraction)
+     * and by more than a microsecond. Executed passes must match the baseline exactly, and
+     * allocations and the cache hit rate must not get worse, as all three are deterministic.
+     * Rows missing from the baseline are skipped.
+     */
+    Vector<std::string> FindRegressions(std::span<const BenchmarkResult> baseline,
+        std::span<const BenchmarkResult> results, double tolerance);
+}
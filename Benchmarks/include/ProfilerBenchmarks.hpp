@@ -0,0 +1,31 @@
+#pragma once
+
+/**
+ * @file ProfilerBenchmarks.hpp
+ * @brief Cost of an empty MX_PROFILE_SCOPE with and without a running capture.
+ */
+
+#include <cstddef>
+#include <iosfwd>
+
+namespace Mixture::Benchmarks
+{
+    /** @brief Median cost of one empty profiled scope, in nanoseconds. */
+    struct ProfileScopeOverhead
+    {
+        /** @brief No capture running: the scope only checks whether one is. */
+        double IdleNanoseconds = 0.0;
+        /** @brief A capture running: the scope reads the clock twice and records an event. */
+        double CapturingNanoseconds = 0.0;
+    };
+
+    /**
+     * @brief Times @p iterations empty scopes per sample, first idle and then inside a capture.
+     *
+     * Starts and ends its own capture, so it must not run while another capture is active.
+     */
+    ProfileScopeOverhead MeasureProfileScopeOverhead(size_t iterations = 1 << 20);
+
+    /** @brief Prints both figures as one line. */
+    void PrintProfileScopeOverhead(std::ostream& stream, const ProfileScopeOverhead& overhead);
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+/**
+ * @file RenderGraphWorkloads.hpp
+ * @brief Deterministic synthetic render graphs and the benchmark that replays them.
+ */
+
+#include "Mixture/Core/Base.hpp"
+#include "Mixture/Render/Graph/RenderGraph.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace Mixture::Benchmarks
+{
+    /** @brief One pass of a synthetic workload, referring to resources by index. */
+    struct WorkloadPass
+    {
+        Vector<uint32_t> Reads;
+        Vector<uint32_t> Writes;
+        bool SideEffect = false;
+    };
+
+    /**
+     * @brief A render graph topology generated once and declared every benchmark frame.
+     *
+     * Resource 0 is the imported output every workload ends in; all other resources are
+     * transient textures. Names are built up front so declaring the graph measures the
+     * graph rather than string formatting.
+     */
+    struct Workload
+    {
+        std::string Name;
+        Vector<std::string> PassNames;
+        Vector<std::string> ResourceNames;
+        Vector<WorkloadPass> Passes;
+        /** @brief Frames between resolution changes in the compile cache run; 0 keeps the resolution fixed. */
+        size_t ResizeInterval = 0;
+        /** @brief Chance, in percent, that a cache run frame flips the side effect flag of one pass. */
+        uint32_t SideEffectTogglePercent = 0;
+        /** @brief Seed choosing the frames and passes whose side effect flag flips. */
+        uint32_t ChurnSeed = 0;
+    };
+
+    /** @brief A chain of passes that each read the previous pass's output. */
+    Workload MakeChainWorkload(size_t passCount);
+
+    /**
+     * @brief One producer read by passCount - 2 independent branches, joined by a final composite.
+     *
+     * Resized every FanOutResizeInterval frames of the cache run, like a window being dragged now and then.
+     */
+    Workload MakeFanOutWorkload(size_t passCount);
+
+    /**
+     * @brief Chained deferred views (shadow, depth, G-buffer, SSAO, lighting, bloom, tonemap),
+     *        each G-buffer reading the previous view's result, followed by post-process passes.
+     *
+     * Resized every DeferredResizeInterval frames of the cache run, like dynamic resolution stepping.
+     */
+    Workload MakeDeferredWorkload(size_t passCount);
+
+    /**
+     * @brief Passes with random reads of earlier results and random new or overwritten targets.
+     *
+     * Uses the raw std::mt19937 sequence, which the standard fixes, so the topology is the same
+     * on every platform for a given seed. Passes whose results nobody reads are culled. In the
+     * cache run a quarter of the frames flip the side effect flag of one pass, churning the topology.
+     */
+    Workload MakeRandomWorkload(size_t passCount, uint32_t seed);
+
+    /** @brief Median timings and counters of one workload, one row of the CSV report. */
+    struct BenchmarkResult
+    {
+        std::string Workload;
+        size_t PassCount = 0;
+        /** @brief Passes that survived culling and were executed. */
+        size_t ExecutedPasses = 0;
+        double ClearMicroseconds = 0.0;
+        /** @brief Importing, creating and declaring every resource and pass. */
+        double AddPassMicroseconds = 0.0;
+        /** @brief Compile with the compiled graph invalidated: culling, sorting, lifetimes and barriers. */
+        double CompileMissMicroseconds = 0.0;
+        /** @brief Compile replaying the cached schedule. */
+        double CompileHitMicroseconds = 0.0;
+        /** @brief Execute against the mock device and a command list that records nothing. */
+        double ExecuteMicroseconds = 0.0;
+        /**
+         * @brief Global allocations of a whole Clear/AddPass/Compile/Execute frame once the cache is warm.
+         * Includes the allocations Execute makes for every recorded pass (barrier batch and attachment list).
+         */
+        double AllocationsPerFrame = 0.0;
+        /** @brief Compile cache hit rate over CacheBenchmarkFrames frames of the workload's resize and churn schedule. */
+        double CacheHitRate = 0.0;
+    };
+
+    struct BenchmarkOptions
+    {
+        /** @brief Seed of the random read/write workloads. */
+        uint32_t Seed = 1337;
+        /** @brief Only workloads whose name contains this text run. */
+        std::string Filter;
+        /** @brief Frame budget per measurement; larger graphs use proportionally fewer frames. */
+        size_t PassFrameBudget = 64000;
+    };
+
+    /** @brief Frames between resolution changes of the fan-out workload's cache run. */
+    inline constexpr size_t FanOutResizeInterval = 16;
+
+    /** @brief Frames between resolution changes of the deferred workload's cache run. */
+    inline constexpr size_t DeferredResizeInterval = 4;
+
+    /** @brief Frames over which the compile cache hit rate is measured. */
+    inline constexpr size_t CacheBenchmarkFrames = 64;
+
+    /** @brief Runs chain, fan-out, deferred and random workloads with 10, 100 and 1000 passes. */
+    Vector<BenchmarkResult> RunRenderGraphBenchmarks(const BenchmarkOptions& options);
+}
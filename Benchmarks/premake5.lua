@@ -0,0 +1,37 @@
+project "Benchmarks"
+    kind "ConsoleApp"
+    common_language_spec()
+    common_target()
+    common_directories()
+
+    -- Shares the mock RHI and the allocation counter with the test binary.
+    files { "../Tests/include/RenderGraphMocks.hpp", "../Tests/src/AllocationCounter.cpp" }
+    includedirs { "../Tests/include" }
+
+    externalincludedirs {
+        application_externalincludedirs()
+    }
+
+    links {
+        application_links()
+    }
+
+    filter "configurations:Debug"
+        application_debug_settings()
+
+    filter "configurations:Release"
+        application_release_settings()
+
+    filter "configurations:Dist"
+        application_dist_settings()
+
+    filter "system:windows"
+        windows_settings()
+
+    filter "system:linux"
+        linux_settings()
+
+    filter "action:xcode4"
+        xcode_settings()
+
+    filter {}
@@ -0,0 +1,110 @@
+#include "BenchmarkReport.hpp"
+#include "ProfilerBenchmarks.hpp"
+#include "RenderGraphWorkloads.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+namespace
+{
+    constexpr std::string_view DefaultBaseline = "Benchmarks/baselines/RenderGraph.csv";
+
+    void PrintUsage()
+    {
+        std::cout << "Usage: Benchmarks [options]\n"
+            << "  --baseline <csv>     Compare against this report (default " << DefaultBaseline << ")\n"
+            << "  --output <csv>       Write the results; pass the baseline path to update it\n"
+            << "  --tolerance <frac>   Allowed timing slowdown before a regression (default 0.5)\n"
+            << "  --filter <text>      Only run workloads whose name contains text (Profiler for the scope overhead)\n"
+            << "  --seed <n>           Seed of the random workloads (default 1337)\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace Mixture::Benchmarks;
+
+    BenchmarkOptions options;
+    std::filesystem::path baselinePath = DefaultBaseline;
+    std::filesystem::path outputPath;
+    double tolerance = 0.5;
+
+    try
+    {
+        for (int index = 1; index < argc; ++index)
+        {
+            const std::string_view argument = argv[index];
+            const bool hasValue = index + 1 < argc;
+            if (argument == "--help" || argument == "-h")
+            {
+                PrintUsage();
+                return 0;
+            }
+            else if (argument == "--baseline" && hasValue) baselinePath = argv[++index];
+            else if (argument == "--output" && hasValue) outputPath = argv[++index];
+            else if (argument == "--tolerance" && hasValue) tolerance = std::stod(argv[++index]);
+            else if (argument == "--filter" && hasValue) options.Filter = argv[++index];
+            else if (argument == "--seed" && hasValue) options.Seed = static_cast<uint32_t>(std::stoul(argv[++index]));
+            else
+            {
+                std::cerr << "Unknown or incomplete argument " << argument << "\n";
+                PrintUsage();
+                return 2;
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+        std::cerr << "Invalid numeric argument\n";
+        return 2;
+    }
+
+    const auto results = RunRenderGraphBenchmarks(options);
+    PrintTable(std::cout, results);
+
+    // Reported only: the overhead depends on the machine's clock, so it has no baseline.
+    if (std::string_view("Profiler").find(options.Filter) != std::string_view::npos)
+    {
+        PrintProfileScopeOverhead(std::cout, MeasureProfileScopeOverhead());
+    }
+
+    if (!outputPath.empty())
+    {
+        std::ofstream stream(outputPath, std::ios::trunc);
+        WriteCsv(stream, results);
+        if (!stream)
+        {
+            std::cerr << "Failed to write " << outputPath.string() << "\n";
+            return 2;
+        }
+        std::cout << "Wrote " << outputPath.string() << "\n";
+        // Updating the baseline compares it with itself; there is nothing left to check.
+        std::error_code error;
+        if (std::filesystem::equivalent(outputPath, baselinePath, error)) return 0;
+    }
+
+    std::ifstream baselineStream(baselinePath);
+    if (!baselineStream)
+    {
+        std::cout << "No baseline at " << baselinePath.string() << ", skipping the regression check\n";
+        return 0;
+    }
+
+    try
+    {
+        const auto baseline = ReadCsv(baselineStream);
+        const auto regressions = FindRegressions(baseline, results, tolerance);
+        for (const auto& regression : regressions) std::cout << "[ REGRESSED ] " << regression << "\n";
+        if (!regressions.empty()) return 1;
+
+        std::cout << "No regressions against " << baselinePath.string() << "\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << "\n";
+        return 2;
+    }
+}
@@ -0,0 +1,172 @@
+#include "BenchmarkReport.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace Mixture::Benchmarks
+{
+    namespace
+    {
+        constexpr std::string_view Header =
+            "Workload,Passes,ExecutedPasses,ClearUs,AddPassUs,CompileMissUs,CompileHitUs,ExecuteUs,AllocationsPerFrame,CacheHitRate";
+
+        /** Timings below this many microseconds are dominated by clock noise and never regress. */
+        constexpr double TimingNoiseFloor = 1.0;
+
+        Vector<std::string> SplitColumns(const std::string& line)
+        {
+            Vector<std::string> columns;
+            std::stringstream stream(line);
+            std::string column;
+            while (std::getline(stream, column, ',')) columns.push_back(column);
+            return columns;
+        }
+
+        double ParseNumber(const std::string& text, size_t lineNumber)
+        {
+            try
+            {
+                size_t consumed = 0;
+                const double value = std::stod(text, &consumed);
+                if (consumed == text.size()) return value;
+            }
+            catch (const std::exception&) {}
+            throw std::runtime_error("Benchmark report line " + std::to_string(lineNumber) + ": '" + text + "' is not a number");
+        }
+
+        const BenchmarkResult* FindRow(std::span<const BenchmarkResult> rows, const BenchmarkResult& row)
+        {
+            const auto it = std::find_if(rows.begin(), rows.end(), [&](const BenchmarkResult& candidate)
+            {
+                return candidate.Workload == row.Workload && candidate.PassCount == row.PassCount;
+            });
+            return it != rows.end() ? &*it : nullptr;
+        }
+    }
+
+    void WriteCsv(std::ostream& stream, std::span<const BenchmarkResult> results)
+    {
+        stream << "# Median timings in microseconds. Regenerate the baseline with Benchmarks --output <csv>.\n";
+        stream << "# AllocationsPerFrame covers a whole frame, including the per-pass allocations Execute makes while recording.\n";
+        stream << Header << '\n' << std::fixed;
+        for (const auto& result : results)
+        {
+            stream << result.Workload << ',' << result.PassCount << ',' << result.ExecutedPasses << std::setprecision(3)
+                << ',' << result.ClearMicroseconds << ',' << result.AddPassMicroseconds
+                << ',' << result.CompileMissMicroseconds << ',' << result.CompileHitMicroseconds
+                << ',' << result.ExecuteMicroseconds << std::setprecision(2) << ',' << result.AllocationsPerFrame
+                << std::setprecision(4) << ',' << result.CacheHitRate << '\n';
+        }
+    }
+
+    Vector<BenchmarkResult> ReadCsv(std::istream& stream)
+    {
+        Vector<BenchmarkResult> results;
+        bool sawHeader = false;
+        std::string line;
+        size_t lineNumber = 0;
+        while (std::getline(stream, line))
+        {
+            ++lineNumber;
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (line.empty() || line.front() == '#') continue;
+
+            if (!sawHeader)
+            {
+                if (line != Header) throw std::runtime_error("Benchmark report line " + std::to_string(lineNumber) + ": unexpected header");
+                sawHeader = true;
+                continue;
+            }
+
+            const auto columns = SplitColumns(line);
+            if (columns.size() != 10)
+            {
+                throw std::runtime_error("Benchmark report line " + std::to_string(lineNumber) + ": expected 10 columns, found "
+                    + std::to_string(columns.size()));
+            }
+
+            BenchmarkResult& result = results.emplace_back();
+            result.Workload = columns[0];
+            result.PassCount = static_cast<size_t>(ParseNumber(columns[1], lineNumber));
+            result.ExecutedPasses = static_cast<size_t>(ParseNumber(columns[2], lineNumber));
+            result.ClearMicroseconds = ParseNumber(columns[3], lineNumber);
+            result.AddPassMicroseconds = ParseNumber(columns[4], lineNumber);
+            result.CompileMissMicroseconds = ParseNumber(columns[5], lineNumber);
+            result.CompileHitMicroseconds = ParseNumber(columns[6], lineNumber);
+            result.ExecuteMicroseconds = ParseNumber(columns[7], lineNumber);
+            result.AllocationsPerFrame = ParseNumber(columns[8], lineNumber);
+            result.CacheHitRate = ParseNumber(columns[9], lineNumber);
+        }
+
+        if (!sawHeader) throw std::runtime_error("Benchmark report is empty");
+        return results;
+    }
+
+    void PrintTable(std::ostream& stream, std::span<const BenchmarkResult> results)
+    {
+        stream << std::left << std::setw(10) << "Workload" << std::right << std::setw(7) << "Passes"
+            << std::setw(10) << "Executed" << std::setw(11) << "Clear us" << std::setw(12) << "AddPass us"
+            << std::setw(13) << "Compile us" << std::setw(12) << "Cached us" << std::setw(12) << "Execute us"
+            << std::setw(10) << "Allocs" << std::setw(10) << "Hit rate" << '\n' << std::fixed << std::setprecision(2);
+        for (const auto& result : results)
+        {
+            stream << std::left << std::setw(10) << result.Workload << std::right << std::setw(7) << result.PassCount
+                << std::setw(10) << result.ExecutedPasses << std::setw(11) << result.ClearMicroseconds
+                << std::setw(12) << result.AddPassMicroseconds << std::setw(13) << result.CompileMissMicroseconds
+                << std::setw(12) << result.CompileHitMicroseconds << std::setw(12) << result.ExecuteMicroseconds
+                << std::setw(10) << result.AllocationsPerFrame << std::setw(10) << result.CacheHitRate << '\n';
+        }
+    }
+
+    Vector<std::string> FindRegressions(std::span<const BenchmarkResult> baseline,
+        std::span<const BenchmarkResult> results, double tolerance)
+    {
+        Vector<std::string> regressions;
+        for (const auto& result : results)
+        {
+            const BenchmarkResult* expected = FindRow(baseline, result);
+            if (!expected) continue;
+
+            const std::string row = result.Workload + "/" + std::to_string(result.PassCount);
+            const auto report = [&](std::string_view metric, double baselineValue, double value, std::string_view unit, int precision = 2)
+            {
+                std::ostringstream message;
+                message << std::fixed << std::setprecision(precision) << row << ' ' << metric << ": " << value << unit
+                    << ", baseline " << baselineValue << unit;
+                regressions.push_back(message.str());
+            };
+            const auto checkTiming = [&](std::string_view metric, double baselineValue, double value)
+            {
+                if (value > baselineValue * (1.0 + tolerance) && value - baselineValue > TimingNoiseFloor)
+                {
+                    report(metric, baselineValue, value, " us");
+                }
+            };
+
+            checkTiming("Clear", expected->ClearMicroseconds, result.ClearMicroseconds);
+            checkTiming("AddPass", expected->AddPassMicroseconds, result.AddPassMicroseconds);
+            checkTiming("Compile", expected->CompileMissMicroseconds, result.CompileMissMicroseconds);
+            checkTiming("CachedCompile", expected->CompileHitMicroseconds, result.CompileHitMicroseconds);
+            checkTiming("Execute", expected->ExecuteMicroseconds, result.ExecuteMicroseconds);
+
+            // Culling decides the executed pass count, so any change is a behavior change.
+            if (result.ExecutedPasses != expected->ExecutedPasses)
+            {
+                report("executed passes", static_cast<double>(expected->ExecutedPasses), static_cast<double>(result.ExecutedPasses), "", 0);
+            }
+            if (result.AllocationsPerFrame > expected->AllocationsPerFrame + 0.005)
+            {
+                report("allocations per frame", expected->AllocationsPerFrame, result.AllocationsPerFrame, "");
+            }
+            if (result.CacheHitRate < expected->CacheHitRate - 0.00005)
+            {
+                report("compile cache hit rate", expected->CacheHitRate, result.CacheHitRate, "", 4);
+            }
+        }
+        return regressions;
+    }
+}
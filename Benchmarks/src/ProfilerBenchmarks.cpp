@@ -0,0 +1,55 @@
+#include "ProfilerBenchmarks.hpp"
+
+#include "Mixture/Core/Base.hpp"
+#include "Mixture/Core/Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+
+namespace Mixture::Benchmarks
+{
+    namespace
+    {
+        constexpr size_t SampleCount = 9;
+
+        double TimeEmptyScopes(size_t iterations)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t index = 0; index < iterations; ++index)
+            {
+                MX_PROFILE_SCOPE("EmptyScope");
+            }
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count()
+                / static_cast<double>(iterations);
+        }
+
+        double MedianOfSamples(size_t iterations)
+        {
+            Vector<double> samples;
+            for (size_t sample = 0; sample < SampleCount; ++sample) samples.push_back(TimeEmptyScopes(iterations));
+            const auto middle = samples.begin() + static_cast<std::ptrdiff_t>(samples.size() / 2);
+            std::nth_element(samples.begin(), middle, samples.end());
+            return *middle;
+        }
+    }
+
+    ProfileScopeOverhead MeasureProfileScopeOverhead(size_t iterations)
+    {
+        ProfileScopeOverhead overhead;
+        overhead.IdleNanoseconds = MedianOfSamples(iterations);
+
+        // Keeps the events in memory only; the ring simply wraps once it is full.
+        Profiler::BeginCapture();
+        overhead.CapturingNanoseconds = MedianOfSamples(iterations);
+        Profiler::EndCapture();
+        return overhead;
+    }
+
+    void PrintProfileScopeOverhead(std::ostream& stream, const ProfileScopeOverhead& overhead)
+    {
+        stream << std::fixed << std::setprecision(2) << "Empty MX_PROFILE_SCOPE: " << overhead.IdleNanoseconds
+            << " ns idle, " << overhead.CapturingNanoseconds << " ns capturing\n";
+    }
+}
@@ -0,0 +1,429 @@
+#include "RenderGraphWorkloads.hpp"
+
+#include "Mixture/Render/RHI/ICommandList.hpp"
+
+#include "AllocationCounter.hpp"
+#include "RenderGraphMocks.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <random>
+
+namespace Mixture::Benchmarks
+{
+    namespace
+    {
+        /** Accepts every command and records nothing, so Execute measures the graph alone. */
+        class NullCommandList final : public RHI::ICommandList
+        {
+        public:
+            void Begin() override {}
+            void End() override {}
+            void BeginRendering(const RHI::RenderingInfo&) override {}
+            void EndRendering() override {}
+            void ExecuteSecondary(std::span<RHI::ICommandList* const>) override {}
+            void SetViewport(float, float, float, float, float, float) override {}
+            void SetScissor(int32_t, int32_t, uint32_t, uint32_t) override {}
+            void BindPipeline(RHI::IPipeline*) override {}
+            void BindVertexBuffer(RHI::IBuffer*, uint32_t, uint64_t) override {}
+            void BindIndexBuffer(RHI::IBuffer*, uint64_t) override {}
+            void PipelineBarrier(RHI::ITexture*, RHI::ResourceState, RHI::ResourceState, RHI::QueueType, RHI::QueueType,
+                const RHI::TextureSubresourceRange&) override {}
+            void PipelineBarrier(RHI::IBuffer*, RHI::ResourceState, RHI::ResourceState, RHI::QueueType, RHI::QueueType,
+                const RHI::BufferRange&) override {}
+            void PushConstants(RHI::IPipeline*, RHI::ShaderStage, const void*, uint32_t) override {}
+            void SetUniformBuffer(uint32_t, RHI::IBuffer*, uint32_t, const RHI::BufferRange&) override {}
+            void SetTexture(uint32_t, RHI::ITexture*, uint32_t) override {}
+            void Draw(uint32_t, uint32_t, uint32_t, uint32_t) override {}
+            void DrawIndexed(uint32_t, uint32_t, uint32_t, int32_t, uint32_t) override {}
+        };
+
+        using Clock = std::chrono::steady_clock;
+
+        double Microseconds(Clock::duration duration)
+        {
+            return std::chrono::duration<double, std::micro>(duration).count();
+        }
+
+        double Median(Vector<double>& samples)
+        {
+            if (samples.empty()) return 0.0;
+            const auto middle = samples.begin() + static_cast<std::ptrdiff_t>(samples.size() / 2);
+            std::nth_element(samples.begin(), middle, samples.end());
+            return *middle;
+        }
+
+        uint32_t AddResource(Workload& workload, std::string name)
+        {
+            workload.ResourceNames.push_back(std::move(name));
+            return static_cast<uint32_t>(workload.ResourceNames.size() - 1);
+        }
+
+        WorkloadPass& AddPass(Workload& workload, std::string name)
+        {
+            workload.PassNames.push_back(std::move(name));
+            return workload.Passes.emplace_back();
+        }
+
+        Workload BeginWorkload(std::string name, size_t passCount)
+        {
+            Workload workload;
+            workload.Name = std::move(name);
+            workload.PassNames.reserve(passCount);
+            workload.Passes.reserve(passCount);
+            AddResource(workload, "Output");
+            return workload;
+        }
+
+        struct PassData
+        {
+            size_t* Executed = nullptr;
+        };
+
+        /** Per-frame state of a declared workload, reused so steady-state frames do not allocate. */
+        struct DeclarationState
+        {
+            Vector<RGResourceHandle> Handles;
+            size_t Executed = 0;
+        };
+
+        /** Declares the workload; the pass at @p toggledPass, if any, has its side effect flag flipped. */
+        void Declare(RenderGraph& graph, const Workload& workload, RHI::ITexture& output,
+            uint32_t width, DeclarationState& state, size_t toggledPass = SIZE_MAX)
+        {
+            RHI::TextureDesc desc;
+            desc.Width = width;
+            desc.Height = width;
+
+            state.Handles.resize(workload.ResourceNames.size());
+            state.Handles[0] = graph.ImportResource(workload.ResourceNames[0], &output);
+            for (size_t index = 1; index < workload.ResourceNames.size(); ++index)
+            {
+                state.Handles[index] = graph.CreateResource(workload.ResourceNames[index], desc);
+            }
+
+            for (size_t passIndex = 0; passIndex < workload.Passes.size(); ++passIndex)
+            {
+                const WorkloadPass& pass = workload.Passes[passIndex];
+                const bool sideEffect = pass.SideEffect != (passIndex == toggledPass);
+                graph.AddPass<PassData>(workload.PassNames[passIndex],
+                    [&](RenderGraphBuilder& builder, PassData& data)
+                    {
+                        for (const uint32_t read : pass.Reads) builder.Read(state.Handles[read]);
+                        for (const uint32_t write : pass.Writes) builder.Write(state.Handles[write]);
+                        if (sideEffect) builder.SetSideEffect();
+                        data.Executed = &state.Executed;
+                    },
+                    [](const RenderGraphRegistry&, const PassData& data, RHI::ICommandList*) { ++*data.Executed; });
+            }
+        }
+
+        BenchmarkResult Measure(const Workload& workload, size_t frames)
+        {
+            constexpr uint32_t width = 256;
+            constexpr uint32_t alternateWidth = 192;
+            constexpr size_t warmupFrames = 4;
+
+            Tests::MockGraphicsDevice device;
+            device.SupportsAliasing = true;
+            Tests::HeadlessGraphicsContext context;
+            NullCommandList commandList;
+            RHI::TextureDesc outputDesc;
+            outputDesc.Width = width;
+            outputDesc.Height = width;
+            Tests::MockTexture output(outputDesc);
+
+            RenderGraph graph(device);
+            DeclarationState state;
+
+            // The first frames intern names, grow the node arrays and fill the resource pools.
+            for (size_t frame = 0; frame < warmupFrames; ++frame)
+            {
+                graph.Clear();
+                Declare(graph, workload, output, width, state);
+                graph.Compile();
+                graph.Execute(&commandList, &context);
+            }
+
+            BenchmarkResult result;
+            result.Workload = workload.Name;
+            result.PassCount = workload.Passes.size();
+
+            Vector<double> clear, addPass, compileMiss, compileHit, execute;
+            for (size_t frame = 0; frame < frames; ++frame)
+            {
+                const auto start = Clock::now();
+                graph.Clear();
+                const auto cleared = Clock::now();
+                Declare(graph, workload, output, width, state);
+                const auto declared = Clock::now();
+                graph.InvalidateCompiledGraph();
+                graph.Compile();
+                const auto compiled = Clock::now();
+                state.Executed = 0;
+                graph.Execute(&commandList, &context);
+                const auto executed = Clock::now();
+
+                clear.push_back(Microseconds(cleared - start));
+                addPass.push_back(Microseconds(declared - cleared));
+                compileMiss.push_back(Microseconds(compiled - declared));
+                execute.push_back(Microseconds(executed - compiled));
+            }
+            result.ExecutedPasses = state.Executed;
+
+            for (size_t frame = 0; frame < frames; ++frame)
+            {
+                graph.Clear();
+                Declare(graph, workload, output, width, state);
+                const auto start = Clock::now();
+                graph.Compile();
+                compileHit.push_back(Microseconds(Clock::now() - start));
+            }
+
+            result.ClearMicroseconds = Median(clear);
+            result.AddPassMicroseconds = Median(addPass);
+            result.CompileMissMicroseconds = Median(compileMiss);
+            result.CompileHitMicroseconds = Median(compileHit);
+            result.ExecuteMicroseconds = Median(execute);
+
+            // Steady state: whole frames as the renderer runs them.
+            const uint64_t allocationsBefore = Tests::GetAllocationCount();
+            for (size_t frame = 0; frame < frames; ++frame)
+            {
+                graph.Clear();
+                Declare(graph, workload, output, width, state);
+                graph.Compile();
+                graph.Execute(&commandList, &context);
+            }
+            result.AllocationsPerFrame = static_cast<double>(Tests::GetAllocationCount() - allocationsBefore) / static_cast<double>(frames);
+
+            // A fixed number of frames following the workload's own schedule, so the hit rate is deterministic.
+            std::mt19937 churn(workload.ChurnSeed);
+            bool resized = false;
+            const auto before = graph.GetCompileStatistics();
+            for (size_t frame = 0; frame < CacheBenchmarkFrames; ++frame)
+            {
+                if (workload.ResizeInterval > 0 && frame % workload.ResizeInterval == workload.ResizeInterval - 1) resized = !resized;
+
+                // The last pass writes the output and is never toggled.
+                size_t toggledPass = SIZE_MAX;
+                if (workload.Passes.size() > 1 && churn() % 100 < workload.SideEffectTogglePercent)
+                {
+                    toggledPass = static_cast<size_t>(churn() % (workload.Passes.size() - 1));
+                }
+
+                graph.Clear();
+                Declare(graph, workload, output, resized ? alternateWidth : width, state, toggledPass);
+                graph.Compile();
+                graph.Execute(&commandList, &context);
+            }
+            const auto& after = graph.GetCompileStatistics();
+
+            const uint64_t hits = after.CacheHits - before.CacheHits;
+            const uint64_t misses = after.CacheMisses - before.CacheMisses;
+            result.CacheHitRate = hits + misses > 0 ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0;
+            return result;
+        }
+    }
+
+    Workload MakeChainWorkload(size_t passCount)
+    {
+        Workload workload = BeginWorkload("Chain", passCount);
+
+        uint32_t previous = 0;
+        for (size_t index = 0; index < passCount; ++index)
+        {
+            const bool isLast = index + 1 == passCount;
+            const uint32_t target = isLast ? 0 : AddResource(workload, "Chain_" + std::to_string(index));
+
+            WorkloadPass& pass = AddPass(workload, "Chain_" + std::to_string(index));
+            if (index > 0) pass.Reads.push_back(previous);
+            pass.Writes.push_back(target);
+            previous = target;
+        }
+        return workload;
+    }
+
+    Workload MakeFanOutWorkload(size_t passCount)
+    {
+        if (passCount < 3)
+        {
+            Workload chain = MakeChainWorkload(passCount);
+            chain.Name = "FanOut";
+            chain.ResizeInterval = FanOutResizeInterval;
+            return chain;
+        }
+
+        Workload workload = BeginWorkload("FanOut", passCount);
+        workload.ResizeInterval = FanOutResizeInterval;
+
+        const uint32_t source = AddResource(workload, "Source");
+        AddPass(workload, "Source").Writes.push_back(source);
+
+        Vector<uint32_t> branches;
+        for (size_t index = 0; index + 2 < passCount; ++index)
+        {
+            const uint32_t target = AddResource(workload, "Branch_" + std::to_string(index));
+            WorkloadPass& pass = AddPass(workload, "Branch_" + std::to_string(index));
+            pass.Reads.push_back(source);
+            pass.Writes.push_back(target);
+            branches.push_back(target);
+        }
+
+        WorkloadPass& composite = AddPass(workload, "Composite");
+        composite.Reads = std::move(branches);
+        composite.Writes.push_back(0);
+        return workload;
+    }
+
+    Workload MakeDeferredWorkload(size_t passCount)
+    {
+        constexpr size_t passesPerView = 7;
+        Workload workload = BeginWorkload("Deferred", passCount);
+        workload.ResizeInterval = DeferredResizeInterval;
+
+        const size_t viewCount = passCount > 0 ? (passCount - 1) / passesPerView : 0;
+        uint32_t previous = 0;
+        for (size_t view = 0; view < viewCount; ++view)
+        {
+            const std::string suffix = "_" + std::to_string(view);
+            const uint32_t shadow = AddResource(workload, "ShadowMap" + suffix);
+            const uint32_t depth = AddResource(workload, "Depth" + suffix);
+            const uint32_t albedo = AddResource(workload, "Albedo" + suffix);
+            const uint32_t normal = AddResource(workload, "Normal" + suffix);
+            const uint32_t occlusion = AddResource(workload, "AO" + suffix);
+            const uint32_t hdr = AddResource(workload, "HDR" + suffix);
+            const uint32_t bloom = AddResource(workload, "Bloom" + suffix);
+            const uint32_t ldr = AddResource(workload, "LDR" + suffix);
+
+            AddPass(workload, "Shadow" + suffix).Writes = { shadow };
+            AddPass(workload, "DepthPrepass" + suffix).Writes = { depth };
+
+            WorkloadPass& gbuffer = AddPass(workload, "GBuffer" + suffix);
+            gbuffer.Reads = { depth };
+            if (view > 0) gbuffer.Reads.push_back(previous);
+            gbuffer.Writes = { albedo, normal };
+
+            WorkloadPass& ssao = AddPass(workload, "SSAO" + suffix);
+            ssao.Reads = { depth, normal };
+            ssao.Writes = { occlusion };
+
+            WorkloadPass& lighting = AddPass(workload, "Lighting" + suffix);
+            lighting.Reads = { shadow, depth, albedo, normal, occlusion };
+            lighting.Writes = { hdr };
+
+            WorkloadPass& bloomPass = AddPass(workload, "Bloom" + suffix);
+            bloomPass.Reads = { hdr };
+            bloomPass.Writes = { bloom };
+
+            WorkloadPass& tonemap = AddPass(workload, "Tonemap" + suffix);
+            tonemap.Reads = { hdr, bloom };
+            tonemap.Writes = { ldr };
+            previous = ldr;
+        }
+
+        // Post-process passes fill the remainder, then the last pass writes the output.
+        while (workload.Passes.size() + 1 < passCount)
+        {
+            const std::string name = "Post_" + std::to_string(workload.Passes.size());
+            const uint32_t target = AddResource(workload, name);
+            WorkloadPass& post = AddPass(workload, name);
+            if (previous != 0) post.Reads = { previous };
+            post.Writes = { target };
+            previous = target;
+        }
+
+        if (passCount > 0)
+        {
+            WorkloadPass& present = AddPass(workload, "Present");
+            if (previous != 0) present.Reads = { previous };
+            present.Writes = { 0 };
+        }
+        return workload;
+    }
+
+    Workload MakeRandomWorkload(size_t passCount, uint32_t seed)
+    {
+        Workload workload = BeginWorkload("Random", passCount);
+        workload.SideEffectTogglePercent = 25;
+        workload.ChurnSeed = seed;
+        std::mt19937 random(seed);
+        const auto below = [&](size_t bound) { return static_cast<size_t>(random() % bound); };
+
+        Vector<uint32_t> written;
+        const auto pickWritten = [&](Vector<uint32_t>& picked, size_t count)
+        {
+            for (size_t attempt = 0; attempt < count && !written.empty(); ++attempt)
+            {
+                const uint32_t candidate = written[below(written.size())];
+                if (std::find(picked.begin(), picked.end(), candidate) == picked.end()) picked.push_back(candidate);
+            }
+        };
+
+        for (size_t index = 0; index + 1 < passCount; ++index)
+        {
+            WorkloadPass& pass = AddPass(workload, "Random_" + std::to_string(index));
+            pickWritten(pass.Reads, below(4));
+
+            const size_t writeCount = 1 + below(2);
+            for (size_t write = 0; write < writeCount; ++write)
+            {
+                // A quarter of the writes overwrite an earlier result the pass does not read.
+                if (!written.empty() && below(4) == 0)
+                {
+                    const uint32_t candidate = written[below(written.size())];
+                    const bool conflicts = std::find(pass.Reads.begin(), pass.Reads.end(), candidate) != pass.Reads.end()
+                        || std::find(pass.Writes.begin(), pass.Writes.end(), candidate) != pass.Writes.end();
+                    if (!conflicts)
+                    {
+                        pass.Writes.push_back(candidate);
+                        continue;
+                    }
+                }
+
+                const uint32_t target = AddResource(workload, "Random_" + std::to_string(index) + "_" + std::to_string(write));
+                pass.Writes.push_back(target);
+                written.push_back(target);
+            }
+            pass.SideEffect = below(16) == 0;
+        }
+
+        if (passCount > 0)
+        {
+            WorkloadPass& resolve = AddPass(workload, "Resolve");
+            pickWritten(resolve.Reads, 4);
+            resolve.Writes.push_back(0);
+        }
+        return workload;
+    }
+
+    Vector<BenchmarkResult> RunRenderGraphBenchmarks(const BenchmarkOptions& options)
+    {
+        constexpr std::array<size_t, 3> passCounts = { 10, 100, 1000 };
+
+        Vector<BenchmarkResult> results;
+        for (const size_t passCount : passCounts)
+        {
+            const std::array<Workload, 4> workloads = {
+                MakeChainWorkload(passCount),
+                MakeFanOutWorkload(passCount),
+                MakeDeferredWorkload(passCount),
+                MakeRandomWorkload(passCount, options.Seed)
+            };
+
+            const size_t frames = std::clamp<size_t>(options.PassFrameBudget / passCount, 16, 512);
+            for (const Workload& workload : workloads)
+            {
+                if (!options.Filter.empty() && workload.Name.find(options.Filter) == std::string::npos) continue;
+                results.push_back(Measure(workload, frames));
+            }
+        }
+
+        std::sort(results.begin(), results.end(), [](const BenchmarkResult& lhs, const BenchmarkResult& rhs)
+        {
+            return lhs.Workload != rhs.Workload ? lhs.Workload < rhs.Workload : lhs.PassCount < rhs.PassCount;
+        });
+        return results;
+    }
+}
@@ -40,5 +40,6 @@ namespace Mixture
         uint32_t m_CameraBufferCursor = 0;
         glm::mat4 m_LastCameraViewProjection{ 1.0f };
         bool m_HasCameraData = false;
+        DynamicResolution m_DynamicResolution;
     };
 }
@@ -2,6 +2,7 @@
 
 #include "Panels/IEditorPanel.hpp"
 #include <array>
+#include <string>
 
 namespace Mixture
 {
@@ -21,5 +22,8 @@ namespace Mixture
         std::array<float, 60> m_FrameTimeHistory{};
         size_t m_HistoryIndex = 0;
         float m_TimeAccumulator = 0.0f;
+
+        std::string m_TracePath = "MixtureTrace.json";
+        int m_TraceFrameCount = 120;
     };
 }
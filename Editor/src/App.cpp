@@ -13,7 +13,8 @@ namespace Mixture
             : Application(appDescription)
         {
             PushLayer<MainLayer>();
-            if (appDescription.EnableImGui) PushOverlay<UILayer>();
+            // --headless is applied by Application, so ask for the effective ImGui state.
+            if (!IsHeadless() && GetImGuiContext()) PushOverlay<UILayer>();
         }
     };
 
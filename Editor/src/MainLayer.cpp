@@ -152,28 +152,38 @@ namespace Mixture
         {
             RGResourceHandle Output;
             RHI::IPipeline* Pipeline;
+            float AspectRatio;
         };
 
-        // Create transient Depth Buffer resource for 3D scene rendering
-        int width, height;
-        Application::Get().GetWindow().GetFramebufferSize(&width, &height);
+        // The scene renders at the scale that keeps the GPU within its frame budget and is
+        // upscaled into the backbuffer. Scaled targets are allocated at the full extent, so
+        // changing the scale neither reallocates them nor recompiles the graph.
+        m_DynamicResolution.Update(graph.GetGpuFrameTimeMs());
 
+        const RGResourceHandle backbuffer = graph.GetResource("Backbuffer"_rg);
+        // Copied: creating the scene targets below can grow the graph's resource storage.
+        const RHI::TextureDesc backbufferDesc = graph.GetTextureDesc(backbuffer);
+        graph.SetViewport({ backbufferDesc.Width, backbufferDesc.Height, m_DynamicResolution.GetScale() });
+
+        RHI::TextureDesc colorDesc;
+        colorDesc.PixelFormat = backbufferDesc.PixelFormat;
+        colorDesc.Usage = RHI::TextureUsage::ColorAttachment | RHI::TextureUsage::Sampled;
+        colorDesc.DebugName = "SceneColorBuffer";
+
+        RGResourceHandle colorResource = graph.CreateScaledResource("SceneColor", colorDesc);
 
         RHI::TextureDesc depthDesc;
-        depthDesc.Width = width;
-        depthDesc.Height = height;
         depthDesc.PixelFormat = RHI::Format::D32_FLOAT;
         depthDesc.Usage = RHI::TextureUsage::DepthStencilAttachment;
         depthDesc.DebugName = "SceneDepthBuffer";
 
-        RGResourceHandle depthResource = graph.CreateResource("SceneDepth", depthDesc);
+        RGResourceHandle depthResource = graph.CreateScaledResource("SceneDepth", depthDesc);
 
         graph.AddPass<ScenePassData>("GBufferPass",
             [&](RenderGraphBuilder& builder, ScenePassData& data)
             {
-                RGResourceHandle backbuffer = graph.GetResource("Backbuffer");
                 RGAttachmentInfo colorInfo;
-                colorInfo.Handle = backbuffer;
+                colorInfo.Handle = colorResource;
                 colorInfo.LoadOp = RHI::LoadOp::Clear;
                 colorInfo.ClearColor[0] = 0.05f;
                 colorInfo.ClearColor[1] = 0.05f;
@@ -189,6 +199,10 @@ namespace Mixture
                 data.Output = builder.Write(colorInfo);
                 builder.Write(depthInfo);
 
+                // Taken from the backbuffer rather than the window, which headless runs do not have.
+                data.AspectRatio = (backbufferDesc.Height > 0)
+                    ? (static_cast<float>(backbufferDesc.Width) / static_cast<float>(backbufferDesc.Height)) : 1.778f;
+
                 RHI::PipelineDesc desc;
                 desc.VertexShader = builder.LoadShader("Default.slang", RHI::ShaderStage::Vertex);
                 desc.FragmentShader = builder.LoadShader("Default.slang", RHI::ShaderStage::Fragment);
@@ -211,8 +225,7 @@ namespace Mixture
 
                 if (m_Scene)
                 {
-                    const auto& window = Application::Get().GetWindow();
-                    float aspect = (window.GetHeight() > 0) ? (static_cast<float>(window.GetWidth()) / static_cast<float>(window.GetHeight())) : 1.778f;
+                    const float aspect = data.AspectRatio;
 
                     // Compute ViewProjection matrix from active camera in scene
                     glm::mat4 viewMatrix(1.0f);
@@ -309,5 +322,7 @@ namespace Mixture
                 }
             }
         );
+
+        graph.AddPass<UpscalePass>("UpscalePass", colorResource, backbuffer);
     }
 }
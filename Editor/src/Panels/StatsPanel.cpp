@@ -2,6 +2,8 @@
 
 #include <imgui.h>
 
+#include <algorithm>
+
 namespace Mixture
 {
     StatsPanel::StatsPanel()
@@ -44,12 +46,64 @@ namespace Mixture
             ImGui::Text("Triangles: %u", stats.TriangleCount);
             ImGui::Text("Vertices: %u", stats.VertexCount);
             ImGui::Text("Render Passes: %u", stats.RenderPassCount);
+            ImGui::Text("Barriers: %u in %u batches", stats.BarrierCount, stats.BarrierBatchCount);
         }
 
         if (ImGui::CollapsingHeader("Memory", ImGuiTreeNodeFlags_DefaultOpen))
         {
             ImGui::Text("VRAM Usage: %.1f MB", stats.VRAMUsageMB);
             ImGui::Text("System RAM: %.1f MB", stats.SystemRAMUsageMB);
+            ImGui::Text("Transient Heaps: %.1f MB (%.1f MB saved by aliasing)",
+                static_cast<float>(stats.TransientMemoryBytes) / (1024.0f * 1024.0f),
+                static_cast<float>(stats.AliasingSavedBytes) / (1024.0f * 1024.0f));
+            ImGui::Text("Transient Pool: %.1f MB (%u hits, %u misses, %u evicted)",
+                static_cast<float>(stats.TransientPoolBytes) / (1024.0f * 1024.0f),
+                stats.TransientPoolHits, stats.TransientPoolMisses, stats.TransientPoolEvictions);
+        }
+
+        if (ImGui::CollapsingHeader("Render Graph Passes", ImGuiTreeNodeFlags_DefaultOpen))
+        {
+            if (stats.GpuFrameTimeMs >= 0.0f) ImGui::Text("GPU Frame Time: %.3f ms", stats.GpuFrameTimeMs);
+            else ImGui::TextDisabled("GPU timestamps unavailable.");
+
+            const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+            if (!stats.PassTimings.empty() && ImGui::BeginTable("##PassTimings", 3, flags))
+            {
+                ImGui::TableSetupColumn("Pass");
+                ImGui::TableSetupColumn("CPU (ms)");
+                ImGui::TableSetupColumn("GPU (ms)");
+                ImGui::TableHeadersRow();
+
+                for (const auto& timing : stats.PassTimings)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(timing.Name.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", timing.CpuTimeMs);
+                    ImGui::TableNextColumn();
+                    if (timing.GpuTimeMs >= 0.0f) ImGui::Text("%.3f", timing.GpuTimeMs);
+                    else ImGui::TextDisabled("-");
+                }
+                ImGui::EndTable();
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Trace Capture"))
+        {
+            if (Profiler::IsCapturing())
+            {
+                ImGui::Text("Capturing to %s...", m_TracePath.c_str());
+                if (ImGui::Button("Stop Capture")) Profiler::EndCapture();
+            }
+            else
+            {
+                ImGui::InputInt("Frames", &m_TraceFrameCount);
+                m_TraceFrameCount = std::max(m_TraceFrameCount, 1);
+                if (ImGui::Button("Capture Trace"))
+                    Profiler::BeginCapture(m_TracePath, static_cast<uint32_t>(m_TraceFrameCount));
+                ImGui::TextDisabled("Open %s in chrome://tracing or ui.perfetto.dev.", m_TracePath.c_str());
+            }
         }
 #endif
 
@@ -141,11 +141,11 @@ namespace Mixture
     {
         if (m_CurrentViewportTarget.IsValid())
         {
-            graph.AddPass<ImGuiPass>("ImGuiPass", Application::Get().GetImGuiContext(), graph.GetResource("SwapchainBackbuffer"), m_CurrentViewportTarget);
+            graph.AddPass<ImGuiPass>("ImGuiPass", Application::Get().GetImGuiContext(), graph.GetResource("SwapchainBackbuffer"_rg), m_CurrentViewportTarget);
         }
         else
         {
-            graph.AddPass<ImGuiPass>("ImGuiPass", Application::Get().GetImGuiContext(), graph.GetResource("SwapchainBackbuffer"));
+            graph.AddPass<ImGuiPass>("ImGuiPass", Application::Get().GetImGuiContext(), graph.GetResource("SwapchainBackbuffer"_rg));
         }
     }
 
@@ -13,11 +13,14 @@
 #include "Mixture/Render/ImGui/Theme.hpp"
 #include "Mixture/Render/ImGui/ThemeManager.hpp"
 #include "Mixture/Render/RenderStats.hpp"
+#include "Mixture/Render/DynamicResolution.hpp"
+#include "Mixture/Render/UpscalePass.hpp"
 
 #include "Mixture/Core/Base.hpp"
 #include "Mixture/Core/Application.hpp"
 #include "Mixture/Core/Layer.hpp"
 #include "Mixture/Core/LayerStack.hpp"
+#include "Mixture/Core/Profiler.hpp"
 
 #include "Mixture/Scene/Components.hpp"
 #include "Mixture/Scene/Entity.hpp"
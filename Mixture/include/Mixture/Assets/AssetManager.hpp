@@ -14,11 +14,12 @@
 
 #include "Mixture/Render/RHI/IGraphicsContext.hpp"
 #include "Mixture/Util/FileSystemWatcher.hpp"
+#include "Mixture/Util/MappedFile.hpp"
 
 #include <array>
+#include <deque>
 #include <mutex>
 #include <thread>
-#include <queue>
 #include <condition_variable>
 #include <unordered_set>
 #include <optional>
@@ -26,11 +27,30 @@
 
 namespace Mixture
 {
+    /**
+     * @brief Order in which queued asset reads are served.
+     *
+     * Higher priorities are read first; requests of equal priority keep their submission order.
+     */
+    enum class AssetLoadPriority : uint8_t
+    {
+        /** @brief Speculative loads of assets that may be needed soon. */
+        Prefetch = 0,
+        Normal,
+        /** @brief Assets needed by what is on screen now. */
+        VisibleNow,
+        Count
+    };
+
     /**
      * @brief Manages the lifecycle and loading of assets.
      * 
      * Handles loading assets from disk, caching them, and providing access via handles.
-     * Uses a dedicated I/O thread to prevent blocking the main TaskSystem.
+     * A dedicated I/O thread reads files in priority order and hands the bytes to TaskSystem
+     * workers for decoding or shader compilation, so a slow compile never stalls the reads
+     * queued behind it. Without a running TaskSystem the I/O thread decodes itself.
+     * Pre-cooked assets reference the file data instead of copying it into the cache; with hot
+     * reload disabled that data is a memory mapping of the file.
      */
     class AssetManager
     {
@@ -60,12 +80,31 @@ namespace Mixture
         /** @brief Returns whether the manager currently owns a running I/O service. */
         bool IsInitialized() const { return m_Initialized.load(); }
 
-        /** @brief Blocks until all queued and active asset reads have completed. */
+        /** @brief Blocks until all queued asset reads and their decoding have completed. */
         void WaitForIdle();
 
-        /** @brief Cancels a queued or active asset load. */
+        /** @brief Cancels a queued, reading or decoding asset load. */
         bool CancelLoad(UUID id);
 
+        /**
+         * @brief Moves a queued load to the back of the queue of @p priority, e.g. to demote
+         * assets that left the screen to prefetches.
+         *
+         * @return Whether the load was still waiting to be read.
+         */
+        bool SetLoadPriority(UUID id, AssetLoadPriority priority);
+
+        /**
+         * @brief Enables watching the asset root for changes and reloading modified assets.
+         *
+         * Enabled by default. While enabled, files are read into memory, because tools rewrite
+         * watched files in place. Disabling it suits cooked content that does not change at
+         * runtime: files are then memory-mapped and pre-cooked assets reference the mapping.
+         * Applies to loads started after the call.
+         */
+        void SetHotReloadEnabled(bool enabled);
+        bool IsHotReloadEnabled() const { return m_HotReloadEnabled.load(); }
+
         /**
          * @brief Sets the root directory for asset lookups.
          * 
@@ -121,9 +160,11 @@ namespace Mixture
          * 
          * @param type The type of asset to load.
          * @param path The path to the asset file, relative to the asset root.
+         * @param priority Priority of the load. Requesting a queued asset again raises its priority if higher.
          * @return AssetHandle The handle to the asset.
          */
-        AssetHandle GetAsset(AssetType type, const std::filesystem::path& path);
+        AssetHandle GetAsset(AssetType type, const std::filesystem::path& path,
+            AssetLoadPriority priority = AssetLoadPriority::Normal);
 
         /**
          * @brief Retrieves the raw asset pointer from a handle.
@@ -168,9 +209,26 @@ namespace Mixture
 
         void OnAssetChange(const std::filesystem::path& path, FileAction action);
         bool EnqueueLoad(LoadRequest request);
+        /** @brief Moves a queued load to @p priority, or only to a higher one if @p raiseOnly. Expects m_QueueMutex. */
+        bool MoveQueuedLoad(UUID id, AssetLoadPriority priority, bool raiseOnly);
         bool IsLoadCancelled(UUID id);
         std::optional<std::filesystem::path> ResolveFullPath(AssetType type, const std::filesystem::path& relativePath) const;
-        void LoadAssetInternal(AssetType type, const std::filesystem::path& path, UUID id, uint32_t magic);
+        /** @brief Contents of an asset file and the owner that keeps them valid. */
+        struct FileContents
+        {
+            std::span<const std::byte> Data;
+            Ref<const void> Storage;
+        };
+
+        void RestartFileWatcher();
+        /** @brief Reads the file of a request on the I/O thread and dispatches it for decoding. */
+        void ReadAsset(const LoadRequest& request);
+        /** @brief Maps the file, or reads it into memory while hot reload is enabled. */
+        bool ReadFileContents(UUID id, const std::filesystem::path& fullPath, FileContents& contents);
+        /** @brief Runs the serializer and publishes the asset unless the load was cancelled. */
+        void DecodeAsset(const LoadRequest& request, const FileContents& contents);
+        /** @brief Ends an in-flight load, successful or not. */
+        void FinishLoad(UUID id);
         Ref<IAsset> GetAssetFromCache(UUID id);
 
     private:
@@ -180,8 +238,12 @@ namespace Mixture
             std::filesystem::path Path;
             UUID ID;
             uint32_t Magic;
+            AssetLoadPriority Priority = AssetLoadPriority::Normal;
         };
 
+        /** @brief Loads mapped ahead of decoding, bounding the file data held in memory. */
+        static constexpr size_t MaxInFlightLoads = 16;
+
         std::filesystem::path m_RootDirectory;
         Ref<IAssetFileResolver> m_AssetFileResolver;
         RHI::GraphicsAPI m_GraphicsAPI = RHI::GraphicsAPI::None;
@@ -201,10 +263,11 @@ namespace Mixture
         std::mutex m_QueueMutex;
         std::condition_variable m_QueueCV;
         std::condition_variable m_IdleCV;
-        std::queue<LoadRequest> m_LoadQueue;
+        /** @brief FIFO queue of pending reads per AssetLoadPriority. */
+        std::array<std::deque<LoadRequest>, static_cast<size_t>(AssetLoadPriority::Count)> m_LoadQueues;
         std::unordered_set<UUID> m_CancelledLoads;
-        UUID m_ActiveLoadID = UUID::Invalid();
-        bool m_ActiveLoadCancellable = false;
+        /** @brief Loads being read or decoded, mapped to whether they can still be cancelled. */
+        std::unordered_map<UUID, bool> m_InFlightLoads;
         std::atomic<bool> m_Running = false;
 
         std::mutex m_CallbackMutex;
@@ -212,5 +275,6 @@ namespace Mixture
         ReloadCallbackHandle m_NextReloadCallbackHandle = 1;
 
         Scope<FileSystemWatcher> m_FileWatcher;
+        std::atomic<bool> m_HotReloadEnabled = true;
     };
 }
@@ -3,6 +3,9 @@
 #include "Mixture/Core/Base.hpp"
 #include "Mixture/Assets/IAsset.hpp"
 
+#include <cstddef>
+#include <span>
+
 namespace Mixture
 {
     /**
@@ -15,13 +18,17 @@ namespace Mixture
         virtual ~AssetSerializer() = default;
 
         /**
-         * @brief Loads an asset from a memory buffer.
+         * @brief Loads an asset from the contents of its file.
+         *
+         * Formats that are already in their runtime layout should reference @p data and keep
+         * @p storage alive instead of copying the bytes.
          *
-         * @param data The raw file data.
+         * @param data The raw file data, a read-only memory mapping or a buffer read from the file.
+         * @param storage Owner of @p data; the bytes stay valid while a reference to it is held.
          * @param metadata Metadata about the asset being loaded.
          * @return Ref<IAsset> The loaded asset.
          */
-        virtual Ref<IAsset> Load(const Vector<char>& data, const AssetMetadata& metadata) = 0;
+        virtual Ref<IAsset> Load(std::span<const std::byte> data, const Ref<const void>& storage, const AssetMetadata& metadata) = 0;
 
         /**
          * @brief Saves an asset to disk. (Optional/Future Implementation)
@@ -9,6 +9,8 @@
 
 #include "Mixture/Assets/IAsset.hpp"
 
+#include <span>
+
 namespace Mixture
 {
     /**
@@ -25,7 +27,21 @@ namespace Mixture
          * @param byteCode The compiled shader bytecode (SPIR-V, DXIL, etc.).
          */
         ShaderAsset(UUID id, const std::string& name, std::vector<uint8_t> byteCode)
-            : m_ID(id), m_Name(name), m_ByteCode(std::move(byteCode))
+            : m_ID(id), m_Name(name)
+        {
+            auto owned = CreateRef<std::vector<uint8_t>>(std::move(byteCode));
+            m_ByteCode = *owned;
+            m_Storage = std::move(owned);
+        }
+
+        /**
+         * @brief Constructs a ShaderAsset that references bytecode owned elsewhere.
+         * 
+         * @param byteCode The compiled bytecode, e.g. inside a mapped file.
+         * @param storage Keeps @p byteCode valid for the lifetime of the asset.
+         */
+        ShaderAsset(UUID id, const std::string& name, std::span<const uint8_t> byteCode, Ref<const void> storage)
+            : m_ID(id), m_Name(name), m_ByteCode(byteCode), m_Storage(std::move(storage))
         {}
 
         virtual ~ShaderAsset() = default;
@@ -62,6 +78,7 @@ namespace Mixture
     private:
         UUID m_ID;
         std::string m_Name;
-        std::vector<uint8_t> m_ByteCode;
+        std::span<const uint8_t> m_ByteCode;
+        Ref<const void> m_Storage;
     };
 }
@@ -20,12 +20,15 @@ namespace Mixture
         virtual ~ShaderSerializer() = default;
 
         /**
-         * @brief Loads a shader asset from binary data (SPIR-V).
+         * @brief Loads a shader asset from binary data (SPIR-V), or compiles it from Slang source.
+         * 
+         * Pre-compiled bytecode references @p data without a copy.
          * 
          * @param data The raw file data.
+         * @param storage Owner of @p data, retained by pre-compiled shaders.
          * @param metadata The asset metadata.
          * @return Ref<IAsset> The loaded shader asset.
          */
-        Ref<IAsset> Load(const Vector<char>& data, const AssetMetadata& metadata) override;
+        Ref<IAsset> Load(std::span<const std::byte> data, const Ref<const void>& storage, const AssetMetadata& metadata) override;
     };
 }
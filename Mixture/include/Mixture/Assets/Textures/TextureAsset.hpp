@@ -9,6 +9,8 @@
 #include "Mixture/Assets/IAsset.hpp"
 #include "Mixture/Render/RHI/RenderFormats.hpp"
 
+#include <span>
+
 namespace Mixture
 {
     /**
@@ -28,7 +30,22 @@ namespace Mixture
          * @param data Raw pixel data.
          */
         TextureAsset(UUID id, const std::string& name, uint32_t width, uint32_t height, RHI::Format format, Vector<uint8_t> data)
-            : m_ID(id), m_Name(name), m_Width(width), m_Height(height), m_Format(format), m_Data(std::move(data))
+            : m_ID(id), m_Name(name), m_Width(width), m_Height(height), m_Format(format)
+        {
+            auto owned = CreateRef<Vector<uint8_t>>(std::move(data));
+            m_Data = *owned;
+            m_Storage = std::move(owned);
+        }
+
+        /**
+         * @brief Constructs a TextureAsset that references pixel data owned elsewhere.
+         * 
+         * @param data Raw pixel data, e.g. inside a mapped file or a decoder's buffer.
+         * @param storage Keeps @p data valid for the lifetime of the asset.
+         */
+        TextureAsset(UUID id, const std::string& name, uint32_t width, uint32_t height, RHI::Format format,
+            std::span<const uint8_t> data, Ref<const void> storage)
+            : m_ID(id), m_Name(name), m_Width(width), m_Height(height), m_Format(format), m_Data(data), m_Storage(std::move(storage))
         {}
 
         virtual ~TextureAsset() = default;
@@ -52,6 +69,7 @@ namespace Mixture
         uint32_t m_Width;
         uint32_t m_Height;
         RHI::Format m_Format;
-        Vector<uint8_t> m_Data;
+        std::span<const uint8_t> m_Data;
+        Ref<const void> m_Storage;
     };
 }
@@ -12,6 +12,9 @@ namespace Mixture
 {
     /**
      * @brief Loads TextureAssets from files using stb_image.
+     *
+     * Uncompressed 8-bit RGBA or BGRA DDS files are pre-cooked: their top mip is served straight
+     * from the file data without decoding or copying.
      */
     class TextureSerializer : public AssetSerializer
     {
@@ -19,12 +22,13 @@ namespace Mixture
         virtual ~TextureSerializer() = default;
 
         /**
-         * @brief Loads a texture asset from raw data (e.g. PNG/JPG) using stb_image.
+         * @brief Loads a texture asset from raw data (e.g. PNG/JPG) using stb_image, or from a pre-cooked DDS.
          * 
          * @param data The raw file data.
+         * @param storage Owner of @p data, retained by pre-cooked textures.
          * @param metadata The asset metadata.
          * @return Ref<IAsset> The loaded texture asset.
          */
-        Ref<IAsset> Load(const Vector<char>& data, const AssetMetadata& metadata) override;
+        Ref<IAsset> Load(std::span<const std::byte> data, const Ref<const void>& storage, const AssetMetadata& metadata) override;
     };
 }
@@ -56,6 +56,18 @@ namespace Mixture
         RHI::GraphicsAPI API = RHI::GraphicsAPI::None;
         bool EnableImGui = false;
 
+        /**
+         * Renders into an offscreen backbuffer without creating a window, so no display is
+         * required. ImGui is disabled. Also enabled by the --headless command-line flag.
+         */
+        bool Headless = false;
+
+        /**
+         * Number of frames Run renders before it returns, or 0 to run until closed.
+         * Overridden by --frames <count>. Headless runs log the timing of every frame.
+         */
+        uint32_t FrameLimit = 0;
+
         ApplicationCommandLineArgs Args = ApplicationCommandLineArgs();
     };
 
@@ -108,8 +120,16 @@ namespace Mixture
          * @brief Gets the application window.
          *
          * @return const Window& Reference to the window.
+         * @throws std::logic_error If the application runs headless.
          */
-        OPAL_NODISCARD const Window& GetWindow() const { return *m_Window; }
+        OPAL_NODISCARD const Window& GetWindow() const
+        {
+            if (!m_Window) throw std::logic_error("Headless applications have no window");
+            return *m_Window;
+        }
+
+        /** @brief Returns whether the application renders offscreen without a window. */
+        OPAL_NODISCARD bool IsHeadless() const { return m_AppDescription.Headless; }
 
         /**
          * @brief Gets the applications graphics context.
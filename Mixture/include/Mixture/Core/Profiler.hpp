@@ -0,0 +1,262 @@
+#pragma once
+
+/**
+ * @file Profiler.hpp
+ * @brief Scoped CPU instrumentation exported as Chrome trace JSON.
+ */
+
+#include "Mixture/Core/Base.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define MX_PROFILE_USE_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define MX_PROFILE_USE_TSC 1
+#endif
+
+namespace Mixture
+{
+    /**
+     * @brief Records timed scopes into per-thread rings and writes them as Chrome trace JSON.
+     *
+     * Every thread that records a scope owns a fixed-size ring which only that thread writes,
+     * so recording never takes a lock. Rings keep the newest RingCapacity events; a capture
+     * that records more than that on one thread loses its oldest events. Each thread that
+     * records during a capture becomes a track labelled with the name it gave
+     * Opal::LogRegistry::SetThreadName before its first scope of that capture. The ring of a
+     * thread that exits is reused by a later thread once the next capture begins.
+     *
+     * Scopes are only recorded while a capture is running. The resulting file opens in
+     * chrome://tracing and in the Perfetto UI.
+     *
+     * Controlled by OPAL_DIST: in distribution builds the profiler and the MX_PROFILE
+     * macros compile into no-ops.
+     */
+    class Profiler
+    {
+    public:
+        /** @brief Number of events every thread ring retains. */
+        static constexpr size_t RingCapacity = 16384;
+
+        /** @brief Longest name a scope with a copied name keeps; longer names are truncated. */
+        static constexpr size_t MaxCopiedNameLength = 39;
+
+        /** @brief Returns the profiler clock in nanoseconds. */
+        static int64_t Now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /**
+         * @brief Returns the timestamp scopes are recorded with.
+         *
+         * Reads the time stamp counter on x86, which is invariant on every CPU the engine
+         * supports and costs a fraction of a clock call; elsewhere it is Now(). Ticks are
+         * converted to nanoseconds against Now() over the span of each capture.
+         */
+        static int64_t Ticks()
+        {
+#if defined(MX_PROFILE_USE_TSC)
+            return static_cast<int64_t>(__rdtsc());
+#else
+            return Now();
+#endif
+        }
+
+#if !defined(OPAL_DIST)
+        /**
+         * @brief Starts recording scopes on every thread.
+         *
+         * @param outputPath File EndCapture writes the trace to. Empty to only keep the events
+         *        for WriteChromeTrace.
+         * @param frameCount Number of MarkFrame calls after which the capture ends by itself,
+         *        or 0 to record until EndCapture.
+         */
+        static void BeginCapture(std::filesystem::path outputPath = {}, uint32_t frameCount = 0);
+
+        /**
+         * @brief Stops recording and writes the trace to the path given to BeginCapture.
+         *
+         * @return Whether a capture was running and its trace file, if any, was written.
+         */
+        static bool EndCapture();
+
+        /** @brief Returns whether scopes are currently being recorded. */
+        static bool IsCapturing() { return s_Capturing.load(std::memory_order_relaxed); }
+
+        /** @brief Marks a frame boundary and ends a frame-limited capture once its frames are recorded. */
+        static void MarkFrame();
+
+        /**
+         * @brief Writes the events of the running or latest capture as Chrome trace JSON.
+         *
+         * Safe to call while other threads are recording; events they overwrite during the
+         * copy are dropped rather than written torn.
+         */
+        static void WriteChromeTrace(std::ostream& stream);
+
+        /** @brief Returns the number of thread rings allocated so far, which only grows with concurrently recording threads. */
+        static size_t GetThreadRingCount();
+
+        /**
+         * @brief Records a finished scope on the calling thread.
+         *
+         * @p begin and @p end are Ticks() values, and @p name must outlive the capture.
+         */
+        static void Record(const char* name, int64_t begin, int64_t end)
+        {
+            ThreadRing& ring = GetThreadRing();
+            const uint64_t head = ring.Head.load(std::memory_order_relaxed);
+            TraceEvent& event = ring.Events[head % RingCapacity];
+            event.Begin = begin;
+            event.End = end;
+            event.Name = name;
+            ring.Head.store(head + 1, std::memory_order_release);
+        }
+
+        /** @brief Records a finished scope on the calling thread, copying up to MaxCopiedNameLength characters of @p name. */
+        static void RecordCopy(std::string_view name, int64_t begin, int64_t end);
+
+    private:
+        struct TraceEvent
+        {
+            int64_t Begin = 0;
+            int64_t End = 0;
+            /** @brief Static name, or null if the name was copied into CopiedName. */
+            const char* Name = nullptr;
+            char CopiedName[MaxCopiedNameLength + 1] = {};
+        };
+
+        enum class RingState : uint8_t
+        {
+            /** @brief Owned by a running thread. */
+            Active,
+            /** @brief Its thread exited; the events stay in the trace until the next capture begins. */
+            Exited,
+            /** @brief Unused and handed to the next thread that records a scope. */
+            Free
+        };
+
+        /**
+         * @brief Single-producer ring of one thread's events.
+         *
+         * The owning thread publishes an event by bumping Head with release ordering; readers
+         * copy the published range and re-read Head to drop slots the owner lapped meanwhile.
+         * State, ThreadName and ThreadId are guarded by the profiler's ring mutex.
+         */
+        struct ThreadRing
+        {
+            std::array<TraceEvent, RingCapacity> Events;
+            std::atomic<uint64_t> Head = 0;
+            std::string ThreadName;
+            uint32_t ThreadId = 0;
+            RingState State = RingState::Active;
+            /** @brief Capture the thread name was last read for. Only the owning thread touches it. */
+            uint32_t CaptureIndex = 0;
+        };
+
+        /** @brief Marks the thread's ring as exited when the thread ends, so a later thread can reuse it. */
+        struct ThreadRingOwner;
+
+        /** @brief Returns the calling thread's ring, taking the out-of-line path only once per thread and capture. */
+        static ThreadRing& GetThreadRing()
+        {
+            ThreadRing* ring = s_ThreadRing;
+            if (ring && ring->CaptureIndex == s_CaptureIndex.load(std::memory_order_relaxed)) [[likely]] return *ring;
+            return AcquireThreadRing();
+        }
+
+        /** @brief Hands the calling thread a ring and refreshes its track label for the running capture. */
+        static ThreadRing& AcquireThreadRing();
+
+        struct State;
+        static State& GetState();
+
+        static std::atomic<bool> s_Capturing;
+        /** @brief Bumped by every BeginCapture so threads refresh their track label once per capture. */
+        static std::atomic<uint32_t> s_CaptureIndex;
+        static inline thread_local ThreadRing* s_ThreadRing = nullptr;
+#else
+        // Compiled out in OPAL_DIST builds for zero performance cost
+        inline static void BeginCapture(std::filesystem::path = {}, uint32_t = 0) {}
+        inline static bool EndCapture() { return false; }
+        inline static bool IsCapturing() { return false; }
+        inline static void MarkFrame() {}
+        inline static void WriteChromeTrace(std::ostream&) {}
+        inline static size_t GetThreadRingCount() { return 0; }
+        inline static void Record(const char*, int64_t, int64_t) {}
+        inline static void RecordCopy(std::string_view, int64_t, int64_t) {}
+#endif
+    };
+
+    /**
+     * @brief Times the enclosing scope and records it when the scope ends.
+     *
+     * Costs a single relaxed load when no capture is running, and two Ticks() reads plus a
+     * write to the thread's ring while one is. Scopes that begin before a capture starts are
+     * not recorded. The Benchmarks project reports the measured cost of an empty scope with
+     * and without a running capture.
+     */
+    class ProfileScope
+    {
+    public:
+        /** @brief Tag selecting the constructor that copies a name which may not outlive the capture. */
+        struct CopyName {};
+
+        explicit ProfileScope(const char* name)
+            : m_Name(name)
+        {
+            if (Profiler::IsCapturing()) m_Begin = Profiler::Ticks();
+        }
+
+        /** @brief @p name must stay valid until the scope ends; it is copied when the scope is recorded. */
+        ProfileScope(CopyName, std::string_view name)
+            : m_CopiedName(name)
+        {
+            if (Profiler::IsCapturing()) m_Begin = Profiler::Ticks();
+        }
+
+        ~ProfileScope()
+        {
+            if (m_Begin == 0) return;
+            if (m_Name) Profiler::Record(m_Name, m_Begin, Profiler::Ticks());
+            else Profiler::RecordCopy(m_CopiedName, m_Begin, Profiler::Ticks());
+        }
+
+        OPAL_NON_COPIABLE(ProfileScope);
+
+    private:
+        const char* m_Name = nullptr;
+        std::string_view m_CopiedName;
+        int64_t m_Begin = 0;
+    };
+}
+
+#define MX_PROFILE_CONCAT_IMPL(a, b) a##b
+#define MX_PROFILE_CONCAT(a, b) MX_PROFILE_CONCAT_IMPL(a, b)
+
+#if !defined(OPAL_DIST)
+    /** @brief Records the enclosing scope under a string literal name. */
+    #define MX_PROFILE_SCOPE(name) ::Mixture::ProfileScope MX_PROFILE_CONCAT(mxProfileScope, __LINE__)(name)
+
+    /** @brief Records the enclosing scope under a name that is copied into the trace when the scope ends, e.g. a pass name. */
+    #define MX_PROFILE_SCOPE_COPY(name) ::Mixture::ProfileScope MX_PROFILE_CONCAT(mxProfileScope, __LINE__)(::Mixture::ProfileScope::CopyName{}, name)
+
+    /** @brief Records the enclosing function. */
+    #define MX_PROFILE_FUNCTION() MX_PROFILE_SCOPE(__func__)
+#else
+    #define MX_PROFILE_SCOPE(name)
+    #define MX_PROFILE_SCOPE_COPY(name)
+    #define MX_PROFILE_FUNCTION()
+#endif
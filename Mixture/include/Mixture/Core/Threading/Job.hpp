@@ -0,0 +1,151 @@
+#pragma once
+
+/**
+ * @file Job.hpp
+ * @brief Move-only callable with inline capture storage used by the TaskSystem.
+ */
+
+#include "Mixture/Core/Base.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Mixture
+{
+    /**
+     * @brief Type-erased `void()` callable that keeps small captures inline.
+     *
+     * Callables of up to InlineCapacity bytes that are nothrow move constructible are
+     * stored inside the Job itself, so submitting them never touches the heap. Larger
+     * callables fall back to a single heap allocation. Unlike std::function the Job is
+     * move-only and can therefore own move-only captures such as std::packaged_task.
+     */
+    class Job
+    {
+    public:
+        static constexpr size_t InlineCapacity = 64;
+
+        /** @brief Returns whether a callable of type F is stored without allocating. */
+        template<typename F>
+        static constexpr bool FitsInline = sizeof(F) <= InlineCapacity
+            && alignof(F) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<F>;
+
+        Job() = default;
+        Job(std::nullptr_t) {}
+
+        template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Job>
+            && !std::is_same_v<std::decay_t<F>, std::nullptr_t>>>
+        Job(F&& callable)
+        {
+            using Callable = std::decay_t<F>;
+
+            // Empty std::function objects and null function pointers yield an empty Job.
+            if constexpr (std::is_constructible_v<bool, const Callable&>)
+            {
+                if (!static_cast<bool>(callable)) return;
+            }
+
+            if constexpr (FitsInline<Callable>)
+            {
+                new (m_Storage) Callable(std::forward<F>(callable));
+                m_Ops = &InlineOperations<Callable>::Table;
+            }
+            else
+            {
+                *reinterpret_cast<Callable**>(m_Storage) = new Callable(std::forward<F>(callable));
+                m_Ops = &HeapOperations<Callable>::Table;
+            }
+        }
+
+        Job(Job&& other) noexcept { MoveFrom(other); }
+
+        Job& operator=(Job&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                MoveFrom(other);
+            }
+            return *this;
+        }
+
+        ~Job() { Reset(); }
+
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+
+        /** @brief Invokes the stored callable. The Job must not be empty. */
+        void operator()() { m_Ops->Invoke(m_Storage); }
+
+        explicit operator bool() const { return m_Ops != nullptr; }
+
+        /** @brief Returns whether the callable lives in the inline buffer. */
+        bool IsInline() const { return m_Ops && m_Ops->Inline; }
+
+        /** @brief Destroys the stored callable and its captures. */
+        void Reset()
+        {
+            if (m_Ops)
+            {
+                m_Ops->Destroy(m_Storage);
+                m_Ops = nullptr;
+            }
+        }
+
+    private:
+        struct Operations
+        {
+            void (*Invoke)(void* storage);
+            void (*Relocate)(void* from, void* to) noexcept;
+            void (*Destroy)(void* storage) noexcept;
+            bool Inline;
+        };
+
+        template<typename F>
+        struct InlineOperations
+        {
+            static void Invoke(void* storage) { (*static_cast<F*>(storage))(); }
+
+            static void Relocate(void* from, void* to) noexcept
+            {
+                F* source = static_cast<F*>(from);
+                new (to) F(std::move(*source));
+                source->~F();
+            }
+
+            static void Destroy(void* storage) noexcept { static_cast<F*>(storage)->~F(); }
+
+            static constexpr Operations Table = { &Invoke, &Relocate, &Destroy, true };
+        };
+
+        template<typename F>
+        struct HeapOperations
+        {
+            static void Invoke(void* storage) { (**static_cast<F**>(storage))(); }
+
+            static void Relocate(void* from, void* to) noexcept
+            {
+                *static_cast<F**>(to) = *static_cast<F**>(from);
+            }
+
+            static void Destroy(void* storage) noexcept { delete *static_cast<F**>(storage); }
+
+            static constexpr Operations Table = { &Invoke, &Relocate, &Destroy, false };
+        };
+
+        void MoveFrom(Job& other) noexcept
+        {
+            if (!other.m_Ops) return;
+
+            other.m_Ops->Relocate(other.m_Storage, m_Storage);
+            m_Ops = other.m_Ops;
+            other.m_Ops = nullptr;
+        }
+
+        alignas(std::max_align_t) std::byte m_Storage[InlineCapacity];
+        const Operations* m_Ops = nullptr;
+    };
+}
@@ -2,22 +2,92 @@
 
 /**
  * @file TaskSystem.hpp
- * @brief Simple task system for executing code on background threads.
+ * @brief Work-stealing task system for executing code on background threads.
  */
 
 #include "Mixture/Core/Base.hpp"
+#include "Mixture/Core/Threading/Job.hpp"
 
+#include <atomic>
+#include <exception>
 #include <functional>
 #include <future>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <variant>
 
 namespace Mixture
 {
+    struct TaskNode;
+
+    template<typename T>
+    class TaskResult;
+
+    /**
+     * @brief Lightweight reference to a job scheduled through the task graph API.
+     *
+     * A default constructed handle is treated as an already finished job, so it can be
+     * passed as a dependency without special casing.
+     */
+    class TaskHandle
+    {
+    public:
+        TaskHandle() = default;
+
+        /** @brief Returns whether the handle refers to a scheduled job. */
+        bool IsValid() const { return m_Node != nullptr; }
+
+        /** @brief Returns whether the job and everything it spawned through ParallelFor has completed. */
+        bool IsFinished() const;
+
+    private:
+        explicit TaskHandle(Ref<TaskNode> node) : m_Node(std::move(node)) {}
+
+        Ref<TaskNode> m_Node;
+
+        friend class TaskSystem;
+    };
+
     /**
      * @brief A system to manage background worker threads.
+     *
+     * Every worker owns a deque. Tasks submitted from a worker are pushed onto that
+     * worker's own deque without touching shared state; tasks submitted from other
+     * threads are distributed round-robin. Idle workers steal from the opposite end
+     * of their peers' deques before going to sleep.
+     *
+     * On top of plain submission the system offers a small job graph: every job carries
+     * an atomic counter of unfinished dependencies and is queued by whichever
+     * dependency finishes last, so no thread ever blocks to sequence work.
+     *
+     * Jobs are stored in fixed-size records carved from per-thread PoolAllocator slabs,
+     * so submitting a callable whose captures fit Job::InlineCapacity does not allocate.
      */
     class TaskSystem
     {
     public:
+        /**
+         * @brief Scheduler counters aggregated over all workers since Init.
+         */
+        struct Statistics
+        {
+            uint32_t WorkerCount = 0;
+            uint64_t TasksSubmitted = 0;
+            uint64_t TasksExecuted = 0;
+            /** @brief Submissions made by a worker onto its own deque. */
+            uint64_t LocalSubmissions = 0;
+            /** @brief Tasks a worker took from another worker's deque. */
+            uint64_t Steals = 0;
+            /** @brief Tasks executed by non-worker threads inside WaitAndHelp. */
+            uint64_t HelpedTasks = 0;
+            /** @brief Total time workers spent asleep waiting for work. */
+            uint64_t IdleNanoseconds = 0;
+            /** @brief Snapshot of the pending task count of every worker deque. */
+            Vector<size_t> QueueDepths;
+        };
+
         /**
          * @brief Initializes the task system with a specific number of threads.
          * 
@@ -36,14 +106,72 @@ namespace Mixture
         /**
          * @brief Submits a task to be executed asynchronously.
          * 
+         * @param task The function to execute. Captures up to Job::InlineCapacity bytes are
+         *        stored without a heap allocation.
+         * @throws std::runtime_error If the task system is not running. Tasks submitted by
+         *         a worker while Shutdown drains the queues are still accepted.
+         */
+        static void Submit(Job task);
+
+        /**
+         * @brief Returns a snapshot of the scheduler counters.
+         *
+         * Counters are sampled without stopping the workers, so values taken while
+         * tasks are in flight are approximate.
+         */
+        static Statistics GetStatistics();
+
+        /**
+         * @brief Schedules a job that starts once all dependencies have finished.
+         *
          * @param task The function to execute.
+         * @param dependencies Jobs that must complete first. Invalid handles are ignored.
+         * @return TaskHandle Handle that can be waited on or used as a dependency.
          * @throws std::runtime_error If the task system is not running.
          */
-        static void Submit(std::function<void()> task);
+        static TaskHandle Schedule(Job task, std::span<const TaskHandle> dependencies = {});
+
+        /** @copydoc Schedule(Job, std::span<const TaskHandle>) */
+        static TaskHandle Schedule(Job task, std::initializer_list<TaskHandle> dependencies)
+        {
+            return Schedule(std::move(task), std::span<const TaskHandle>(dependencies.begin(), dependencies.size()));
+        }
+
+        /**
+         * @brief Schedules a continuation that runs after @p antecedent has finished.
+         */
+        static TaskHandle Then(const TaskHandle& antecedent, Job continuation)
+        {
+            return Schedule(std::move(continuation), std::span<const TaskHandle>(&antecedent, 1));
+        }
+
+        /**
+         * @brief Splits [0, count) into chunks of @p grain elements and processes them in parallel.
+         *
+         * @param count Number of elements.
+         * @param grain Elements per job. 0 is treated as 1.
+         * @param fn Called as fn(begin, end) for every chunk.
+         * @param dependencies Jobs that must complete before any chunk starts.
+         * @return TaskHandle Handle that finishes once every chunk has run.
+         * @throws std::runtime_error If the task system is not running.
+         */
+        static TaskHandle ParallelFor(size_t count, size_t grain, std::function<void(size_t, size_t)> fn,
+            std::span<const TaskHandle> dependencies = {});
+
+        /**
+         * @brief Blocks until @p handle has finished, executing queued jobs in the meantime.
+         *
+         * Safe to call from a worker thread; the worker keeps draining work instead of
+         * parking, which avoids deadlocks when jobs wait on other jobs.
+         */
+        static void WaitAndHelp(const TaskHandle& handle);
 
         /**
          * @brief Submits a task and returns a future to wait for the result.
          * 
+         * The packaged task is moved into the job, so the only allocation is the
+         * future's shared state. Use SubmitInto to avoid that one as well.
+         *
          * @tparam F Function type.
          * @tparam Args Argument types.
          * @param f Function to execute.
@@ -56,15 +184,128 @@ namespace Mixture
         {
             using ReturnType = typename std::invoke_result<F, Args...>::type;
 
-            auto task = std::make_shared<std::packaged_task<ReturnType()>>(
-                std::bind(std::forward<F>(f), std::forward<Args>(args)...)
+            std::packaged_task<ReturnType()> task(
+                [f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable { return std::invoke(f, args...); }
             );
 
-            std::future<ReturnType> res = task->get_future();
+            std::future<ReturnType> res = task.get_future();
             
-            Submit([task]() { (*task)(); });
+            Submit(std::move(task));
             
             return res;
         }
+
+        /**
+         * @brief Submits a task whose result is written into caller-owned storage.
+         *
+         * Unlike SubmitFuture no shared state is allocated; @p result must stay alive
+         * until the task completed, which its destructor enforces by waiting.
+         *
+         * @param result Destination for the return value or exception. Must not be pending.
+         * @param f Function to execute.
+         * @param args Arguments.
+         * @throws std::runtime_error If the task system is not running or @p result is still pending.
+         */
+        template<typename R, typename F, typename... Args>
+        static void SubmitInto(TaskResult<R>& result, F&& f, Args&&... args);
+
+    private:
+        /** @brief Executes queued jobs on the calling thread until @p done is set. */
+        static void HelpUntil(const std::atomic<bool>& done);
+
+        template<typename T>
+        friend class TaskResult;
+    };
+
+    /**
+     * @brief Caller-owned result slot for TaskSystem::SubmitInto.
+     *
+     * Replaces std::future where the result lives on the waiting thread's stack: the job
+     * writes straight into this object, so no shared state has to be allocated.
+     * Waiting helps execute queued jobs like TaskSystem::WaitAndHelp.
+     */
+    template<typename T>
+    class TaskResult
+    {
+    public:
+        TaskResult() = default;
+        ~TaskResult() { Wait(); }
+
+        TaskResult(const TaskResult&) = delete;
+        TaskResult& operator=(const TaskResult&) = delete;
+
+        /** @brief Returns whether no task is writing into this result. */
+        bool IsReady() const { return m_Ready.load(std::memory_order_acquire); }
+
+        /** @brief Blocks until the bound task finished, executing queued jobs in the meantime. */
+        void Wait() const
+        {
+            if (!IsReady()) TaskSystem::HelpUntil(m_Ready);
+        }
+
+        /**
+         * @brief Waits for the task and returns its value.
+         *
+         * @throws Rethrows any exception thrown by the task.
+         */
+        decltype(auto) Get()
+        {
+            Wait();
+            if (m_Exception) std::rethrow_exception(m_Exception);
+
+            if constexpr (!std::is_void_v<T>)
+                return static_cast<T&>(*m_Value);
+        }
+
+    private:
+        using Storage = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+        template<typename F>
+        void Run(F&& f) noexcept
+        {
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                    f();
+                else
+                    m_Value.emplace(f());
+            }
+            catch (...)
+            {
+                m_Exception = std::current_exception();
+            }
+            m_Ready.store(true, std::memory_order_release);
+        }
+
+        std::optional<Storage> m_Value;
+        std::exception_ptr m_Exception;
+        std::atomic<bool> m_Ready = true;
+
+        friend class TaskSystem;
     };
+
+    template<typename R, typename F, typename... Args>
+    void TaskSystem::SubmitInto(TaskResult<R>& result, F&& f, Args&&... args)
+    {
+        static_assert(std::is_same_v<R, std::invoke_result_t<std::decay_t<F>&, std::decay_t<Args>&...>>, "TaskResult type must match the task's return type");
+
+        if (!result.IsReady())
+            throw std::runtime_error("TaskResult is still bound to a pending task");
+
+        result.m_Value.reset();
+        result.m_Exception = nullptr;
+        result.m_Ready.store(false, std::memory_order_relaxed);
+
+        try
+        {
+            Submit([&result, f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable {
+                result.Run([&]() -> R { return std::invoke(f, args...); });
+            });
+        }
+        catch (...)
+        {
+            result.m_Ready.store(true, std::memory_order_release);
+            throw;
+        }
+    }
 }
@@ -0,0 +1,79 @@
+#pragma once
+
+/**
+ * @file DynamicResolution.hpp
+ * @brief Render scale controller driven by measured GPU frame time.
+ */
+
+#include "Mixture/Core/Base.hpp"
+
+#include <cstdint>
+
+namespace Mixture
+{
+    /**
+     * @brief Picks the render scale that keeps the GPU frame time within a budget.
+     *
+     * Feed it the GPU time of every resolved frame, for example RenderGraph::GetGpuFrameTimeMs(),
+     * and declare scaled resources with the resulting GetScale(). GPU cost is assumed to grow with
+     * the pixel count, so the scale follows the square root of budget over smoothed frame time.
+     *
+     * Timestamps lag behind by the frames in flight, so after every change the controller waits
+     * Settings::SettleFrames samples before it measures the new scale.
+     */
+    class DynamicResolution
+    {
+    public:
+        struct Settings
+        {
+            /** @brief GPU time per frame to aim for. Slightly below 16.67 ms keeps 60 Hz with some headroom. */
+            float TargetFrameTimeMs = 16.0f;
+            float MinScale = 0.5f;
+            float MaxScale = 1.0f;
+            /** @brief Weight of a new sample in the exponential moving average of the frame time. */
+            float Smoothing = 0.1f;
+            /** @brief Relative deviation from the target that does not change the scale. */
+            float Tolerance = 0.05f;
+            /** @brief Largest scale change per adjustment. */
+            float MaxStep = 0.1f;
+            /** @brief Scales are multiples of this, so small fluctuations map to the same render extent. */
+            float Granularity = 0.05f;
+            /** @brief Samples ignored after a change while frames rendered at the old scale resolve. */
+            uint32_t SettleFrames = 3;
+        };
+
+        DynamicResolution() = default;
+        explicit DynamicResolution(const Settings& settings) { SetSettings(settings); }
+
+        /**
+         * @brief Replaces the settings and clamps the current scale into their range.
+         *
+         * @throws std::invalid_argument If the scale range, target or smoothing is not positive and ordered.
+         */
+        void SetSettings(const Settings& settings);
+        const Settings& GetSettings() const { return m_Settings; }
+
+        /**
+         * @brief Feeds the GPU time of the latest resolved frame.
+         *
+         * @param gpuFrameTimeMs The measured time; negative values (no timestamps) are ignored.
+         * @return Whether the scale changed.
+         */
+        bool Update(float gpuFrameTimeMs);
+
+        /** @brief Returns to the maximum scale and forgets the measured frame time. */
+        void Reset();
+
+        /** @brief Fraction of the output extent to render at, in [MinScale, MaxScale]. */
+        float GetScale() const { return m_Scale; }
+
+        /** @brief Smoothed GPU frame time the scale is based on, negative until the first sample. */
+        float GetSmoothedFrameTimeMs() const { return m_SmoothedFrameTimeMs; }
+
+    private:
+        Settings m_Settings;
+        float m_Scale = 1.0f;
+        float m_SmoothedFrameTimeMs = -1.0f;
+        uint32_t m_SettleFramesLeft = 0;
+    };
+}
@@ -10,31 +10,64 @@
 
 #include "Mixture/Render/Graph/RenderGraphDefinitions.hpp"
 #include "Mixture/Render/Graph/RenderGraphBuilder.hpp"
+#include "Mixture/Render/Graph/RenderGraphProfiler.hpp"
 #include "Mixture/Render/Graph/RenderGraphRegistry.hpp"
 #include "Mixture/Render/Graph/RenderGraphResourceCache.hpp"
 
+#include <array>
 #include <filesystem>
 #include <concepts>
-#include <unordered_map>
+#include <deque>
+#include <span>
+#include <string_view>
+#include <type_traits>
 
 namespace Mixture
 {
 
     /**
      * @brief Manages the render graph, including pass creation, compilation, and execution.
+     *
+     * Frame data is laid out for reuse: pass and resource nodes live in contiguous arrays
+     * indexed by handle, names are interned once per graph in a flat table keyed by their
+     * RGResourceName hash and referenced by ID, and pass
+     * data and execute callbacks are bound in the per-frame arena. Pass nodes are recycled
+     * across Clear() so their dependency lists keep their capacity, which makes a steady
+     * Clear()/AddPass()/Compile() cycle allocation-free once the compile cache is warm.
      */
     class RenderGraph
     {
     public:
+        /**
+         * @brief Counters of the topology-keyed compile cache.
+         */
+        struct CompileStatistics
+        {
+            /** @brief Compiles that replayed the previous schedule because the topology key matched. */
+            uint64_t CacheHits = 0;
+            /** @brief Compiles that ran culling, sorting, lifetimes and barriers from scratch. */
+            uint64_t CacheMisses = 0;
+        };
+
         RenderGraph(RHI::IGraphicsDevice& device) 
-            : m_PassAllocator(64 * 1024), m_Cache(device) 
+            : m_Device(device), m_PassAllocator(64 * 1024), m_Cache(device) 
         {
             m_Passes.reserve(64);
+            m_PassPool.reserve(64);
             m_Resources.reserve(128);
             m_ResourceLookup.reserve(128);
+            m_AliasTargets.reserve(128);
+            m_ResolvedAliases.reserve(128);
+            m_NameSlots.resize(256);
             m_ResourcesEndingAtPass.reserve(64);
+            m_ArenaFinalizers.reserve(64);
         }
 
+        ~RenderGraph();
+
+        RenderGraph(const RenderGraph&) = delete;
+        RenderGraph& operator=(const RenderGraph&) = delete;
+
         /**
          * @brief Resets the render graph, clearing all passes and resources.
          * Should be called at the start of each frame.
@@ -44,7 +77,7 @@ namespace Mixture
         /** Adds a stateful, class-based pass while retaining arena ownership. */
         template<typename PassT, typename... Args>
             requires std::derived_from<PassT, RenderPass>
-        void AddPass(const std::string& name, Args&&... args)
+        void AddPass(std::string_view name, Args&&... args)
         {
             static_assert(std::is_trivially_destructible_v<PassT>,
                 "RenderGraph pass classes must be trivially destructible");
@@ -52,8 +85,7 @@ namespace Mixture
             PassT* data = m_PassAllocator.Alloc<PassT>(std::forward<Args>(args)...);
             if (!data) throw std::bad_alloc();
 
-            auto& pass = m_Passes.emplace_back();
-            pass.Name = name;
+            auto& pass = AcquirePassNode(name);
             try
             {
                 RenderGraphBuilder builder(*this, pass);
@@ -74,69 +106,182 @@ namespace Mixture
         /**
          * @brief Adds a new render pass to the graph.
          *
-         * @tparam DataT A struct defining the pass data (inputs/outputs).
+         * The execute callable is moved into the graph arena next to the pass data, so
+         * the node only stores a pointer to it and declaring a pass does not allocate.
+         *
+         * @tparam PassData A struct defining the pass data (inputs/outputs).
          * @param name The name of the pass (for debugging/profiling).
-         * @param setup The setup function where resources are declared.
-         * @param execute The execution function where commands are recorded.
+         * @param setup Called as setup(RenderGraphBuilder&, PassData&) to declare resources.
+         * @param execute Called as execute(const RenderGraphRegistry&, const PassData&, RHI::ICommandList*)
+         *        to record commands.
          */
-        template<typename PassData>
+        template<typename PassData, typename SetupFn, typename ExecuteFn>
             requires (!std::derived_from<PassData, RenderPass>)
-        void AddPass(const std::string& name,
-             std::function<void(RenderGraphBuilder&, PassData&)> setup,
-             std::function<void(const RenderGraphRegistry&, const PassData&, RHI::ICommandList*)> execute)
+                && std::invocable<SetupFn&, RenderGraphBuilder&, PassData&>
+                && std::invocable<const std::decay_t<ExecuteFn>&, const RenderGraphRegistry&, const PassData&, RHI::ICommandList*>
+        void AddPass(std::string_view name, SetupFn&& setup, ExecuteFn&& execute)
         {
             static_assert(std::is_trivially_destructible<PassData>::value, "RenderGraph PassData must be trivially destructible (POD). Do not use std::vector or std::string inside PassData!");
 
+            struct BoundExecute
+            {
+                std::decay_t<ExecuteFn> Fn;
+                PassData* Data;
+            };
+
             auto data = m_PassAllocator.Alloc<PassData>();
             if (!data) throw std::bad_alloc();
 
-            auto& pass = m_Passes.emplace_back();
-            pass.Name = name;
+            auto& pass = AcquirePassNode(name);
+            try
+            {
+                RenderGraphBuilder builder(*this, pass);
+                setup(builder, *data);
+            }
+            catch (...)
+            {
+                m_Passes.pop_back();
+                throw;
+            }
 
-            RenderGraphBuilder builder(*this, pass);
-            setup(builder, *data);
+            BoundExecute* bound = m_PassAllocator.Alloc<BoundExecute>(std::forward<ExecuteFn>(execute), data);
+            if (!bound)
+            {
+                m_Passes.pop_back();
+                throw std::bad_alloc();
+            }
+            if constexpr (!std::is_trivially_destructible_v<BoundExecute>)
+            {
+                m_ArenaFinalizers.push_back({ [](void* object) { static_cast<BoundExecute*>(object)->~BoundExecute(); }, bound });
+            }
 
-            pass.Execute = [=](RenderGraphRegistry& registry, RHI::ICommandList* cmdList)
+            pass.Execute = [bound](RenderGraphRegistry& registry, RHI::ICommandList* cmdList)
                 {
-                    execute(registry, *data, cmdList);
+                    bound->Fn(registry, *bound->Data, cmdList);
                 };
         }
 
         /**
          * @brief Compiles the render graph.
          * Calculates resource lifetimes, barriers, and optimizes the graph execution order.
+         *
+         * The declared topology (pass names, reads, writes and resource descriptions) is
+         * flattened into a key first. If it matches the previous compile's key, the cached
+         * schedule, barriers and lifetimes are replayed instead of being recalculated.
          */
         void Compile();
 
+        /** @brief Returns the compile cache hit and miss counters. */
+        const CompileStatistics& GetCompileStatistics() const { return m_CompileStats; }
+
+        /** @brief Forces the next Compile to rebuild the schedule from scratch. */
+        void InvalidateCompiledGraph() { m_Compiled.Valid = false; }
+
         /** Writes graph diagnostics as JSON to an explicit caller-selected path. */
         bool DumpDiagnostics(const std::filesystem::path& outputPath) const;
 
         /**
          * @brief Executes the compiled render graph.
          *
+         * When parallel recording is enabled (see SetParallelRecording()), the TaskSystem is
+         * running and the context supports it, the passes of every dependency level are
+         * recorded concurrently into secondary command lists, which are then replayed into
+         * @p cmdList in schedule order. Otherwise all passes are recorded serially.
+         *
+         * Passes fused into one rendering scope are recorded together, as part of the
+         * first pass of the scope.
+         *
+         * Graphs with compute-queue passes are recorded per submission instead when the
+         * context supports async compute: the last graphics submission goes into
+         * @p cmdList and every other one into its own list queued on the context.
+         *
          * @param cmdList The command list to record commands into.
          * @param context The graphics context (for resource creation).
          */
         void Execute(RHI::ICommandList* cmdList, RHI::IGraphicsContext* context);
 
+        /**
+         * @brief Enables or disables recording independent passes on TaskSystem workers. Disabled by default.
+         *
+         * Only enable this when every pass's execute callback is safe to run concurrently with
+         * the other callbacks of its dependency level: it may use its own pass data, the registry
+         * and the command list it is given, but any other state it touches must be read-only
+         * during Execute or synchronized by the callback.
+         */
+        void SetParallelRecording(bool enabled) { m_ParallelRecording = enabled; }
+
+        /** @brief Returns whether independent passes may be recorded on TaskSystem workers. */
+        bool IsParallelRecordingEnabled() const { return m_ParallelRecording; }
+
+        /** @brief Returns the number of dependency levels of the compiled schedule. */
+        uint32_t GetDependencyLevelCount() const { return static_cast<uint32_t>(m_PassesByLevel.size()); }
+
+        /** @brief Returns the per-queue submissions of the compiled schedule. */
+        const Vector<RGSubmission>& GetSubmissions() const { return m_Submissions; }
+
+        /**
+         * @brief Sets how many passes apart a resource's previous user and its next transition
+         * must be before the transition is split into a begin after the previous user and an
+         * end before the transition's pass. 0 disables split barriers.
+         */
+        void SetSplitBarrierDistance(uint32_t passCount);
+
+        /** @brief Returns the number of split barriers of the compiled schedule. */
+        uint32_t GetSplitBarrierCount() const { return m_SplitBarrierCount; }
+
+        /**
+         * @brief Enables or disables fusing adjacent passes that render to the same attachments
+         * into one rendering scope. Enabled by default.
+         */
+        void SetRenderPassMerging(bool enabled);
+
+        /** @brief Returns whether adjacent compatible passes share a rendering scope. */
+        bool IsRenderPassMergingEnabled() const { return m_RenderPassMerging; }
+
+        /** @brief Returns the number of passes of the compiled schedule merged into their predecessor's scope. */
+        uint32_t GetMergedPassCount() const { return m_MergedPassCount; }
+
+        /**
+         * @brief Returns the CPU and GPU time of every pass of the latest frame whose GPU work completed.
+         * Frames are resolved when their frame slot is executed again, so results lag by the frames in flight.
+         */
+        const Vector<RGPassTiming>& GetPassTimings() const { return m_Profiler.GetResults(); }
+
+        /** @brief Returns the GPU time spanned by the passes of the latest resolved frame, or negative if unavailable. */
+        float GetGpuFrameTimeMs() const { return m_Profiler.GetGpuFrameTimeMs(); }
+
+        /** @brief Returns the number of transients of the compiled schedule that never leave a rendering scope. */
+        uint32_t GetMemorylessResourceCount() const { return m_MemorylessResourceCount; }
+
+        /** @brief Sets how transients are pooled across frames, see RenderGraphResourceCache::PoolPolicy. */
+        void SetTransientPoolPolicy(const RenderGraphResourceCache::PoolPolicy& policy) { m_Cache.SetPolicy(policy); }
+
+        /** @brief Returns the memory and pool statistics of the latest executed frame. */
+        const RenderGraphResourceCache::Statistics& GetTransientStatistics() const { return m_Cache.GetStatistics(); }
+
         /**
          * @brief Imports an external texture resource (e.g., Swapchain Backbuffer) into the graph.
          * Returns a handle that passes can use to Write() to it.
          *
+         * The graph starts from the state the texture was left in by its last use (see ResourceStateTracker)
+         * and records the state it leaves it in, so the next import skips redundant transitions.
+         *
          * @param name The name of the resource.
          * @param resource The external texture resource.
+         * @param info Optional hints about the contents and the state to hand the texture back in.
          * @return RGResourceHandle A handle to the imported resource.
          */
-        RGResourceHandle ImportResource(const std::string& name, RHI::ITexture* resource);
+        RGResourceHandle ImportResource(RGResourceName name, RHI::ITexture* resource, const RGImportInfo& info = {});
 
         /**
          * @brief Imports an external buffer resource into the graph.
          *
          * @param name The name of the resource.
          * @param resource The external buffer resource.
+         * @param info Optional hints about the contents and the state to hand the buffer back in.
          * @return RGResourceHandle A handle to the imported resource.
          */
-        RGResourceHandle ImportResource(const std::string& name, RHI::IBuffer* resource);
+        RGResourceHandle ImportResource(RGResourceName name, RHI::IBuffer* resource, const RGImportInfo& info = {});
 
         /**
          * @brief Creates a new internal resource (transient) for the graph.
@@ -145,7 +290,7 @@ namespace Mixture
          * @param desc The description of the texture to create.
          * @return RGResourceHandle A handle to the created resource.
          */
-        RGResourceHandle CreateResource(const std::string& name, const RHI::TextureDesc& desc);
+        RGResourceHandle CreateResource(RGResourceName name, const RHI::TextureDesc& desc);
 
         /**
          * @brief Creates a new internal buffer (transient) for the graph.
@@ -154,7 +299,61 @@ namespace Mixture
          * @param desc The description of the buffer to create.
          * @return RGResourceHandle A handle to the created resource.
          */
-        RGResourceHandle CreateResource(const std::string& name, const RHI::BufferDesc& desc);
+        RGResourceHandle CreateResource(RGResourceName name, const RHI::BufferDesc& desc);
+
+        /**
+         * @brief Sets the extent and render scale that scaled resources are sized by.
+         * Call it before declaring them; it keeps its value across Clear().
+         */
+        void SetViewport(const RGViewport& viewport);
+
+        /** @brief Returns the viewport scaled resources are sized by. */
+        const RGViewport& GetViewport() const { return m_Viewport; }
+
+        /**
+         * @brief Creates a transient texture sized relative to the scaled viewport.
+         *
+         * Passes render at @p relativeSize times the viewport extent times its scale, while the
+         * texture is allocated for the unscaled extent. Changing the scale therefore neither
+         * reallocates transients nor invalidates the compiled graph.
+         *
+         * @param name The name of the resource.
+         * @param desc The description of the texture; its width and height are ignored.
+         * @param relativeSize Size relative to the scaled viewport, e.g. 0.5 for a half-resolution target.
+         * @return RGResourceHandle A handle to the created resource.
+         * @throws std::logic_error If no viewport was set.
+         * @throws std::invalid_argument If @p relativeSize is not positive.
+         */
+        RGResourceHandle CreateScaledResource(RGResourceName name, const RHI::TextureDesc& desc, float relativeSize = 1.0f);
+
+        /**
+         * @brief Declares a texture whose contents survive into the next frame.
+         *
+         * The graph owns two textures per persistent name and swaps them every frame, so
+         * GetHistory() can return what the previous frame wrote. Their states carry over
+         * between frames instead of restarting at Undefined, and both are recreated when
+         * the size or format in @p desc changes. Sampled and attachment usage are added to
+         * @p desc so a version can be rendered to and later read as history.
+         *
+         * @param name The name of the resource, stable across frames.
+         * @param desc The description of the texture.
+         * @return RGResourceHandle A handle to this frame's version of the texture.
+         */
+        RGResourceHandle CreatePersistentResource(RGResourceName name, const RHI::TextureDesc& desc);
+
+        /**
+         * @brief Returns the previous frame's version of a persistent texture.
+         *
+         * Its contents are undefined on the first frame and after a resize; HasValidHistory()
+         * tells the cases apart.
+         *
+         * @param handle A handle returned by CreatePersistentResource() this frame.
+         * @return RGResourceHandle A handle to the history texture.
+         */
+        RGResourceHandle GetHistory(RGResourceHandle handle);
+
+        /** @brief Returns whether the history of a persistent texture holds what the previous frame wrote. */
+        bool HasValidHistory(RGResourceHandle handle) const;
 
         /**
          * @brief Gets the current pass node being processed.
@@ -167,10 +366,14 @@ namespace Mixture
         /**
          * @brief Retrieves an existing resource handle by name.
          *
+         * Only the name hash is used, so looking up a literal name neither hashes nor
+         * allocates at runtime. Aliases are resolved once per frame, on the first lookup
+         * after they changed.
+         *
          * @param name The name of the resource to find.
          * @return RGResourceHandle The handle if found, or an invalid handle.
          */
-        RGResourceHandle GetResource(const std::string& name) const;
+        RGResourceHandle GetResource(RGResourceName name) const;
 
         /**
          * @brief Maps a resource alias name to a target resource name.
@@ -178,7 +381,7 @@ namespace Mixture
          * @param aliasName The alias name (e.g. "Backbuffer").
          * @param targetName The target resource name (e.g. "ViewportTarget" or "SwapchainBackbuffer").
          */
-        void AddAlias(std::string aliasName, std::string targetName);
+        void AddAlias(RGResourceName aliasName, RGResourceName targetName);
 
         /**
          * @brief Clears all registered resource aliases.
@@ -204,22 +407,193 @@ namespace Mixture
         const RGResourceNode& GetResourceNode(RGResourceHandle handle) const;
         void AddTextureUsage(RGResourceHandle handle, RHI::TextureUsage usage);
 
+        /**
+         * @brief Validates the subresource range of a handle against its texture and brings it into
+         * canonical form, so ranges spanning every mip or layer compare equal to a whole-resource handle.
+         *
+         * @throws std::out_of_range If the range exceeds the texture's mips or layers.
+         * @throws std::invalid_argument If a buffer handle addresses a subresource range.
+         */
+        RGResourceHandle ResolveSubresources(RGResourceHandle handle) const;
+
     private:
         void CullPasses();
-        void SortPasses();
+        bool SortPasses();
         void CalculateLifetimes();
         void CalculateBarriers();
+        void CalculateDependencyLevels();
         RGResourceHandle NextResourceHandle() const;
+        RGResourceHandle AddResourceNode(const RGResourceName& name, RGResourceNode& node);
+        RGPassNode& AcquirePassNode(std::string_view name);
+        void RecyclePasses(Vector<RGPassNode>& passes);
+        void RunArenaFinalizers();
+
+        static constexpr uint32_t InvalidNameID = ~0u;
+
+        /** @brief Returns the ID of the interned name with hash @p hash, or InvalidNameID if it was never interned. */
+        uint32_t FindNameID(uint64_t hash) const;
+        /** @brief Interns @p name on first use and returns its ID together with the stable interned string. */
+        std::pair<uint32_t, std::string_view> InternName(const RGResourceName& name);
+        /** @brief Collapses every alias chain into m_ResolvedAliases. */
+        void ResolveAliases() const;
+
+        void RecordPass(size_t passIndex, RHI::ICommandList* cmdList, RHI::IGraphicsContext* context, bool multiQueue = false);
+        bool RecordPassesInParallel(RHI::ICommandList* cmdList, RHI::IGraphicsContext* context);
+        bool RecordSubmissions(RHI::ICommandList* cmdList, RHI::IGraphicsContext* context);
+        RHI::ResourceBarrier ToResourceBarrier(const RGBarrier& barrier, bool multiQueue);
+        void RecordBarrierBatch(std::span<const RGBarrier> barriers, RHI::ICommandList* cmdList, bool multiQueue);
+        void RecordSplitBarriers(std::span<const RGBarrier> barriers, RHI::ICommandList* cmdList, bool begin);
+        void ReleaseEndingResources(size_t passIndex);
+        /** @brief Records the state every imported resource is left in with the ResourceStateTracker. */
+        void StoreImportedStates();
+
+        /** @brief Writes every input the compile depends on into @p key. */
+        void BuildTopologyKey(Vector<uint64_t>& key) const;
+        void StoreCompiledGraph();
+        void ReplayCompiledGraph();
+
+        /**
+         * @brief Result of the last full compile, replayed while the topology is unchanged.
+         */
+        struct CompiledGraph
+        {
+            /** @brief Compile results of one scheduled pass. */
+            struct Pass
+            {
+                uint32_t DeclarationIndex = 0;
+                uint32_t DependencyLevel = 0;
+                Vector<RGBarrier> Barriers;
+                Vector<RGBarrier> ReleaseBarriers;
+                Vector<RGBarrier> SplitBarrierBegins;
+                Vector<uint32_t> QueueDependencies;
+                /** @brief Load and store op of every attachment write, as resolved from lifetimes. */
+                Vector<RHI::LoadOp> LoadOps;
+                Vector<RHI::StoreOp> StoreOps;
+                bool MergedWithPrevious = false;
+                bool MergedWithNext = false;
+            };
+
+            /** @brief Compile results of one resource. */
+            struct Resource
+            {
+                int32_t FirstPassIndex = -1;
+                int32_t LastPassIndex = -1;
+                bool UsedByAsyncQueue = false;
+                bool Memoryless = false;
+            };
+
+            bool Valid = false;
+            /** @brief Key of the topology the schedule was compiled for. */
+            Vector<uint64_t> TopologyKey;
+            /** @brief Every scheduled pass, in execution order. */
+            Vector<Pass> Passes;
+            Vector<Resource> Resources;
+        };
+        /** @brief Slot of the open-addressing name table. */
+        struct NameSlot
+        {
+            uint64_t Hash = 0;
+            uint32_t ID = InvalidNameID;
+        };
+
+        /** @brief Double-buffered texture owned by the graph, see CreatePersistentResource(). */
+        struct PersistentResource
+        {
+            static constexpr uint64_t NeverCurrent = ~0ull;
+
+            RHI::TextureDesc Desc;
+            std::array<Ref<RHI::ITexture>, 2> Textures;
+            /** @brief Frame number in which each texture was last the current version. */
+            std::array<uint64_t, 2> CurrentInFrame = { NeverCurrent, NeverCurrent };
+            uint32_t Current = 0;
+            uint64_t DeclaredInFrame = NeverCurrent;
+            /** @brief Interned name the history version is declared under. */
+            RGResourceName HistoryName;
+            RGResourceHandle Handle;
+            RGResourceHandle HistoryHandle;
+        };
+
+        /** @brief Graph resource of this frame that is backed by a persistent texture. */
+        struct PersistentBinding
+        {
+            RGResourceHandle Handle;
+            uint32_t Resource = 0;
+        };
+
+        /** @brief Returns the persistent binding of @p handle in this frame, or nullptr. */
+        const PersistentBinding* FindPersistentBinding(RGResourceHandle handle) const;
+
+        /** @brief Destructor of a non-trivial object living in the pass arena. */
+        struct ArenaFinalizer
+        {
+            void (*Destroy)(void* object);
+            void* Object;
+        };
     private:
+        RHI::IGraphicsDevice& m_Device;
         ArenaAllocator m_PassAllocator;
+        Vector<ArenaFinalizer> m_ArenaFinalizers;
 
         Vector<RGPassNode> m_Passes;
+        /** @brief Nodes of previous frames, reused by AcquirePassNode to keep their list capacity. */
+        Vector<RGPassNode> m_PassPool;
         Vector<RGResourceNode> m_Resources;
-        std::unordered_map<std::string, RGResourceHandle> m_ResourceLookup;
-        std::unordered_map<std::string, std::string> m_Aliases;
+
+        /**
+         * @brief Linear-probing table from name hash to name ID, sized to a power of two.
+         * Kept across Clear() so names are interned only once.
+         */
+        Vector<NameSlot> m_NameSlots;
+        /** @brief Interned strings, indexed by name ID. A deque keeps them at stable addresses. */
+        std::deque<std::string> m_Names;
+        /** @brief Resource declared under a name this frame, indexed by name ID. */
+        Vector<RGResourceHandle> m_ResourceLookup;
+        /** @brief Name ID an alias points to this frame, indexed by name ID. */
+        Vector<uint32_t> m_AliasTargets;
+        /** @brief Final name ID every alias chain ends at, indexed by name ID. Rebuilt lazily after aliases change. */
+        mutable Vector<uint32_t> m_ResolvedAliases;
+        mutable bool m_AliasesResolved = false;
+
+        /** @brief Number of Clear() calls, used to tell whether a persistent texture was current last frame. */
+        uint64_t m_FrameNumber = 0;
+        Vector<PersistentResource> m_PersistentResources;
+        /** @brief Index into m_PersistentResources, indexed by name ID. */
+        Vector<uint32_t> m_PersistentLookup;
+        Vector<PersistentBinding> m_PersistentBindings;
+        /** @brief Persistent textures replaced by a resize, kept until no frame in flight can use them. */
+        Vector<std::pair<uint64_t, Ref<RHI::ITexture>>> m_RetiredPersistentTextures;
         Vector<Vector<RGResourceHandle>> m_ResourcesEndingAtPass;
 
         RenderGraphRegistry m_Registry;
         RenderGraphResourceCache m_Cache;
+        RenderGraphProfiler m_Profiler;
+
+        CompiledGraph m_Compiled;
+        /** @brief Topology key of the frame being compiled, reused so building it does not allocate. */
+        Vector<uint64_t> m_TopologyKey;
+        CompileStatistics m_CompileStats;
+        /** @brief Scratch permutation state of ReplayCompiledGraph: position of every declared pass and declaration at every position. */
+        Vector<uint32_t> m_ReplayPositions;
+        Vector<uint32_t> m_ReplayDeclarations;
+
+        /** @brief Scheduled pass indices grouped by dependency level. */
+        Vector<Vector<uint32_t>> m_PassesByLevel;
+        Vector<RGSubmission> m_Submissions;
+        /**
+         * @brief Transitions into RGImportInfo::FinalState, recorded after the last pass.
+         * Only rebuilt on a compile cache miss; the topology key covers every state they depend on.
+         */
+        Vector<RGBarrier> m_FinalBarriers;
+        /** @brief State each imported resource is left in, indexed by handle. Undefined if the graph does not touch it. */
+        Vector<RHI::ResourceState> m_FinalStates;
+        uint32_t m_SplitBarrierDistance = 2;
+        uint32_t m_SplitBarrierCount = 0;
+        uint32_t m_MergedPassCount = 0;
+        uint32_t m_MemorylessResourceCount = 0;
+        RGViewport m_Viewport;
+        bool m_RenderPassMerging = true;
+        Vector<Scope<RHI::ICommandList>> m_SecondaryLists;
+        Vector<RHI::ICommandList*> m_SecondaryListPointers;
+        bool m_ParallelRecording = false;
     };
 }
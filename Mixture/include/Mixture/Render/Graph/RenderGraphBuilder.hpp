@@ -56,6 +56,17 @@ namespace Mixture
          */
         void SetSideEffect();
 
+        /**
+         * @brief Records and submits this pass on the given queue.
+         *
+         * Passes on the compute queue overlap graphics work. The graph inserts the
+         * semaphore waits and ownership transfers needed where resources cross queues.
+         * Without async compute support the pass runs on the graphics queue instead.
+         *
+         * @param queue The queue to execute on.
+         */
+        void SetQueue(RHI::QueueType queue);
+
         /**
          * @brief Creates a new internal transient resource for this pass.
          *
@@ -63,7 +74,7 @@ namespace Mixture
          * @param desc The description of the texture to create.
          * @return RGResourceHandle A handle to the created resource.
          */
-        RGResourceHandle CreateTexture(const std::string& name, const RHI::TextureDesc& desc);
+        RGResourceHandle CreateTexture(RGResourceName name, const RHI::TextureDesc& desc);
 
         /**
          * @brief Creates a new internal transient buffer for this pass.
@@ -72,7 +83,13 @@ namespace Mixture
          * @param desc The description of the buffer to create.
          * @return RGResourceHandle A handle to the created resource.
          */
-        RGResourceHandle CreateBuffer(const std::string& name, const RHI::BufferDesc& desc);
+        RGResourceHandle CreateBuffer(RGResourceName name, const RHI::BufferDesc& desc);
+
+        /**
+         * @brief Retrieves the description of a texture declared in the graph.
+         * For scaled resources its extent is the one passes render at, not the allocated one.
+         */
+        const RHI::TextureDesc& GetTextureDesc(RGResourceHandle handle) const;
 
         /**
          * @brief Loads a shader (or retrieves it from cache) using the AssetSystem.
@@ -101,8 +118,5 @@ namespace Mixture
     private:
         RenderGraph& m_Graph;
         RGPassNode& m_PassNode;
-
-        Vector<RHI::Format> m_CurrentColorFormats;
-        RHI::Format m_CurrentDepthFormat = RHI::Format::Undefined;
     };
 }
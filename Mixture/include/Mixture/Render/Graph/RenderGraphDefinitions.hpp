@@ -11,6 +11,7 @@
 #include "Mixture/Render/RHI/RHI.hpp"
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <functional>
 
@@ -43,10 +44,26 @@ namespace Mixture
      */
     struct RGBarrier
     {
+        /** @brief The resource and the range of its subresources that transition. */
         RGResourceHandle Resource;
         RHI::ResourceState Before;
         RHI::ResourceState After;
         // Flags like "Flush L2 Cache" or "Memory Access" can be added here
+
+        /**
+         * @brief Queues owning the resource before and after the barrier.
+         * They differ for both halves of a queue ownership transfer.
+         */
+        RHI::QueueType SourceQueue = RHI::QueueType::Graphics;
+        RHI::QueueType DestinationQueue = RHI::QueueType::Graphics;
+
+        static constexpr uint32_t NoSplit = ~0u;
+
+        /**
+         * @brief Split barrier the transition belongs to, or NoSplit for an ordinary barrier.
+         * A split transition is started after the resource's previous user and completed here.
+         */
+        uint32_t Split = NoSplit;
     };
 
     /**
@@ -61,6 +78,38 @@ namespace Mixture
         float DepthClearValue = 1.0f;
     };
 
+    /**
+     * @brief Describes how an imported resource enters and leaves the graph.
+     */
+    struct RGImportInfo
+    {
+        /**
+         * @brief Ignore the tracked state and treat the contents as undefined,
+         * e.g. for a freshly acquired swapchain image that is fully overwritten.
+         */
+        bool DiscardContents = false;
+
+        /**
+         * @brief State the graph leaves the resource in after its last pass, or Undefined
+         * to leave it in whatever state its last use needed.
+         */
+        RHI::ResourceState FinalState = RHI::ResourceState::Undefined;
+    };
+
+    /**
+     * @brief Output extent and render scale that scaled resources are sized by.
+     *
+     * See RenderGraph::CreateScaledResource().
+     */
+    struct RGViewport
+    {
+        /** @brief Full-resolution extent, usually that of the backbuffer. */
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        /** @brief Fraction of the extent scaled resources are rendered at, e.g. DynamicResolution::GetScale(). */
+        float Scale = 1.0f;
+    };
+
     enum class RGResourceType : uint8_t
     {
         Texture,
@@ -76,23 +125,51 @@ namespace Mixture
     struct RGResourceNode
     {
         RGResourceHandle Handle;
-        std::string Name;
-        RGResourceType Type;
+        /** @brief Name interned by the owning RenderGraph; stays valid for the graph's lifetime. */
+        std::string_view Name;
+        RGResourceType Type = RGResourceType::Texture;
 
-        // Descriptors (Only one is valid based on Type)
-        RHI::TextureDesc TextureDesc;
-        RHI::BufferDesc BufferDesc;
+        /** @brief Description of the resource. Type selects the active member. */
+        union
+        {
+            RHI::TextureDesc TextureDesc;
+            RHI::BufferDesc BufferDesc;
+        };
 
         // External Pointers (For imports)
         RHI::ITexture* ExternalTexture = nullptr;
         RHI::IBuffer* ExternalBuffer = nullptr;
 
+        /** @brief State an imported buffer starts in. Textures use TextureDesc.InitialState. */
+        RHI::ResourceState BufferInitialState = RHI::ResourceState::Undefined;
+        /** @brief State requested by RGImportInfo::FinalState for an imported resource. */
+        RHI::ResourceState FinalState = RHI::ResourceState::Undefined;
+
+        /**
+         * @brief Extent a transient texture is allocated at when it differs from TextureDesc,
+         * which then holds the extent passes render at. 0 allocates TextureDesc's extent.
+         */
+        uint32_t AllocationWidth = 0;
+        uint32_t AllocationHeight = 0;
+
         // --- Lifetime Metadata ---
 
         /** @brief Index of the first pass that uses this resource. Initialize to -1 to indicate "Not Used". */
         int32_t FirstPassIndex = -1;
         /** @brief Index of the last pass that uses this resource. */
         int32_t LastPassIndex = -1;
+        /**
+         * @brief Whether a pass on a non-graphics queue uses this resource.
+         * Such resources may be in use concurrently with any graphics pass and are never aliased.
+         */
+        bool UsedByAsyncQueue = false;
+        /**
+         * @brief Whether the transient lives entirely inside one rendering scope as an attachment
+         * that is neither loaded nor stored, so it never needs physical memory on tile-based GPUs.
+         */
+        bool Memoryless = false;
+
+        RGResourceNode() : TextureDesc() {}
     };
 
     /**
@@ -100,7 +177,8 @@ namespace Mixture
      */
     struct RGPassNode
     {
-        std::string Name;
+        /** @brief Name interned by the owning RenderGraph; stays valid for the graph's lifetime. */
+        std::string_view Name;
 
         // Dependencies (Built during Setup phase)
         Vector<RGResourceHandle> Reads;
@@ -109,11 +187,54 @@ namespace Mixture
 
         Vector<RGBarrier> Barriers;
 
+        /**
+         * @brief Ownership releases recorded after the pass, handing resources to another queue.
+         */
+        Vector<RGBarrier> ReleaseBarriers;
+
+        /**
+         * @brief Split barriers started after the pass and completed by a later pass on the same queue.
+         */
+        Vector<RGBarrier> SplitBarrierBegins;
+
+        /**
+         * @brief Queue the pass is recorded and submitted on.
+         */
+        RHI::QueueType Queue = RHI::QueueType::Graphics;
+
+        /**
+         * @brief Scheduled passes on other queues that must complete before this pass starts.
+         */
+        Vector<uint32_t> QueueDependencies;
+
         /**
          * @brief Prevents culling when the pass performs work outside declared resources.
          */
         bool HasSideEffects = false;
 
+        /**
+         * @brief Whether the pass draws into the rendering scope opened by the previous scheduled pass.
+         * Set by RenderGraphAlgorithms::MergeRenderPasses.
+         */
+        bool MergedWithPrevious = false;
+
+        /**
+         * @brief Whether the pass leaves its rendering scope open for the next scheduled pass.
+         */
+        bool MergedWithNext = false;
+
+        /**
+         * @brief Position of the pass in declaration order, assigned by RenderGraph::Compile.
+         * Lets a cached schedule be replayed onto a freshly declared frame.
+         */
+        uint32_t DeclarationIndex = 0;
+
+        /**
+         * @brief Longest chain of resource dependencies leading to this pass.
+         * Passes sharing a level do not depend on each other and may be recorded concurrently.
+         */
+        uint32_t DependencyLevel = 0;
+
         /**
          * @brief The actual execution logic (Recorded lambda).
          * We pass the Registry so you can look up the REAL texture later.
@@ -121,6 +242,18 @@ namespace Mixture
         std::function<void(RenderGraphRegistry&, RHI::ICommandList*)> Execute;
     };
 
+    /**
+     * @brief A contiguous run of scheduled passes submitted to one queue.
+     */
+    struct RGSubmission
+    {
+        RHI::QueueType Queue = RHI::QueueType::Graphics;
+        /** @brief Scheduled pass indices, in execution order. */
+        Vector<uint32_t> Passes;
+        /** @brief Earlier submissions on other queues this one waits for before starting. */
+        Vector<uint32_t> WaitSubmissions;
+    };
+
     namespace RenderGraphAlgorithms
     {
         /**
@@ -129,6 +262,8 @@ namespace Mixture
          * Writes to imported resources and explicitly side-effecting passes are
          * graph roots. Passes without declared writes are retained for backward
          * compatibility because their external effects cannot be inferred.
+         * Required resources are tracked in a bitset indexed by resource ID; a write
+         * only satisfies the requirement when it covers every mip and layer.
          */
         void CullPasses(Vector<RGPassNode>& passes, const Vector<RGResourceNode>& resources);
 
@@ -137,7 +272,8 @@ namespace Mixture
          *
          * Pass declaration order defines the order of conflicting accesses. The
          * sort may only reorder independent passes and remains stable for passes
-         * that are simultaneously ready.
+         * that are simultaneously ready. Runs in O(passes + accesses) on dense
+         * arrays indexed by pass and resource ID.
          *
          * @param passes Passes to sort in-place.
          * @return true when a complete ordering was produced.
@@ -148,5 +284,56 @@ namespace Mixture
          * @brief Calculates first and last pass use for every virtual resource.
          */
         void CalculateResourceLifetimes(const Vector<RGPassNode>& passes, Vector<RGResourceNode>& resources);
+
+        /**
+         * @brief Assigns every pass the dependency level it can be recorded on.
+         *
+         * A pass lands one level after the deepest pass it has a read-after-write,
+         * write-after-write or write-after-read hazard with, so all passes of a level
+         * are mutually independent.
+         *
+         * @param passes Passes in execution order, as produced by SortPasses.
+         * @return The number of levels.
+         */
+        uint32_t CalculateDependencyLevels(Vector<RGPassNode>& passes);
+
+        /**
+         * @brief Splits the schedule into per-queue submissions.
+         *
+         * A submission ends as soon as a pass on another queue depends on it, and a
+         * pass that depends on a submission it does not already wait for starts a new
+         * one. Waits always refer to earlier submissions, so submitting in the returned
+         * order never waits on work that has not been submitted yet.
+         *
+         * @param passes Passes in execution order with their QueueDependencies calculated.
+         */
+        Vector<RGSubmission> BuildSubmissions(const Vector<RGPassNode>& passes);
+
+        /**
+         * @brief Fuses adjacent passes rendering to the same attachments into one rendering scope.
+         *
+         * A pass continues the previous pass's scope when both are graphics passes of the
+         * same submission, it writes exactly the same attachments with LoadOp::Load and the
+         * only barriers it needs keep those attachments in their current state. Such
+         * barriers are dropped, as draws within one scope are ordered by rasterization order.
+         *
+         * @param passes Passes in execution order with their barriers calculated.
+         * @param submissions Submissions built from @p passes.
+         * @return The number of passes merged into the scope of their predecessor.
+         */
+        uint32_t MergeRenderPasses(Vector<RGPassNode>& passes, const Vector<RGSubmission>& submissions);
+
+        /**
+         * @brief Derives attachment load and store ops of every rendering scope from resource lifetimes.
+         *
+         * Transient attachments first used by a scope are not loaded, and those no pass after
+         * the scope uses are not stored. A transient that lives entirely inside one scope as
+         * an attachment is marked Memoryless.
+         *
+         * @param passes Passes in execution order, after MergeRenderPasses.
+         * @param resources Resources with their lifetimes calculated.
+         * @return The number of resources marked Memoryless.
+         */
+        uint32_t ResolveAttachmentOps(Vector<RGPassNode>& passes, Vector<RGResourceNode>& resources);
     }
 }
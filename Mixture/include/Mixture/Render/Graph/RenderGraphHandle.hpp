@@ -2,19 +2,26 @@
 
 /**
  * @file RenderGraphHandle.hpp
- * @brief Lightweight handle for RenderGraph resources.
+ * @brief Lightweight handles and hashed names for RenderGraph resources.
  */
 
 #include "Mixture/Core/Base.hpp"
+#include "Mixture/Render/RHI/ITexture.hpp"
 
 #include <cstdint>
 #include <limits>
+#include <string>
+#include <string_view>
 
 namespace Mixture
 {
 
     /**
-     * @brief A lightweight handle to a resource in the graph (just an index).
+     * @brief A lightweight handle to a resource in the graph (an index and a subresource range).
+     *
+     * A handle addresses the whole resource unless Mips() or Layers() narrow it down to a range
+     * of a texture, e.g. `builder.Write(bloom.Mip(2))`. Handles compare equal when they refer to
+     * the same resource, whatever subresources they address.
      */
     struct RGResourceHandle 
     {
@@ -23,13 +30,116 @@ namespace Mixture
 
         IDType ID = InvalidID;
 
+        /** @brief Addressed mips and layers. A count of 0 extends the range to the last mip or layer. */
+        uint16_t BaseMip = 0;
+        uint16_t MipCount = 0;
+        uint16_t BaseLayer = 0;
+        uint16_t LayerCount = 0;
+
         static RGResourceHandle FromIndex(size_t index)
         {
             return index < InvalidID ? RGResourceHandle{ static_cast<IDType>(index) } : RGResourceHandle{};
         }
 
+        /** @brief Returns a handle to @p count mips starting at @p baseMip of the addressed layers. */
+        RGResourceHandle Mips(uint16_t baseMip, uint16_t count = 1) const
+        {
+            RGResourceHandle handle = *this;
+            handle.BaseMip = baseMip;
+            handle.MipCount = count;
+            return handle;
+        }
+
+        /** @brief Returns a handle to @p count layers starting at @p baseLayer of the addressed mips. */
+        RGResourceHandle Layers(uint16_t baseLayer, uint16_t count = 1) const
+        {
+            RGResourceHandle handle = *this;
+            handle.BaseLayer = baseLayer;
+            handle.LayerCount = count;
+            return handle;
+        }
+
+        RGResourceHandle Mip(uint16_t mip) const { return Mips(mip, 1); }
+        RGResourceHandle Layer(uint16_t layer) const { return Layers(layer, 1); }
+
+        /** @brief Returns a handle to every subresource of the same resource. */
+        RGResourceHandle Whole() const { return RGResourceHandle{ ID }; }
+
+        bool IsWholeResource() const { return BaseMip == 0 && MipCount == 0 && BaseLayer == 0 && LayerCount == 0; }
+
+        /** @brief Returns the addressed subresources as an RHI range. */
+        RHI::TextureSubresourceRange GetSubresources() const
+        {
+            RHI::TextureSubresourceRange range;
+            range.BaseMip = BaseMip;
+            range.MipCount = MipCount ? MipCount : RHI::TextureSubresourceRange::Remaining;
+            range.BaseLayer = BaseLayer;
+            range.LayerCount = LayerCount ? LayerCount : RHI::TextureSubresourceRange::Remaining;
+            return range;
+        }
+
+        /** @brief Returns whether both handles address the same subresources of the same resource. */
+        bool HasSameSubresources(const RGResourceHandle& other) const
+        {
+            return ID == other.ID && BaseMip == other.BaseMip && MipCount == other.MipCount &&
+                BaseLayer == other.BaseLayer && LayerCount == other.LayerCount;
+        }
+
+        /** @brief Returns whether both handles address at least one common subresource. */
+        bool Overlaps(const RGResourceHandle& other) const
+        {
+            const auto overlaps = [](uint32_t base, uint32_t count, uint32_t otherBase, uint32_t otherCount)
+            {
+                const uint32_t end = count ? base + count : ~0u;
+                const uint32_t otherEnd = otherCount ? otherBase + otherCount : ~0u;
+                return base < otherEnd && otherBase < end;
+            };
+            return ID == other.ID && overlaps(BaseMip, MipCount, other.BaseMip, other.MipCount) &&
+                overlaps(BaseLayer, LayerCount, other.BaseLayer, other.LayerCount);
+        }
+
         bool IsValid() const { return ID != InvalidID; }
         bool operator==(const RGResourceHandle& other) const { return ID == other.ID; }
         bool operator!=(const RGResourceHandle& other) const { return ID != other.ID; }
     };
+
+    /**
+     * @brief Name of a graph resource together with its 64-bit FNV-1a hash.
+     *
+     * Construction is constexpr, so names spelled as string literals are hashed at compile
+     * time and the graph resolves them by comparing hashes only. The string itself is kept
+     * for debugging and must outlive the call it is passed to.
+     */
+    struct RGResourceName
+    {
+        uint64_t Hash = 0;
+        std::string_view Name;
+
+        static constexpr uint64_t Hash64(std::string_view name)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (const char c : name)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        constexpr RGResourceName() = default;
+        constexpr RGResourceName(std::string_view name) : Hash(Hash64(name)), Name(name) {}
+        constexpr RGResourceName(const char* name) : RGResourceName(std::string_view(name)) {}
+        RGResourceName(const std::string& name) : RGResourceName(std::string_view(name)) {}
+
+        constexpr bool operator==(const RGResourceName& other) const { return Hash == other.Hash; }
+    };
+
+    inline namespace Literals
+    {
+        /** @brief Spells a resource name whose hash is guaranteed to be computed at compile time, e.g. "Backbuffer"_rg. */
+        consteval RGResourceName operator""_rg(const char* name, size_t size)
+        {
+            return RGResourceName(std::string_view(name, size));
+        }
+    }
 }
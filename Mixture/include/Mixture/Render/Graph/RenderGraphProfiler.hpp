@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * @file RenderGraphProfiler.hpp
+ * @brief CPU and GPU timing of render graph passes.
+ */
+
+#include "Mixture/Core/Base.hpp"
+
+#include "Mixture/Render/Graph/RenderGraphDefinitions.hpp"
+#include "Mixture/Render/RHI/IGraphicsContext.hpp"
+
+#include <chrono>
+#include <span>
+#include <string_view>
+
+namespace Mixture
+{
+    /**
+     * @brief Measured cost of one scheduled pass of a completed frame.
+     */
+    struct RGPassTiming
+    {
+        std::string_view Name;
+        /** @brief Time spent recording the pass, including its barriers. */
+        float CpuTimeMs = 0.0f;
+        /** @brief GPU time between the timestamps around the pass, or negative if no timestamps were available. */
+        float GpuTimeMs = -1.0f;
+    };
+
+    /**
+     * @brief Wraps every recorded pass in a CPU scope and a pair of GPU timestamp queries.
+     *
+     * Each frame slot of the graphics context keeps the records of the last frame recorded
+     * into it. BeginFrame runs after the context waited for the slot, so the timestamps of
+     * those records are complete and become the latest results. Pass @c i writes only record
+     * @c i and queries @c 2i and @c 2i+1, so passes can be recorded on several threads.
+     */
+    class RenderGraphProfiler
+    {
+    public:
+        /**
+         * @brief Resolves the frame previously recorded into the context's current slot and
+         * prepares one record per scheduled pass.
+         *
+         * GPU timestamps are only written when the slot has a query pair for every pass.
+         */
+        void BeginFrame(const RHI::IGraphicsContext& context, std::span<const RGPassNode> passes);
+
+        /** @brief Starts the CPU scope of scheduled pass @p passIndex and writes its first timestamp. */
+        void BeginPass(size_t passIndex, RHI::ICommandList* cmdList);
+
+        /** @brief Ends the CPU scope of scheduled pass @p passIndex and writes its second timestamp. */
+        void EndPass(size_t passIndex, RHI::ICommandList* cmdList);
+
+        /** @brief Timings of the latest resolved frame, in schedule order. */
+        const Vector<RGPassTiming>& GetResults() const { return m_Results; }
+
+        /** @brief GPU time from the first to the last timestamp of the latest resolved frame, or negative if unavailable. */
+        float GetGpuFrameTimeMs() const { return m_GpuFrameTimeMs; }
+
+    private:
+        void Resolve(const RHI::IGraphicsContext& context, uint32_t slotIndex);
+
+        struct PassRecord
+        {
+            std::string_view Name;
+            std::chrono::steady_clock::time_point CpuBegin;
+            float CpuTimeMs = 0.0f;
+        };
+
+        struct FrameSlot
+        {
+            Vector<PassRecord> Passes;
+            bool HasTimestamps = false;
+        };
+
+        /** @brief Records of the last frame of every slot, the readback ring of the timestamps. */
+        Vector<FrameSlot> m_Slots;
+        uint32_t m_CurrentSlot = 0;
+        Vector<uint64_t> m_Timestamps;
+        Vector<RGPassTiming> m_Results;
+        float m_GpuFrameTimeMs = -1.0f;
+    };
+}
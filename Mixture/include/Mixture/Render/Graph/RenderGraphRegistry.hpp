@@ -48,7 +48,7 @@ namespace Mixture
          * @param handle The virtual handle.
          * @return RHI::ITexture* Pointer to the physical texture.
          */
-        RHI::ITexture* GetTexture(RGResourceHandle handle);
+        RHI::ITexture* GetTexture(RGResourceHandle handle) const;
 
         /** @brief Removes a transient texture mapping after its last graph use. */
         void UnregisterTexture(RGResourceHandle handle);
@@ -61,20 +61,32 @@ namespace Mixture
          */
 
         /**
-         * @brief Associates a handle with a real GPU buffer.
+         * @brief Associates a handle with a range of a real GPU buffer.
          *
          * @param handle The virtual handle.
          * @param buffer The physical buffer resource.
+         * @param range The bytes of the buffer backing the handle.
          */
-        void RegisterBuffer(RGResourceHandle handle, RHI::IBuffer* buffer);
+        void RegisterBuffer(RGResourceHandle handle, RHI::IBuffer* buffer, const RHI::BufferRange& range = {});
 
         /**
          * @brief Retrieves the real GPU buffer during pass execution.
          *
+         * Transient buffers share their physical buffer with other transients; bind
+         * them with the offset and size from GetBufferRange.
+         *
          * @param handle The virtual handle.
          * @return RHI::IBuffer* Pointer to the physical buffer.
          */
-        RHI::IBuffer* GetBuffer(RGResourceHandle handle);
+        RHI::IBuffer* GetBuffer(RGResourceHandle handle) const;
+
+        /**
+         * @brief Retrieves the bytes of the physical buffer backing a handle.
+         *
+         * @param handle The virtual handle.
+         * @return The range registered with the buffer, or the whole buffer if none was.
+         */
+        RHI::BufferRange GetBufferRange(RGResourceHandle handle) const;
 
         /** @brief Removes a transient buffer mapping after its last graph use. */
         void UnregisterBuffer(RGResourceHandle handle);
@@ -126,6 +138,11 @@ namespace Mixture
          * @brief List of buffers indexed by their handle ID.
          */
         Vector<RHI::IBuffer*>  m_Buffers;
+
+        /**
+         * @brief Ranges of m_Buffers backing each handle.
+         */
+        Vector<RHI::BufferRange> m_BufferRanges;
     };
 
 }
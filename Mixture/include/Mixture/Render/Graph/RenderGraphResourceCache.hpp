@@ -6,6 +6,7 @@
  */
 
 #include "Mixture/Core/Base.hpp"
+#include "Mixture/Render/Graph/RenderGraphDefinitions.hpp"
 #include "Mixture/Render/RHI/RHI.hpp"
 #include "Mixture/Util/Util.hpp"
 #include <unordered_map>
@@ -16,10 +17,89 @@ namespace Mixture
      * @brief Caches render graph resources (Textures, Buffers) across frames.
      * Pools resources by descriptor and synchronized frame slot. Logical resource
      * names do not create permanent cache entries.
+     *
+     * When the device supports placed resources, transients whose pass intervals do
+     * not overlap are packed into shared memory heaps instead, so a texture that is
+     * dead after the G-Buffer pass can hand its memory to one born during lighting.
+     *
+     * Memoryless transients are created as transient attachments and never aliased,
+     * since their memory is only committed while a rendering scope needs it.
+     *
+     * Transient buffers are suballocated from one linear buffer per usage and frame
+     * slot. A size change moves offsets instead of creating a buffer, and the slot's
+     * buffer only grows when a frame needs more than it holds.
+     *
+     * The PoolPolicy can round textures up to size classes, so a resolution that changes
+     * every frame keeps hitting the same entries, and bound the pooled memory with a
+     * budget that evicts idle entries least recently used first.
      */
     class RenderGraphResourceCache
     {
     public:
+        /**
+         * @brief Physical resource backing one virtual transient for the current frame.
+         */
+        struct TransientResource
+        {
+            Ref<RHI::ITexture> Texture;
+            Ref<RHI::IBuffer> Buffer;
+            /** @brief Bytes of Buffer backing the transient. */
+            RHI::BufferRange Range;
+        };
+
+        /**
+         * @brief Memory accounting of the transients placed for the current frame slot.
+         */
+        struct Statistics
+        {
+            /** @brief Transients bound into shared heaps. */
+            uint32_t AliasedResources = 0;
+            /** @brief Heaps backing the aliased transients. */
+            uint32_t HeapCount = 0;
+            /** @brief Bytes the aliased transients would need with one allocation each. */
+            uint64_t RequestedBytes = 0;
+            /** @brief Bytes actually reserved by the shared heaps. */
+            uint64_t HeapBytes = 0;
+            /** @brief RequestedBytes minus HeapBytes. */
+            uint64_t BytesSavedByAliasing = 0;
+            /** @brief Transient buffers suballocated from the slot's linear buffers. */
+            uint32_t SuballocatedBuffers = 0;
+            /** @brief Bytes reserved by the slot's linear buffers. */
+            uint64_t LinearBufferBytes = 0;
+            /** @brief Pooled requests served by an idle entry. */
+            uint32_t PoolHits = 0;
+            /** @brief Pooled requests that created a resource. */
+            uint32_t PoolMisses = 0;
+            /** @brief Idle entries destroyed to stay within the budget. */
+            uint32_t PoolEvictions = 0;
+            /** @brief Bytes held by pooled entries of every frame slot. */
+            uint64_t PooledBytes = 0;
+        };
+
+        /**
+         * @brief How pooled transients are matched and retained.
+         */
+        struct PoolPolicy
+        {
+            /**
+             * @brief Rounds texture extents up to size classes, at most a quarter above the request.
+             *
+             * Passes render to the requested extent at the top left of the larger texture;
+             * RenderGraph::GetTextureDesc keeps the requested extent, so readers can scale
+             * their UVs by requested over physical size.
+             */
+            bool UseSizeClasses = false;
+
+            /** @brief Bytes pooled entries may hold before idle ones are evicted. 0 disables the budget. */
+            uint64_t BudgetBytes = 0;
+        };
+
+        /** @brief Offset alignment of suballocated buffers; the largest one Vulkan lets a device require. */
+        static constexpr uint64_t TransientBufferAlignment = 256;
+
+        /** @brief Smallest linear buffer created for a usage. */
+        static constexpr uint64_t MinimumLinearBufferSize = 64 * 1024;
+
         /**
          * @brief Constructs a RenderGraphResourceCache.
          *
@@ -35,7 +115,7 @@ namespace Mixture
          */
         void BeginFrame(uint32_t frameIndex);
 
-        /** @brief Retrieves a pooled texture or creates one if necessary. */
+        /** @brief Retrieves a pooled texture or creates one if necessary, sized by GetPhysicalDesc. */
         Ref<RHI::ITexture> GetOrCreateTexture(const RHI::TextureDesc& desc);
 
         /**
@@ -46,6 +126,33 @@ namespace Mixture
          */
         Ref<RHI::IBuffer> GetOrCreateBuffer(const RHI::BufferDesc& desc);
 
+        /**
+         * @brief Realizes every transient of a compiled graph for the current frame slot.
+         *
+         * Uses FirstPassIndex/LastPassIndex to place non-overlapping textures into
+         * shared heaps. The placement is kept per frame slot and only rebuilt when the
+         * set of transient textures or their lifetimes change. Buffers are carved from
+         * the slot's linear buffers every frame. Transients the device cannot place
+         * fall back to descriptor pooling.
+         *
+         * @param resources Graph resources with calculated lifetimes.
+         * @return One entry per resource, indexed by handle. Imported and unused resources stay empty.
+         */
+        const Vector<TransientResource>& AcquireTransients(const Vector<RGResourceNode>& resources);
+
+        /** @brief Returns the statistics of the frame slot last passed to AcquireTransients. */
+        const Statistics& GetStatistics() const { return m_Statistics; }
+
+        /** @brief Applies a pool policy. Entries created under the previous one stay until retired. */
+        void SetPolicy(const PoolPolicy& policy) { m_Policy = policy; }
+        const PoolPolicy& GetPolicy() const { return m_Policy; }
+
+        /** @brief Returns the description a transient texture is allocated with under the current policy. */
+        RHI::TextureDesc GetPhysicalDesc(const RHI::TextureDesc& desc) const;
+
+        /** @brief Returns the description a transient node is allocated with, honoring its allocation extent. */
+        RHI::TextureDesc GetPhysicalDesc(const RGResourceNode& node) const;
+
         /**
          * @brief Clears the cache, releasing all held resources.
          */
@@ -59,12 +166,16 @@ namespace Mixture
             uint32_t Height;
             RHI::Format PixelFormat;
             RHI::ResourceState InitialState;
+            RHI::TextureUsage Usage;
+            uint32_t MipLevels;
+            uint32_t ArrayLayers;
             bool operator==(const TextureKey&) const = default;
         };
         struct TextureKeyHash {
             std::size_t operator()(const TextureKey& key) const {
                 size_t seed = 0;
-                Util::HashCombine(seed, key.Width, key.Height, key.PixelFormat, key.InitialState);
+                Util::HashCombine(seed, key.Width, key.Height, key.PixelFormat, key.InitialState, static_cast<uint32_t>(key.Usage),
+                    key.MipLevels, key.ArrayLayers);
                 return seed;
             }
         };
@@ -88,11 +199,69 @@ namespace Mixture
             Ref<Resource> ResourceRef;
             uint32_t FrameIndex = 0;
             bool UsedInLastFrame = true;
+            /** @brief Value of m_FrameCounter when the entry was last handed out. */
+            uint64_t LastUsedFrame = 0;
+            uint64_t Bytes = 0;
+        };
+
+        /** @brief An idle entry that may be evicted, identified by its resource. */
+        struct EvictionCandidate
+        {
+            uint64_t LastUsedFrame = 0;
+            uint64_t Bytes = 0;
+            const void* Resource = nullptr;
+        };
+
+        /** @brief Everything that influences the placement of one transient texture. */
+        struct TransientSignature
+        {
+            RGResourceHandle::IDType ID = 0;
+            RHI::TextureDesc TextureDesc;
+            int32_t FirstPassIndex = -1;
+            int32_t LastPassIndex = -1;
+            bool UsedByAsyncQueue = false;
+            bool Memoryless = false;
+            bool operator==(const TransientSignature&) const = default;
         };
 
+        /** @brief One buffer per usage that the transient buffers of a frame slot are carved from. */
+        struct LinearBuffer
+        {
+            RHI::BufferUsage Usage = RHI::BufferUsage::Storage;
+            Ref<RHI::IBuffer> Buffer;
+            uint64_t Head = 0;
+        };
+
+        /** @brief Heaps, linear buffers and placed resources owned by one frame slot. */
+        struct AliasedFrame
+        {
+            Vector<TransientSignature> Signature;
+            Vector<Ref<RHI::IMemoryHeap>> Heaps;
+            /** @brief Outlives placement rebuilds, so a changed graph reuses the slot's buffers. */
+            Vector<LinearBuffer> LinearBuffers;
+            Vector<TransientResource> Placed;
+            Statistics Stats;
+            bool UsedInLastFrame = true;
+        };
+
+        void BuildAliasedFrame(AliasedFrame& frame, const Vector<RGResourceNode>& resources);
+        void SuballocateBuffers(AliasedFrame& frame, const Vector<RGResourceNode>& resources);
+        uint64_t EstimateBytes(const RHI::TextureDesc& desc) const;
+        void EnforceBudget();
+
         uint32_t m_CurrentFrameIndex = 0;
+        uint64_t m_FrameCounter = 0;
         bool m_FrameActive = false;
 
+        PoolPolicy m_Policy;
+        uint64_t m_PooledBytes = 0;
+        Vector<EvictionCandidate> m_EvictionScratch;
+
+        std::unordered_map<uint32_t, AliasedFrame> m_AliasedFrames;
+        Vector<TransientSignature> m_SignatureScratch;
+        Vector<TransientResource> m_Transients;
+        Statistics m_Statistics;
+
         std::unordered_map<TextureKey, Vector<CacheEntry<RHI::ITexture>>, TextureKeyHash> m_TextureCache;
         std::unordered_map<BufferKey, Vector<CacheEntry<RHI::IBuffer>>, BufferKeyHash> m_BufferCache;
     };
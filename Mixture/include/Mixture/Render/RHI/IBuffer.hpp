@@ -75,17 +75,50 @@ namespace Mixture::RHI
         }
     };
 
+    /**
+     * @brief A byte range of a buffer.
+     *
+     * Transient render graph buffers are suballocated from one buffer per usage and
+     * frame slot, so they have to be bound and synchronized through their range.
+     */
+    struct BufferRange
+    {
+        /**
+         * @brief Size that extends the range to the end of the buffer.
+         */
+        static constexpr uint64_t WholeSize = ~0ull;
+
+        uint64_t Offset = 0;
+        uint64_t Size = WholeSize;
+
+        bool IsWhole() const { return Offset == 0 && Size == WholeSize; }
+
+        bool operator==(const BufferRange&) const = default;
+    };
+
     /**
      * @brief Interface representing a GPU buffer.
      */
     class IBuffer
     {
     public:
+        /**
+         * @brief Assigns the instance ID.
+         */
+        IBuffer();
+
         /**
          * @brief Virtual destructor.
          */
         virtual ~IBuffer() = default;
 
+        /**
+         * @brief Retrieves an ID no other buffer created by this process shares,
+         *        even one later allocated at the same address.
+         * @return The instance ID.
+         */
+        uint64_t GetInstanceID() const { return m_InstanceID; }
+
         /**
          * @brief Retrieves the size of the buffer.
          * @return The size in bytes.
@@ -97,5 +130,8 @@ namespace Mixture::RHI
          * @return The BufferUsage enum value.
          */
         virtual BufferUsage GetUsage() const = 0;
+
+    private:
+        uint64_t m_InstanceID;
     };
 }
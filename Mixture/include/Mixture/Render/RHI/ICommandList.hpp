@@ -10,10 +10,54 @@
 #include "Mixture/Render/RHI/IGraphicsDevice.hpp"
 #include "Mixture/Render/RHI/ResourceStates.hpp"
 
+#include <span>
 #include <vector>
 
 namespace Mixture::RHI
 {
+    /**
+     * Hardware queue a command list records for.
+     */
+    enum class QueueType : uint8_t
+    {
+        /**
+         * The queue that renders and presents the frame.
+         */
+        Graphics = 0,
+
+        /**
+         * An asynchronous compute queue whose work can overlap graphics work.
+         */
+        Compute
+    };
+
+    /**
+     * One resource transition of a batched barrier. Exactly one of Texture and Buffer is set.
+     */
+    struct ResourceBarrier
+    {
+        ITexture* Texture = nullptr;
+        IBuffer* Buffer = nullptr;
+        ResourceState Before = ResourceState::Undefined;
+        ResourceState After = ResourceState::Undefined;
+
+        /**
+         * Queues owning the resource before and after the transition, see PipelineBarrier.
+         */
+        QueueType SourceQueue = QueueType::Graphics;
+        QueueType DestinationQueue = QueueType::Graphics;
+
+        /**
+         * Mips and layers of Texture that transition. Ignored for buffers.
+         */
+        TextureSubresourceRange Subresources;
+
+        /**
+         * Bytes of Buffer that transition. Ignored for textures.
+         */
+        BufferRange Range;
+    };
+
     /**
      * Helper struct for Dynamic Rendering (Vulkan 1.3).
      */
@@ -43,6 +87,12 @@ namespace Mixture::RHI
          * Depth clear value.
          */
         float DepthClearValue = 1.0f;
+
+        /**
+         * Mip level and array layer rendered to.
+         */
+        uint32_t MipLevel = 0;
+        uint32_t ArrayLayer = 0;
     };
 
     /**
@@ -118,6 +168,17 @@ namespace Mixture::RHI
          */
         virtual void EndRendering() = 0;
 
+        /**
+         * Replays recorded secondary command lists into this list, in the given order.
+         *
+         * Secondary lists are created through IGraphicsContext::CreateSecondaryCommandList
+         * and must have been ended. Bound pipeline and descriptor state does not carry
+         * over, so it has to be set again before the next draw.
+         *
+         * @param commandLists The secondary command lists to execute.
+         */
+        virtual void ExecuteSecondary(std::span<ICommandList* const> commandLists) = 0;
+
         // ---------------------------------------------------------------------
         // State Setup
         // ---------------------------------------------------------------------
@@ -160,25 +221,114 @@ namespace Mixture::RHI
          *
          * @param buffer The buffer to bind.
          * @param binding The binding index.
+         * @param offset Byte offset of the first vertex within the buffer.
          */
-        virtual void BindVertexBuffer(IBuffer* buffer, uint32_t binding = 0) = 0;
+        virtual void BindVertexBuffer(IBuffer* buffer, uint32_t binding = 0, uint64_t offset = 0) = 0;
 
         /**
          * Binds an index buffer.
          *
          * @param buffer The buffer to bind.
+         * @param offset Byte offset of the first index within the buffer.
          */
-        virtual void BindIndexBuffer(IBuffer* buffer) = 0;
+        virtual void BindIndexBuffer(IBuffer* buffer, uint64_t offset = 0) = 0;
 
         /**
          * Creates a pipeline image barrier for the specified texture.
          *
+         * When the queues differ, the barrier is one half of a queue ownership transfer:
+         * the same barrier has to be recorded on the source queue (release) and on the
+         * destination queue (acquire), with a semaphore wait between the two submissions.
+         *
          * @param texture the texture to create the barrier for
          * @param oldState the old state of the layout
          * @param newState the new state of the layout
+         * @param sourceQueue the queue that owned the resource so far
+         * @param destinationQueue the queue that owns the resource afterwards
+         * @param subresources the mips and layers of the texture to transition
+         */
+        virtual void PipelineBarrier(ITexture* texture, ResourceState oldState, ResourceState newState,
+            QueueType sourceQueue = QueueType::Graphics, QueueType destinationQueue = QueueType::Graphics,
+            const TextureSubresourceRange& subresources = {}) = 0;
+
+        /**
+         * Creates a pipeline buffer barrier for a range of the specified buffer.
+         *
+         * Queue ownership transfers work as for textures.
+         *
+         * @param range the bytes of the buffer to transition
+         */
+        virtual void PipelineBarrier(IBuffer* buffer, ResourceState oldState, ResourceState newState,
+            QueueType sourceQueue = QueueType::Graphics, QueueType destinationQueue = QueueType::Graphics,
+            const BufferRange& range = {}) = 0;
+
+        /**
+         * Records several transitions as a single barrier.
+         *
+         * A subresource must appear at most once per batch. The default implementation
+         * records one PipelineBarrier per entry.
+         *
+         * @param barriers the transitions to record
+         */
+        virtual void PipelineBarriers(std::span<const ResourceBarrier> barriers)
+        {
+            for (const auto& barrier : barriers)
+            {
+                if (barrier.Texture)
+                    PipelineBarrier(barrier.Texture, barrier.Before, barrier.After, barrier.SourceQueue, barrier.DestinationQueue,
+                        barrier.Subresources);
+                else if (barrier.Buffer)
+                    PipelineBarrier(barrier.Buffer, barrier.Before, barrier.After, barrier.SourceQueue, barrier.DestinationQueue,
+                        barrier.Range);
+            }
+        }
+
+        /**
+         * Starts a split barrier. The transitions may execute as soon as everything recorded
+         * so far has finished, while the commands recorded until EndSplitBarriers keep running.
+         *
+         * The barrier has to be completed by EndSplitBarriers with the same index and the same
+         * transitions, later in the frame and on the same queue. The default implementation
+         * records nothing and leaves the whole barrier to EndSplitBarriers.
+         *
+         * @param splitIndex index of the split barrier, unique within the frame
+         * @param barriers the transitions to start
+         */
+        virtual void BeginSplitBarriers(uint32_t splitIndex, std::span<const ResourceBarrier> barriers)
+        {
+            (void)splitIndex;
+            (void)barriers;
+        }
+
+        /**
+         * Waits for a split barrier started by BeginSplitBarriers.
+         *
+         * @param splitIndex index passed to BeginSplitBarriers
+         * @param barriers the transitions passed to BeginSplitBarriers
+         */
+        virtual void EndSplitBarriers(uint32_t splitIndex, std::span<const ResourceBarrier> barriers)
+        {
+            (void)splitIndex;
+            PipelineBarriers(barriers);
+        }
+
+        // ---------------------------------------------------------------------
+        // Queries
+        // ---------------------------------------------------------------------
+
+        /**
+         * Writes a GPU timestamp into query @p queryIndex of the current frame slot once
+         * every previously recorded command has completed.
+         *
+         * Indices must be below IGraphicsContext::GetTimestampQueryCount and written at most
+         * once per frame. The default implementation records nothing.
+         *
+         * @param queryIndex index of the timestamp query
          */
-        virtual void PipelineBarrier(ITexture* texture, ResourceState oldState, ResourceState newState) = 0;
-        virtual void PipelineBarrier(IBuffer* buffer, ResourceState oldState, ResourceState newState) = 0;
+        virtual void WriteTimestamp(uint32_t queryIndex)
+        {
+            (void)queryIndex;
+        }
 
         // ---------------------------------------------------------------------
         // Push Constants (Fast, small data upload)
@@ -199,8 +349,9 @@ namespace Mixture::RHI
          * 
          * @param binding The binding index.
          * @param buffer The buffer to bind.
+         * @param range The bytes of the buffer the binding sees.
          */
-        virtual void SetUniformBuffer(uint32_t binding, IBuffer* buffer, uint32_t set = 0) = 0;
+        virtual void SetUniformBuffer(uint32_t binding, IBuffer* buffer, uint32_t set = 0, const BufferRange& range = {}) = 0;
 
         /**
          * @brief Binds a texture to a specific binding point.
@@ -85,6 +85,84 @@ namespace Mixture::RHI
          */
         virtual Scope<RHI::ICommandList> GetCommandBuffer() = 0;
 
+        /**
+         * @brief Returns whether CreateSecondaryCommandList may be called from worker threads.
+         */
+        virtual bool SupportsParallelRecording() const { return false; }
+
+        /**
+         * @brief Creates a secondary command list for the current frame.
+         *
+         * Lists are allocated from a pool owned by the calling thread and recycled once
+         * the frame slot is reused, so independent threads can record without locking.
+         * The list has to be recorded on the thread that created it and replayed into
+         * the frame's primary list with ICommandList::ExecuteSecondary.
+         *
+         * @return Scope<RHI::ICommandList> The secondary list, or nullptr if unsupported.
+         */
+        virtual Scope<RHI::ICommandList> CreateSecondaryCommandList() { return nullptr; }
+
+        /**
+         * @brief Returns whether compute work can run on a queue that overlaps graphics.
+         */
+        virtual bool SupportsAsyncCompute() const { return false; }
+
+        /**
+         * @brief Creates a command list for an additional submission on @p queue in the current frame.
+         *
+         * The caller begins and ends the list and hands it back through QueueCommandList.
+         *
+         * @return Scope<RHI::ICommandList> The command list, or nullptr if unsupported.
+         */
+        virtual Scope<RHI::ICommandList> CreateQueueCommandList(QueueType queue) { (void)queue; return nullptr; }
+
+        /**
+         * @brief Queues a recorded command list for submission when the frame ends.
+         *
+         * Queued lists are submitted in the order they were queued. Passing nullptr queues
+         * the frame's own list from GetCommandBuffer at this position; otherwise it is
+         * submitted after every queued list.
+         *
+         * @param commandList A list from CreateQueueCommandList, or nullptr for the frame's list.
+         * @param waitFor Indices of earlier queued submissions that must finish before this one starts.
+         * @return uint32_t Index later submissions can wait on.
+         */
+        virtual uint32_t QueueCommandList(Scope<RHI::ICommandList> commandList, std::span<const uint32_t> waitFor)
+        {
+            (void)commandList;
+            (void)waitFor;
+            return 0;
+        }
+
+        /**
+         * @brief Returns the number of timestamp queries every frame slot provides, or 0 if unsupported.
+         */
+        virtual uint32_t GetTimestampQueryCount() const { return 0; }
+
+        /**
+         * @brief Returns the duration of one timestamp tick in nanoseconds.
+         */
+        virtual double GetTimestampPeriod() const { return 0.0; }
+
+        /**
+         * @brief Reads the timestamps of the previous frame recorded into slot @p frameIndex.
+         *
+         * BeginFrame reads them back once it has waited for the slot and before its queries
+         * are reused, so they stay readable until the slot begins again.
+         *
+         * @param frameIndex The frame slot the timestamps were written in.
+         * @param firstQuery Index of the first query to read.
+         * @param timestamps Receives one tick value per query.
+         * @return bool False if any of the queries was not written or timestamps are unsupported.
+         */
+        virtual bool ReadTimestamps(uint32_t frameIndex, uint32_t firstQuery, std::span<uint64_t> timestamps) const
+        {
+            (void)frameIndex;
+            (void)firstQuery;
+            (void)timestamps;
+            return false;
+        }
+
         /**
          * @brief Gets the current width of the swapchain.
          * 
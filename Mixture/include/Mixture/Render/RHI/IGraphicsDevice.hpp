@@ -8,6 +8,7 @@
 #include "Mixture/Core/Base.hpp"
 
 #include "Mixture/Render/RHI/IBuffer.hpp"
+#include "Mixture/Render/RHI/IMemoryHeap.hpp"
 #include "Mixture/Render/RHI/IPipeline.hpp"
 #include "Mixture/Render/RHI/ITexture.hpp"
 
@@ -15,6 +16,8 @@
 #include <span>
 #include <optional>
 #include <limits>
+#include <algorithm>
+#include <bit>
 
 namespace Mixture::RHI
 {
@@ -35,10 +38,13 @@ namespace Mixture::RHI
             && (data.empty() || data.size() == desc.Size);
     }
 
+    /** Initial data fills mip 0 of layer 0; the mip chain has to end at 1x1 at the latest. */
     inline bool IsTextureUploadValid(const TextureDesc& desc, std::span<const std::byte> data)
     {
         const auto requiredSize = GetTextureUploadSize(desc);
-        return requiredSize && (data.empty() || data.size() == *requiredSize);
+        if (!requiredSize || desc.ArrayLayers == 0 || desc.MipLevels == 0) return false;
+        if (desc.MipLevels > static_cast<uint32_t>(std::bit_width(std::max(desc.Width, desc.Height)))) return false;
+        return data.empty() || data.size() == *requiredSize;
     }
 
     /**
@@ -96,6 +102,56 @@ namespace Mixture::RHI
          */
         virtual Ref<IPipeline> CreatePipeline(const PipelineDesc& desc) = 0;
 
+        // ---------------------------------------------------------------------
+        // Memory Aliasing (Optional)
+        // ---------------------------------------------------------------------
+
+        /**
+         * Queries the memory a texture would occupy when placed into a heap.
+         *
+         * @param desc The texture description.
+         * @return The requirements, or std::nullopt if the device cannot place textures.
+         */
+        virtual std::optional<MemoryRequirements> GetMemoryRequirements(const TextureDesc&) const { return std::nullopt; }
+
+        /**
+         * Queries the memory a buffer would occupy when placed into a heap.
+         *
+         * @param desc The buffer description.
+         * @return The requirements, or std::nullopt if the device cannot place buffers.
+         */
+        virtual std::optional<MemoryRequirements> GetMemoryRequirements(const BufferDesc&) const { return std::nullopt; }
+
+        /**
+         * Allocates a memory heap that placed resources can share.
+         *
+         * @param requirements Combined size, alignment, and memory type mask of the heap.
+         * @return A reference to the heap, or nullptr if aliasing is unsupported.
+         */
+        virtual Ref<IMemoryHeap> CreateMemoryHeap(const MemoryRequirements&) { return nullptr; }
+
+        /**
+         * Creates a texture bound to existing heap memory instead of its own allocation.
+         *
+         * The texture keeps the heap alive. Its contents are undefined on first use.
+         *
+         * @param desc The texture description.
+         * @param heap The heap providing the memory.
+         * @param offset Byte offset within the heap; must honor the queried alignment.
+         * @return A reference to the created texture, or nullptr if placement is unsupported.
+         */
+        virtual Ref<ITexture> CreatePlacedTexture(const TextureDesc&, const Ref<IMemoryHeap>&, uint64_t) { return nullptr; }
+
+        /**
+         * Creates a buffer bound to existing heap memory instead of its own allocation.
+         *
+         * @param desc The buffer description.
+         * @param heap The heap providing the memory.
+         * @param offset Byte offset within the heap; must honor the queried alignment.
+         * @return A reference to the created buffer, or nullptr if placement is unsupported.
+         */
+        virtual Ref<IBuffer> CreatePlacedBuffer(const BufferDesc&, const Ref<IMemoryHeap>&, uint64_t) { return nullptr; }
+
         // ---------------------------------------------------------------------
         // Frame Management
         // ---------------------------------------------------------------------
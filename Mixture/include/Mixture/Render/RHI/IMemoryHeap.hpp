@@ -0,0 +1,55 @@
+#pragma once
+
+/**
+ * @file IMemoryHeap.hpp
+ * @brief Interface for device memory blocks shared by placed (aliased) resources.
+ */
+
+#include "Mixture/Core/Base.hpp"
+
+#include <cstdint>
+
+namespace Mixture::RHI
+{
+    /**
+     * @brief Size and placement constraints of a resource bound into a memory heap.
+     */
+    struct MemoryRequirements
+    {
+        /**
+         * @brief Number of bytes the resource occupies.
+         */
+        uint64_t Size = 0;
+
+        /**
+         * @brief Required alignment of the resource offset within a heap.
+         */
+        uint64_t Alignment = 1;
+
+        /**
+         * @brief Backend-specific compatibility mask.
+         *
+         * Resources may only share a heap when their masks intersect.
+         */
+        uint32_t MemoryTypeBits = ~0u;
+    };
+
+    /**
+     * @brief Interface representing a block of device memory that several placed
+     * resources may alias, as long as their lifetimes do not overlap on the GPU.
+     */
+    class IMemoryHeap
+    {
+    public:
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~IMemoryHeap() = default;
+
+        /**
+         * @brief Retrieves the size of the heap.
+         * @return The size in bytes.
+         */
+        virtual uint64_t GetSize() const = 0;
+    };
+}
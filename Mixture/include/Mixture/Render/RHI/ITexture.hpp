@@ -21,7 +21,12 @@ namespace Mixture::RHI
         ColorAttachment = 1u << 2,
         DepthStencilAttachment = 1u << 3,
         TransferSource = 1u << 4,
-        TransferDestination = 1u << 5
+        TransferDestination = 1u << 5,
+        /**
+         * Attachment whose contents never leave a rendering scope. Backends may back it
+         * with lazily allocated (memoryless) memory.
+         */
+        TransientAttachment = 1u << 6
     };
 
     inline TextureUsage operator|(TextureUsage lhs, TextureUsage rhs)
@@ -34,6 +39,27 @@ namespace Mixture::RHI
         return (static_cast<uint32_t>(value) & static_cast<uint32_t>(flag)) != 0;
     }
 
+    /**
+     * @brief A range of mip levels and array layers of a texture.
+     *
+     * Counts of Remaining extend the range to the last mip or layer, so a default
+     * constructed range covers the whole texture whatever its size.
+     */
+    struct TextureSubresourceRange
+    {
+        static constexpr uint32_t Remaining = ~0u;
+
+        uint32_t BaseMip = 0;
+        uint32_t MipCount = Remaining;
+        uint32_t BaseLayer = 0;
+        uint32_t LayerCount = Remaining;
+
+        /** @brief Returns whether the range covers every subresource of any texture. */
+        bool IsWhole() const { return BaseMip == 0 && MipCount == Remaining && BaseLayer == 0 && LayerCount == Remaining; }
+
+        bool operator==(const TextureSubresourceRange&) const = default;
+    };
+
     /**
      * @brief Descriptor structure used to create a texture.
      */
@@ -57,11 +83,20 @@ namespace Mixture::RHI
         RHI::ResourceState InitialState = RHI::ResourceState::Undefined;
         TextureUsage Usage = TextureUsage::Sampled | TextureUsage::TransferDestination;
 
+        /**
+         * @brief Number of mip levels, each half the size of the previous one.
+         */
+        uint32_t MipLevels = 1;
+
+        /**
+         * @brief Number of array layers, e.g. one per shadow cascade.
+         */
+        uint32_t ArrayLayers = 1;
+
         /**
          * @brief Debug name for the texture.
          */
         std::string_view DebugName = "Unnamed Texture";
-        // MipLevels, IsRenderTarget, etc. can be added later
 
         bool operator==(const TextureDesc& other) const
         {
@@ -69,7 +104,9 @@ namespace Mixture::RHI
                    Height == other.Height &&
                    PixelFormat == other.PixelFormat &&
                    InitialState == other.InitialState &&
-                   Usage == other.Usage;
+                   Usage == other.Usage &&
+                   MipLevels == other.MipLevels &&
+                   ArrayLayers == other.ArrayLayers;
         }
     };
 
@@ -79,11 +116,23 @@ namespace Mixture::RHI
     class ITexture
     {
     public:
+        /**
+         * @brief Assigns the instance ID.
+         */
+        ITexture();
+
         /**
          * @brief Virtual destructor.
          */
         virtual ~ITexture() = default;
 
+        /**
+         * @brief Retrieves an ID no other texture created by this process shares,
+         *        even one later allocated at the same address.
+         * @return The instance ID.
+         */
+        uint64_t GetInstanceID() const { return m_InstanceID; }
+
         /**
          * @brief Retrieves the width of the texture.
          * @return The width in pixels.
@@ -102,11 +151,26 @@ namespace Mixture::RHI
          */
         virtual Format GetFormat() const = 0;
 
+        /**
+         * @brief Retrieves the number of mip levels of the texture.
+         * @return The mip level count.
+         */
+        virtual uint32_t GetMipLevels() const { return 1; }
+
+        /**
+         * @brief Retrieves the number of array layers of the texture.
+         * @return The array layer count.
+         */
+        virtual uint32_t GetArrayLayers() const { return 1; }
+
         /**
          * @brief Retrieves the debug name of the texture.
          * @return A C-string representing the debug name.
          */
         virtual std::string_view GetDebugName() const = 0;
+
+    private:
+        uint64_t m_InstanceID;
     };
 
 }
@@ -13,6 +13,7 @@
 
 #include "Mixture/Render/RHI/ITexture.hpp"
 #include "Mixture/Render/RHI/IBuffer.hpp"
+#include "Mixture/Render/RHI/IMemoryHeap.hpp"
 #include "Mixture/Render/RHI/IPipeline.hpp"
 
 #include "Mixture/Render/RHI/IGraphicsContext.hpp"
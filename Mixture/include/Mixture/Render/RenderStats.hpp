@@ -2,11 +2,25 @@
 
 #include "Mixture/Core/Base.hpp"
 
+#include <span>
 #include <string>
 #include <cstdint>
 
 namespace Mixture
 {
+    struct RGPassTiming; // Forward Declaration
+
+    /**
+     * @brief CPU and GPU cost of one render graph pass.
+     */
+    struct RenderPassTiming
+    {
+        std::string Name;
+        float CpuTimeMs = 0.0f;
+        /** Negative if the GPU time is unavailable. */
+        float GpuTimeMs = -1.0f;
+    };
+
     /**
      * @brief Data structure holding real-time rendering statistics.
      */
@@ -16,6 +30,8 @@ namespace Mixture
         uint32_t VertexCount = 0;
         uint32_t TriangleCount = 0;
         uint32_t RenderPassCount = 0;
+        uint32_t BarrierCount = 0;
+        uint32_t BarrierBatchCount = 0;
 
         float FrameTimeMs = 0.0f;
         float FPS = 0.0f;
@@ -23,6 +39,20 @@ namespace Mixture
         float VRAMUsageMB = 0.0f;
         float SystemRAMUsageMB = 0.0f;
 
+        uint64_t TransientMemoryBytes = 0;
+        uint64_t AliasingSavedBytes = 0;
+
+        /** Pooled transient requests of the frame served from the pool, created, and evicted for the budget. */
+        uint32_t TransientPoolHits = 0;
+        uint32_t TransientPoolMisses = 0;
+        uint32_t TransientPoolEvictions = 0;
+        uint64_t TransientPoolBytes = 0;
+
+        /** Per-pass timings of the latest frame whose GPU work completed, in schedule order. */
+        Vector<RenderPassTiming> PassTimings;
+        /** GPU time spanned by the passes of that frame, negative if unavailable. */
+        float GpuFrameTimeMs = -1.0f;
+
         std::string GraphicsAPI = "Vulkan 1.3";
     };
 
@@ -54,6 +84,9 @@ namespace Mixture
         /** Records a render pass execution. */
         void RecordRenderPass();
 
+        /** Records one barrier command covering @p barrierCount transitions. */
+        void RecordBarrierBatch(uint32_t barrierCount);
+
         /** Updates timing and framerate metrics. */
         void UpdateFrameTiming(float frameTimeMs, float fps);
 
@@ -63,6 +96,15 @@ namespace Mixture
         /** Sets current memory utilization metrics. */
         void SetMemoryUsage(float vramMB, float ramMB);
 
+        /** Records the heap and linear buffer memory backing transients and the bytes aliasing saved. */
+        void RecordTransientMemory(uint64_t heapBytes, uint64_t savedBytes);
+
+        /** Records the transient pool counters of the frame and the bytes the pool holds. */
+        void RecordTransientPool(uint32_t hits, uint32_t misses, uint32_t evictions, uint64_t pooledBytes);
+
+        /** Publishes the pass timings of the latest frame the render graph resolved. */
+        void RecordPassTimings(std::span<const RGPassTiming> timings, float gpuFrameTimeMs);
+
         /** Gets current frame statistics data. */
         OPAL_NODISCARD const RenderStatsData& GetStats() const { return m_FrameStats; }
 
@@ -72,9 +114,13 @@ namespace Mixture
         inline void RecordDraw(uint32_t, uint32_t = 1) {}
         inline void RecordDrawIndexed(uint32_t, uint32_t = 1) {}
         inline void RecordRenderPass() {}
+        inline void RecordBarrierBatch(uint32_t) {}
         inline void UpdateFrameTiming(float, float) {}
         inline void SetGraphicsAPI(std::string) {}
         inline void SetMemoryUsage(float, float) {}
+        inline void RecordTransientMemory(uint64_t, uint64_t) {}
+        inline void RecordTransientPool(uint32_t, uint32_t, uint32_t, uint64_t) {}
+        inline void RecordPassTimings(std::span<const RGPassTiming>, float) {}
 
         OPAL_NODISCARD inline RenderStatsData GetStats() const { return {}; }
 #endif
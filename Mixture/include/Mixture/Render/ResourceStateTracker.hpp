@@ -0,0 +1,60 @@
+#pragma once
+
+/**
+ * @file ResourceStateTracker.hpp
+ * @brief Tracks the state physical GPU resources are left in between graph executions.
+ */
+
+#include "Mixture/Core/Base.hpp"
+#include "Mixture/Render/RHI/ResourceStates.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace Mixture
+{
+    namespace RHI
+    {
+        class ITexture; // Forward Declaration
+        class IBuffer; // Forward Declaration
+    }
+
+    /**
+     * @brief Singleton mapping physical textures and buffers to the state recorded work leaves them in.
+     *
+     * The render graph starts imported resources from their tracked state instead of Undefined
+     * and stores their final states after every execution. Entries remember the instance ID of
+     * the resource they were recorded for, so a new resource reusing an address starts out
+     * Undefined; looking one up drops the stale entry. Owners that destroy tracked resources
+     * can drop their entries earlier by setting them to Undefined.
+     */
+    class ResourceStateTracker
+    {
+    public:
+        /** Gets the singleton ResourceStateTracker instance. */
+        static ResourceStateTracker& Get();
+
+        /** @brief Returns the tracked state of a live texture, or Undefined if it was never recorded. */
+        RHI::ResourceState GetState(const RHI::ITexture* texture);
+
+        /** @brief Returns the tracked state of a live buffer, or Undefined if it was never recorded. */
+        RHI::ResourceState GetState(const RHI::IBuffer* buffer);
+
+        /** @brief Records the state a live texture is left in. Undefined drops the entry. */
+        void SetState(const RHI::ITexture* texture, RHI::ResourceState state);
+
+        /** @brief Records the state a live buffer is left in. Undefined drops the entry. */
+        void SetState(const RHI::IBuffer* buffer, RHI::ResourceState state);
+
+    private:
+        struct Entry
+        {
+            uint64_t InstanceID = 0;
+            RHI::ResourceState State = RHI::ResourceState::Undefined;
+        };
+
+        std::mutex m_Mutex;
+        std::unordered_map<const RHI::ITexture*, Entry> m_TextureStates;
+        std::unordered_map<const RHI::IBuffer*, Entry> m_BufferStates;
+    };
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+/**
+ * @file UpscalePass.hpp
+ * @brief Resamples a scaled render target to its output.
+ */
+
+#include "Mixture/Render/Graph/RenderGraphDefinitions.hpp"
+
+namespace Mixture
+{
+    /**
+     * @brief Upscales the rendered region of a scaled resource into the full extent of the output.
+     *
+     * This is the hook between scaled rendering and the backbuffer. The default filters the
+     * source bilinearly; a temporal or spatial upscaler takes its place as any pass that reads
+     * the source and writes the output.
+     */
+    class UpscalePass final : public RenderPass
+    {
+    public:
+        UpscalePass(RGResourceHandle sourceHandle, RGResourceHandle outputHandle)
+            : m_SourceHandle(sourceHandle), m_OutputHandle(outputHandle) {}
+
+        void Setup(RenderGraphBuilder& builder) override;
+        void Execute(const RenderGraphRegistry& registry, RHI::ICommandList* commandList) const override;
+
+    private:
+        RGResourceHandle m_SourceHandle;
+        RGResourceHandle m_OutputHandle;
+        RHI::IPipeline* m_Pipeline = nullptr;
+        /** @brief Extent the source was rendered at, a corner of its allocation. */
+        uint32_t m_SourceWidth = 0;
+        uint32_t m_SourceHeight = 0;
+    };
+}
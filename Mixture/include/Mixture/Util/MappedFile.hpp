@@ -0,0 +1,52 @@
+#pragma once
+
+/**
+ * @file MappedFile.hpp
+ * @brief Read-only memory mapping of a file.
+ */
+
+#include "Mixture/Core/Base.hpp"
+
+#include <cstddef>
+#include <span>
+
+namespace Mixture
+{
+    /**
+     * @brief Maps a whole file read-only into the address space.
+     *
+     * Pages are read by the OS on first access instead of being copied into a heap buffer,
+     * and clean pages can be dropped under memory pressure. The mapping stays valid until
+     * the last reference is released, so assets may point into it instead of copying.
+     *
+     * Only map files that do not change while mapped, such as cooked content: touching pages past
+     * the end of a file truncated in place faults on POSIX, and on Windows the mapping blocks
+     * replacing the file. AssetManager therefore maps files only while hot reload is disabled.
+     */
+    class MappedFile
+    {
+    public:
+        /**
+         * @brief Maps the file at @p path and asks the OS to start reading it ahead.
+         *
+         * @return The mapping, or nullptr if the file cannot be opened, is empty or does not fit the address space.
+         */
+        static Ref<MappedFile> Open(const std::filesystem::path& path);
+
+        ~MappedFile();
+
+        OPAL_NON_COPIABLE(MappedFile);
+
+        std::span<const std::byte> GetData() const { return { static_cast<const std::byte*>(m_Data), m_Size }; }
+        size_t GetSize() const { return m_Size; }
+
+    private:
+        MappedFile(const void* data, size_t size, void* mappingHandle)
+            : m_Data(data), m_Size(size), m_MappingHandle(mappingHandle) {}
+
+        const void* m_Data = nullptr;
+        size_t m_Size = 0;
+        /** @brief File mapping object on Windows, unused elsewhere. */
+        void* m_MappingHandle = nullptr;
+    };
+}
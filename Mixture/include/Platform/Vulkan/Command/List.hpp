@@ -12,12 +12,28 @@
 namespace Mixture::Vulkan
 {
     class Pipeline;
+
+    /** How a CommandList relates to the frame's submission. */
+    enum class CommandListKind : uint8_t
+    {
+        /** Owns the frame's transfer work. */
+        Frame,
+        /** Replayed inside another list through ExecuteSecondary. */
+        Secondary,
+        /** Submitted on its own to FrameCommandContext::Queue before or after the frame list. */
+        Queue,
+    };
+
     struct FrameCommandContext
     {
         vk::CommandBuffer graphicsCommandBuffer;
         vk::CommandBuffer transferCommandBuffer;
         vk::CommandBuffer computeCommandBuffer;
         FrameQueueActivity* Activity = nullptr;
+        /** Lists other than the frame list only record into graphicsCommandBuffer and leave the frame's transfer work to it. */
+        CommandListKind Kind = CommandListKind::Frame;
+        /** Queue graphicsCommandBuffer is submitted to; barriers drop stages that queue cannot execute. */
+        RHI::QueueType Queue = RHI::QueueType::Graphics;
     };
     /**
      * @brief Vulkan implementation of the CommandList.
@@ -30,11 +46,13 @@ namespace Mixture::Vulkan
         /**
          * @brief Constructs a Vulkan CommandList.
          * 
+         * Swapchain transitions are not recorded here; the render graph transitions the
+         * imported backbuffer like any other resource.
+         *
          * @param commandContext The context containing the Vulkan command buffers.
-         * @param swapchainImage The swapchain image for the current frame.
          */
-        CommandList(const FrameCommandContext& commandContext, vk::Image swapchainImage)
-            : m_CommandContext(commandContext), m_SwapchainImage(swapchainImage) {}
+        explicit CommandList(const FrameCommandContext& commandContext)
+            : m_CommandContext(commandContext) {}
         ~CommandList() = default;
 
         void Begin() override;
@@ -42,18 +60,27 @@ namespace Mixture::Vulkan
 
         void BeginRendering(const RHI::RenderingInfo& info) override;
         void EndRendering() override;
+        void ExecuteSecondary(std::span<RHI::ICommandList* const> commandLists) override;
 
         void SetViewport(float x, float y, float width, float height, float minDepth = 0.0f, float maxDepth = 1.0f) override;
         void SetScissor(int32_t x, int32_t y, uint32_t width, uint32_t height) override;
 
         void BindPipeline(RHI::IPipeline* pipeline) override;
-        void BindVertexBuffer(RHI::IBuffer* buffer, uint32_t binding = 0) override;
-        void BindIndexBuffer(RHI::IBuffer* buffer) override;
+        void BindVertexBuffer(RHI::IBuffer* buffer, uint32_t binding = 0, uint64_t offset = 0) override;
+        void BindIndexBuffer(RHI::IBuffer* buffer, uint64_t offset = 0) override;
 
-        void PipelineBarrier(RHI::ITexture* texture, RHI::ResourceState oldState, RHI::ResourceState newState) override;
-        void PipelineBarrier(RHI::IBuffer* buffer, RHI::ResourceState oldState, RHI::ResourceState newState) override;
+        void PipelineBarrier(RHI::ITexture* texture, RHI::ResourceState oldState, RHI::ResourceState newState,
+            RHI::QueueType sourceQueue = RHI::QueueType::Graphics, RHI::QueueType destinationQueue = RHI::QueueType::Graphics,
+            const RHI::TextureSubresourceRange& subresources = {}) override;
+        void PipelineBarrier(RHI::IBuffer* buffer, RHI::ResourceState oldState, RHI::ResourceState newState,
+            RHI::QueueType sourceQueue = RHI::QueueType::Graphics, RHI::QueueType destinationQueue = RHI::QueueType::Graphics,
+            const RHI::BufferRange& range = {}) override;
+        void PipelineBarriers(std::span<const RHI::ResourceBarrier> barriers) override;
+        void BeginSplitBarriers(uint32_t splitIndex, std::span<const RHI::ResourceBarrier> barriers) override;
+        void EndSplitBarriers(uint32_t splitIndex, std::span<const RHI::ResourceBarrier> barriers) override;
+        void WriteTimestamp(uint32_t queryIndex) override;
         void PushConstants(RHI::IPipeline* pipeline, RHI::ShaderStage stage, const void* data, uint32_t size) override;
-        void SetUniformBuffer(uint32_t binding, RHI::IBuffer* buffer, uint32_t set = 0) override;
+        void SetUniformBuffer(uint32_t binding, RHI::IBuffer* buffer, uint32_t set = 0, const RHI::BufferRange& range = {}) override;
         void SetTexture(uint32_t binding, RHI::ITexture* texture, uint32_t set = 0) override;
 
         void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) override;
@@ -62,6 +89,7 @@ namespace Mixture::Vulkan
         void MarkTransferWork() { if (m_CommandContext.Activity) m_CommandContext.Activity->Transfer = true; }
         void MarkComputeWork() { if (m_CommandContext.Activity) m_CommandContext.Activity->Compute = true; }
         vk::CommandBuffer GetGraphicsCommandBuffer() const { return m_CommandContext.graphicsCommandBuffer; }
+        RHI::QueueType GetQueue() const { return m_CommandContext.Queue; }
 
     private:
         void FlushDescriptors(); // The magic function
@@ -71,12 +99,12 @@ namespace Mixture::Vulkan
         struct BindingState
         {
             RHI::IBuffer* Buffer;
+            RHI::BufferRange Range;
             RHI::ITexture* Texture;
             vk::DescriptorType Type;
         };
 
         FrameCommandContext m_CommandContext;
-        vk::Image m_SwapchainImage;
         vk::PipelineLayout m_CurrentPipelineLayout;
         Pipeline* m_CurrentPipeline = nullptr;
 
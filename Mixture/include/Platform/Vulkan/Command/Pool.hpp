@@ -33,6 +33,11 @@ namespace Mixture::Vulkan
          * @return vk::CommandPool The command pool handle.
          */
         vk::CommandPool GetHandle() const { return m_Handle; }
+
+        /**
+         * @brief Returns every command buffer allocated from the pool to the initial state.
+         */
+        void Reset();
     private:
         Device* m_Device;
         vk::CommandPool m_Handle;
@@ -14,6 +14,9 @@
 #include <optional>
 #include <array>
 #include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace Mixture::Vulkan
 {
@@ -40,6 +43,10 @@ namespace Mixture::Vulkan
      * @brief Vulkan implementation of the Graphics Context.
      *
      * Manages the Vulkan instance, physical device, and logical device.
+     *
+     * A headless context (ApplicationDescription::Headless) creates no surface and no
+     * swapchain. Each frame slot renders into its own offscreen backbuffer instead, so the
+     * context runs without a display, e.g. on a software ICD such as lavapipe.
      */
     class Context : public RHI::IGraphicsContext
     {
@@ -48,6 +55,7 @@ namespace Mixture::Vulkan
          * @brief Constructor.
          *
          * @param appDescription Description of the application.
+         * @param windowHandle The GLFW window to present to; ignored by headless contexts.
          */
         Context(const ApplicationDescription& appDescription, void* windowHandle);
         ~Context();
@@ -88,6 +96,51 @@ namespace Mixture::Vulkan
          */
         Scope<RHI::ICommandList> GetCommandBuffer() override;
 
+        bool SupportsParallelRecording() const override { return true; }
+
+        /**
+         * @brief Creates a secondary command list from the calling thread's pool for this frame slot.
+         *
+         * @return Scope<RHI::ICommandList> The secondary command list.
+         */
+        Scope<RHI::ICommandList> CreateSecondaryCommandList() override;
+
+        /**
+         * @brief Returns whether the compute queue belongs to a different family than the graphics queue.
+         */
+        bool SupportsAsyncCompute() const override;
+
+        /**
+         * @brief Creates a primary command list for @p queue from this frame slot's pool.
+         *
+         * @return Scope<RHI::ICommandList> The command list.
+         */
+        Scope<RHI::ICommandList> CreateQueueCommandList(RHI::QueueType queue) override;
+
+        /**
+         * @brief Queues a recorded list for EndFrame. Every wait is a binary semaphore between the two submissions.
+         *
+         * @return uint32_t Index later submissions can wait on.
+         */
+        uint32_t QueueCommandList(Scope<RHI::ICommandList> commandList, std::span<const uint32_t> waitFor) override;
+
+        /** Returns the family of the queue that executes work submitted to @p queue. */
+        uint32_t GetQueueFamilyIndex(RHI::QueueType queue) const;
+
+        /** Returns the event backing split barrier @p splitIndex in the current frame slot. */
+        vk::Event GetSplitBarrierEvent(uint32_t splitIndex);
+
+        /** Returns the query count of every slot's pool, or 0 without host query reset or timestamps on all queues. */
+        uint32_t GetTimestampQueryCount() const override;
+        double GetTimestampPeriod() const override { return m_TimestampPeriod; }
+        bool ReadTimestamps(uint32_t frameIndex, uint32_t firstQuery, std::span<uint64_t> timestamps) const override;
+
+        /** Returns the timestamp query pool of the current frame slot, or a null handle if timestamps are unsupported. */
+        vk::QueryPool GetTimestampQueryPool() const { return m_TimestampQueryPools[m_CurrentFrame]; }
+
+        /** @brief Returns whether frames render into offscreen backbuffers instead of a swapchain. */
+        bool IsHeadless() const { return m_Headless; }
+
         /**
          * @brief Gets the swapchain width.
          * 
@@ -110,7 +163,7 @@ namespace Mixture::Vulkan
         Instance& GetInstance() const { return *m_Instance; }
 
         /**
-         * @brief Gets the Vulkan Window Surface.
+         * @brief Gets the Vulkan Window Surface. Must not be called on headless contexts.
          *
          * @return Ref<Surface> Reference to the window surface wrapper.
          */
@@ -131,7 +184,7 @@ namespace Mixture::Vulkan
         Device& GetLogicalDevice() const { return *m_Device; }
 
         /**
-         * @brief Gets the Vulkan swapchain.
+         * @brief Gets the Vulkan swapchain. Must not be called on headless contexts.
          *
          * @return Ref<Swapchain> Reference to the swapchain wrapper.
          */
@@ -170,6 +223,9 @@ namespace Mixture::Vulkan
         DescriptorAllocator* GetCurrentDescriptorAllocator() const;
         DescriptorLayoutCache* GetDescriptorLayoutCache() const;
 
+        /** Serializes descriptor allocation from command lists recorded on different threads. */
+        std::mutex& GetDescriptorMutex() { return m_DescriptorMutex; }
+
         /** Queues a transfer copy for the active frame, or the next frame if none is recording. */
         void EnqueueTransferUpload(std::function<void(vk::CommandBuffer)> record, std::function<void()> cleanup);
         void BeginTransferUploads(vk::CommandBuffer commandBuffer);
@@ -184,12 +240,17 @@ namespace Mixture::Vulkan
     private:
         bool RecreateSwapchain(uint32_t width, uint32_t height);
         bool RecreateSwapchainFromWindow();
+        void CreateOffscreenBackbuffers(uint32_t width, uint32_t height);
+        void SubmitQueuedCommandLists(const FrameSubmissionPlan& plan);
 
         Ref<Instance> m_Instance;
         Scope<Surface> m_Surface;
         Ref<PhysicalDevice> m_PhysicalDevice;
         Ref<Device> m_Device;
         Scope<Swapchain> m_Swapchain;
+        bool m_Headless = false;
+        /** Backbuffers of a headless context, one per frame slot. */
+        std::array<Ref<RHI::ITexture>, 2> m_OffscreenBackbuffers;
 
         Scope<Queue> m_GraphicsQueue;
         Scope<Queue> m_TransferQueue;
@@ -200,7 +261,10 @@ namespace Mixture::Vulkan
         Scope<Semaphores> m_RenderFinishedSemaphores;
         Scope<Semaphores> m_TransferFinishedSemaphores;
         Scope<Semaphores> m_ComputeFinishedSemaphores;
+        Scope<Semaphores> m_TransferToComputeSemaphores;
         Scope<Fences> m_InFlightFences;
+        /** Signaled by the last async compute submission, which the in-flight fence does not cover. */
+        Scope<Fences> m_AsyncComputeFences;
 
         Scope<DescriptorAllocators> m_DescriptorAllocators;
         Scope<DescriptorLayoutCache> m_DescriptorLayoutCache;
@@ -217,5 +281,41 @@ namespace Mixture::Vulkan
         Vector<PendingTransferUpload> m_PendingTransferUploads;
         std::array<Vector<std::function<void()>>, 2> m_TransferCleanups;
         vk::CommandBuffer m_ActiveTransferCommandBuffer;
+
+        std::mutex m_DescriptorMutex;
+
+        /** Command pool and the buffers recycled from it whenever its frame slot begins. */
+        struct RecycledCommandPool
+        {
+            Scope<CommandPool> Pool;
+            Vector<vk::CommandBuffer> Buffers;
+            uint32_t NextBuffer = 0;
+        };
+        /** Secondary list pools of every recording thread, per frame slot. */
+        std::array<std::unordered_map<std::thread::id, RecycledCommandPool>, 2> m_ThreadCommandPools;
+        std::mutex m_ThreadCommandPoolMutex;
+
+        struct QueuedCommandList
+        {
+            RHI::QueueType Queue = RHI::QueueType::Graphics;
+            /** Null for the frame list from GetCommandBuffer. */
+            vk::CommandBuffer CommandBuffer;
+            Vector<uint32_t> WaitFor;
+        };
+        Vector<QueuedCommandList> m_QueuedCommandLists;
+        /** Pools of CreateQueueCommandList, indexed by frame slot and RHI::QueueType. */
+        std::array<std::array<RecycledCommandPool, 2>, 2> m_QueueCommandPools;
+        std::array<Scope<Semaphores>, 2> m_QueueWaitSemaphores;
+
+        /** Split barrier events per frame slot, reset on the host once the slot's fences signaled. */
+        std::array<Vector<vk::Event>, 2> m_SplitBarrierEvents;
+        std::array<uint32_t, 2> m_UsedSplitBarrierEvents{};
+        std::mutex m_SplitBarrierEventMutex;
+
+        /** Timestamp queries per frame slot, reset on the host once the slot's fences signaled. */
+        std::array<vk::QueryPool, 2> m_TimestampQueryPools{};
+        /** Value and availability of every query of a slot, read back right before its reset. */
+        std::array<Vector<uint64_t>, 2> m_TimestampReadback;
+        double m_TimestampPeriod = 0.0;
     };
 }
@@ -47,6 +47,9 @@ namespace Mixture::Vulkan
         /** @brief Gets the physical device retained by this logical device. */
         PhysicalDevice& GetPhysicalDevice() const { return *m_PhysicalDevice; }
 
+        /** @brief Returns whether query pools can be reset from the host, which GPU timestamps rely on. */
+        bool SupportsHostQueryReset() const { return m_HostQueryReset; }
+
         /** Submits recorded work on the render thread. */
         void Submit(vk::Queue queue, const vk::SubmitInfo& submitInfo, vk::Fence fence = {});
 
@@ -90,6 +93,52 @@ namespace Mixture::Vulkan
          */
         Ref<RHI::IPipeline> CreatePipeline(const RHI::PipelineDesc& desc) override;
 
+        /**
+         * @brief Queries the memory requirements of a texture without creating it.
+         * 
+         * @param desc The texture description.
+         * @return std::optional<RHI::MemoryRequirements> The requirements, or std::nullopt for invalid descriptions.
+         */
+        std::optional<RHI::MemoryRequirements> GetMemoryRequirements(const RHI::TextureDesc& desc) const override;
+
+        /**
+         * @brief Queries the memory requirements of a buffer without creating it.
+         * 
+         * @param desc The buffer description.
+         * @return std::optional<RHI::MemoryRequirements> The requirements, or std::nullopt for invalid descriptions.
+         */
+        std::optional<RHI::MemoryRequirements> GetMemoryRequirements(const RHI::BufferDesc& desc) const override;
+
+        /**
+         * @brief Allocates a VMA heap that placed resources alias.
+         * 
+         * @param requirements Combined size, alignment, and memory type mask.
+         * @return Ref<RHI::IMemoryHeap> The created heap.
+         */
+        Ref<RHI::IMemoryHeap> CreateMemoryHeap(const RHI::MemoryRequirements& requirements) override;
+
+        /**
+         * @brief Creates a Vulkan texture bound into an aliasing heap.
+         * 
+         * @param desc The texture description.
+         * @param heap The heap providing the memory.
+         * @param offset Byte offset within the heap.
+         * @return Ref<RHI::ITexture> The created texture.
+         */
+        Ref<RHI::ITexture> CreatePlacedTexture(const RHI::TextureDesc& desc,
+            const Ref<RHI::IMemoryHeap>& heap, uint64_t offset) override;
+
+        /**
+         * @brief Creates a Vulkan buffer bound into an aliasing heap.
+         * 
+         * @param desc The buffer description.
+         * @param heap The heap providing the memory.
+         * @param offset Byte offset within the heap.
+         * @return Ref<RHI::IBuffer> The created buffer.
+         */
+        Ref<RHI::IBuffer> CreatePlacedBuffer(const RHI::BufferDesc& desc,
+            const Ref<RHI::IMemoryHeap>& heap, uint64_t offset) override;
+
 		void WaitForIdle() override { m_Device.waitIdle(); }
 
 	private:
@@ -98,5 +147,6 @@ namespace Mixture::Vulkan
         vk::Device m_Device = nullptr;
 
         VmaAllocator m_Allocator = nullptr;
+        bool m_HostQueryReset = false;
 	};
 }
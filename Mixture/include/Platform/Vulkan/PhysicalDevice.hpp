@@ -58,8 +58,15 @@ namespace Mixture::Vulkan
          */
         std::string_view GetDeviceName() const;
 
+        /**
+         * @brief Returns whether the device was selected to present to the context's surface.
+         *
+         * False for headless contexts, whose devices need neither a present queue nor VK_KHR_swapchain.
+         */
+        bool RequiresSwapchain() const { return m_RequiresSwapchain; }
+
         /** @brief Testable validation for mandatory logical-device capabilities. */
-        static bool HasRequiredExtensions(const Vector<vk::ExtensionProperties>& extensions);
+        static bool HasRequiredExtensions(const Vector<vk::ExtensionProperties>& extensions, bool requiresSwapchain = true);
         static bool HasRequiredFeatures(bool samplerAnisotropy, bool dynamicRendering, bool bufferDeviceAddress);
         static bool HasUsableSurface(const Vector<vk::SurfaceFormatKHR>& formats,
             const Vector<vk::PresentModeKHR>& presentModes);
@@ -73,5 +80,6 @@ namespace Mixture::Vulkan
         vk::PhysicalDevice m_PhysicalDevice;
         vk::PhysicalDeviceProperties m_Properties;
         QueueFamilyIndices m_Indices;
+        bool m_RequiresSwapchain = true;
     };
 }
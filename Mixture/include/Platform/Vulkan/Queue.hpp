@@ -70,6 +70,19 @@ namespace Mixture::Vulkan
                     Vector<vk::Semaphore> waitSemaphores = {}, Vector<vk::PipelineStageFlags> waitStages = {},
                     vk::Fence fence = {});
 
+        /**
+         * @brief Submits a command buffer that was not allocated from this queue's frame buffers.
+         * 
+         * @param commandBuffer The command buffer to execute.
+         * @param signalSemaphores Semaphores to signal when execution completes.
+         * @param waitSemaphores Semaphores to wait on before execution begins.
+         * @param waitStages Pipeline stages to wait at.
+         * @param fence Fence to signal when execution completes.
+         */
+        void Submit(vk::CommandBuffer commandBuffer, Vector<vk::Semaphore> signalSemaphores,
+                    Vector<vk::Semaphore> waitSemaphores = {}, Vector<vk::PipelineStageFlags> waitStages = {},
+                    vk::Fence fence = {});
+
     private:
         Device* m_Device;
         vk::Queue m_Handle;
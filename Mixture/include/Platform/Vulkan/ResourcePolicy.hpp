@@ -49,6 +49,31 @@ namespace Mixture::Vulkan
         }
     }
 
+    /**
+     * Drops the stages and accesses a compute-only queue cannot execute. An emptied
+     * source scope becomes top of pipe and an emptied destination scope bottom of pipe.
+     */
+    inline ResourceStateMapping RestrictToComputeQueue(ResourceStateMapping mapping, bool isSource)
+    {
+        const vk::PipelineStageFlags computeStages = vk::PipelineStageFlagBits::eTopOfPipe | vk::PipelineStageFlagBits::eBottomOfPipe |
+            vk::PipelineStageFlagBits::eDrawIndirect | vk::PipelineStageFlagBits::eComputeShader |
+            vk::PipelineStageFlagBits::eTransfer | vk::PipelineStageFlagBits::eHost | vk::PipelineStageFlagBits::eAllCommands;
+        const vk::AccessFlags computeAccess = vk::AccessFlagBits::eIndirectCommandRead | vk::AccessFlagBits::eUniformRead |
+            vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite |
+            vk::AccessFlagBits::eTransferRead | vk::AccessFlagBits::eTransferWrite |
+            vk::AccessFlagBits::eHostRead | vk::AccessFlagBits::eHostWrite |
+            vk::AccessFlagBits::eMemoryRead | vk::AccessFlagBits::eMemoryWrite;
+
+        mapping.Stages &= computeStages;
+        mapping.Access &= computeAccess;
+        if (!mapping.Stages)
+        {
+            mapping.Stages = isSource ? vk::PipelineStageFlagBits::eTopOfPipe : vk::PipelineStageFlagBits::eBottomOfPipe;
+            mapping.Access = {};
+        }
+        return mapping;
+    }
+
     inline vk::ImageAspectFlags GetImageAspect(RHI::Format format)
     {
         if (format == RHI::Format::D24_UNORM_S8_UINT || format == RHI::Format::D32_FLOAT_S8_UINT)
@@ -66,6 +91,7 @@ namespace Mixture::Vulkan
         if (RHI::HasUsage(usage, RHI::TextureUsage::DepthStencilAttachment)) result |= vk::ImageUsageFlagBits::eDepthStencilAttachment;
         if (RHI::HasUsage(usage, RHI::TextureUsage::TransferSource)) result |= vk::ImageUsageFlagBits::eTransferSrc;
         if (RHI::HasUsage(usage, RHI::TextureUsage::TransferDestination)) result |= vk::ImageUsageFlagBits::eTransferDst;
+        if (RHI::HasUsage(usage, RHI::TextureUsage::TransientAttachment)) result |= vk::ImageUsageFlagBits::eTransientAttachment;
         return result;
     }
 }
@@ -23,6 +23,37 @@ namespace Mixture::Vulkan::AllocationPolicy
         return info;
     }
 
+    /**
+     * @brief Selects device-local memory for a heap that placed resources alias.
+     *
+     * vmaAllocateMemory has no resource to infer the usage from, so the memory
+     * properties are requested explicitly. Heaps are long-lived and sized for a
+     * whole frame, so they get a dedicated allocation.
+     */
+    inline VmaAllocationCreateInfo AliasingHeap()
+    {
+        VmaAllocationCreateInfo info = {};
+        info.usage = VMA_MEMORY_USAGE_UNKNOWN;
+        info.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        info.flags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
+        return info;
+    }
+
+    /**
+     * @brief Prefers lazily allocated memory for transient attachments.
+     *
+     * Tile-based GPUs then never commit physical memory for attachments that live
+     * only inside a rendering scope. Where no such memory type exists the image
+     * falls back to ordinary device-local memory.
+     */
+    inline VmaAllocationCreateInfo TransientAttachment()
+    {
+        VmaAllocationCreateInfo info = {};
+        info.usage = VMA_MEMORY_USAGE_AUTO;
+        info.preferredFlags = VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+        return info;
+    }
+
     /** @brief Selects host-visible sequential-write memory for upload buffers. */
     inline VmaAllocationCreateInfo Upload(bool persistentlyMapped = false)
     {
@@ -14,6 +14,7 @@
 namespace Mixture::Vulkan
 {
     class Device;
+    class MemoryHeap;
 
     /**
      * @brief Vulkan implementation of a GPU buffer.
@@ -31,6 +32,16 @@ namespace Mixture::Vulkan
          * @param initialData Optional pointer to data to upload on creation.
          */
         Buffer(Ref<Device> device, const RHI::BufferDesc& desc, std::span<const std::byte> initialData = {});
+
+        /**
+         * @brief Constructs a Vulkan Buffer bound into a shared aliasing heap.
+         * 
+         * @param device Shared ownership of the creating device.
+         * @param desc The buffer description.
+         * @param heap The heap providing the memory; kept alive by the buffer.
+         * @param offset Byte offset of the buffer within the heap.
+         */
+        Buffer(Ref<Device> device, const RHI::BufferDesc& desc, Ref<MemoryHeap> heap, uint64_t offset);
         virtual ~Buffer();
 
         // IBuffer Interface
@@ -44,10 +55,22 @@ namespace Mixture::Vulkan
          */
         vk::Buffer GetHandle() const { return m_Buffer; }
 
+        /** @brief Returns whether the buffer memory is shared with other placed resources. */
+        bool IsAliased() const { return m_Heap != nullptr; }
+
+        /**
+         * @brief Builds the buffer create info used for a buffer description.
+         * 
+         * @param desc The buffer description.
+         * @return vk::BufferCreateInfo The matching exclusive buffer create info.
+         */
+        static vk::BufferCreateInfo GetBufferCreateInfo(const RHI::BufferDesc& desc);
+
     private:
         Ref<Device> m_Device;
         RHI::BufferDesc m_Desc;
         vk::Buffer m_Buffer = nullptr;
         VmaAllocation m_Allocation = nullptr;
+        Ref<MemoryHeap> m_Heap;
     };
 }
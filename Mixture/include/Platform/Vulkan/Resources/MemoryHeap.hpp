@@ -0,0 +1,51 @@
+#pragma once
+
+/**
+ * @file MemoryHeap.hpp
+ * @brief Vulkan implementation of the MemoryHeap interface.
+ */
+
+#include "Mixture/Core/Base.hpp"
+#include "Mixture/Render/RHI/IMemoryHeap.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vma/vk_mem_alloc.h>
+
+namespace Mixture::Vulkan
+{
+    class Device;
+
+    /**
+     * @brief VMA allocation that placed textures and buffers are bound into.
+     *
+     * Resources bound at overlapping offsets alias each other; the render graph only
+     * does so for transients whose pass intervals are disjoint.
+     */
+    class MemoryHeap : public RHI::IMemoryHeap
+    {
+    public:
+        /**
+         * @brief Allocates device-local memory satisfying the combined requirements.
+         *
+         * @param device Shared ownership of the creating device.
+         * @param requirements Size, alignment, and memory type mask of the heap.
+         */
+        MemoryHeap(Ref<Device> device, const RHI::MemoryRequirements& requirements);
+        virtual ~MemoryHeap();
+
+        // IMemoryHeap Interface
+        uint64_t GetSize() const override { return m_Size; }
+
+        /**
+         * @brief Gets the VMA allocation backing the heap.
+         *
+         * @return VmaAllocation The allocation handle.
+         */
+        VmaAllocation GetAllocation() const { return m_Allocation; }
+
+    private:
+        Ref<Device> m_Device;
+        uint64_t m_Size = 0;
+        VmaAllocation m_Allocation = nullptr;
+    };
+}
@@ -14,6 +14,7 @@
 namespace Mixture::Vulkan
 {
     class Device;
+    class MemoryHeap;
 
     /**
      * @brief Vulkan implementation of a GPU texture.
@@ -32,6 +33,16 @@ namespace Mixture::Vulkan
          */
         Texture(Ref<Device> device, const RHI::TextureDesc& spec, std::span<const std::byte> data = {});
 
+        /**
+         * @brief Constructs a Placed Texture bound into a shared aliasing heap.
+         *
+         * @param device Shared ownership of the creating device.
+         * @param spec The texture description.
+         * @param heap The heap providing the memory; kept alive by the texture.
+         * @param offset Byte offset of the image within the heap.
+         */
+        Texture(Ref<Device> device, const RHI::TextureDesc& spec, Ref<MemoryHeap> heap, uint64_t offset);
+
         /**
          * @brief Constructs a wrapper around an existing Vulkan Image (e.g., Swapchain Image).
          * 
@@ -51,6 +62,8 @@ namespace Mixture::Vulkan
         uint32_t GetWidth() const override { return m_Width; }
         uint32_t GetHeight() const override { return m_Height; }
         RHI::Format GetFormat() const override { return m_Format; }
+        uint32_t GetMipLevels() const override { return m_MipLevels; }
+        uint32_t GetArrayLayers() const override { return m_ArrayLayers; }
         std::string_view GetDebugName() const override { return m_DebugName; }
 
         /**
@@ -67,6 +80,15 @@ namespace Mixture::Vulkan
          */
         vk::ImageView GetImageView() const { return m_ImageView; }
 
+        /**
+         * @brief Gets a view of a single mip level and array layer to render to.
+         *
+         * @param mipLevel The mip level.
+         * @param arrayLayer The array layer.
+         * @return vk::ImageView The view, or the full view if the texture has only one subresource.
+         */
+        vk::ImageView GetAttachmentView(uint32_t mipLevel, uint32_t arrayLayer) const;
+
         /**
          * @brief Creates a descriptor image info structure for this texture.
          * 
@@ -79,6 +101,17 @@ namespace Mixture::Vulkan
          */
         void Invalidate();
 
+        /** @brief Returns whether the image memory is shared with other placed resources. */
+        bool IsAliased() const { return m_Heap != nullptr; }
+
+        /**
+         * @brief Builds the image create info used for a texture description.
+         *
+         * @param spec The texture description.
+         * @return VkImageCreateInfo The matching 2D image create info.
+         */
+        static VkImageCreateInfo GetImageCreateInfo(const RHI::TextureDesc& spec);
+
     private:
         void Release(); // Helper to clean up
 
@@ -86,6 +119,8 @@ namespace Mixture::Vulkan
         Ref<Device> m_Device;
         uint32_t m_Width = 0;
         uint32_t m_Height = 0;
+        uint32_t m_MipLevels = 1;
+        uint32_t m_ArrayLayers = 1;
         RHI::Format m_Format;
         RHI::TextureUsage m_Usage = RHI::TextureUsage::None;
         std::string_view m_DebugName;
@@ -93,10 +128,14 @@ namespace Mixture::Vulkan
         // Vulkan Handles
         vk::Image m_Image = nullptr;
         vk::ImageView m_ImageView = nullptr;
+        /** @brief One view per mip and layer, indexed by mip * m_ArrayLayers + layer. Only for attachments with several subresources. */
+        Vector<vk::ImageView> m_AttachmentViews;
         vk::Sampler m_Sampler = nullptr; // Optional: Standard textures usually have a sampler
 
         // Memory Management
         VmaAllocation m_Allocation = nullptr;
+        Ref<MemoryHeap> m_Heap; // Set for placed textures, which bind into m_Heap instead of m_Allocation
+        uint64_t m_HeapOffset = 0;
         bool m_OwnsImage = false; // <--- The Critical Flag
     };
 
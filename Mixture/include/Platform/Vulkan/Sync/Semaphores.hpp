@@ -34,6 +34,11 @@ namespace Mixture::Vulkan
          * @return vk::Semaphore The semaphore handle.
          */
         vk::Semaphore Get(uint32_t index) const { return m_Handles[index]; }
+
+        /**
+         * @brief Gets the number of semaphores in the collection.
+         */
+        uint32_t GetCount() const { return static_cast<uint32_t>(m_Handles.size()); }
     private:
         Device* m_Device;
         Vector<vk::Semaphore> m_Handles;
@@ -1,11 +1,14 @@
 #include "mxpch.hpp"
 #include "Mixture/Assets/AssetManager.hpp"
+#include "Mixture/Core/Profiler.hpp"
 #include "Mixture/Assets/AssetSerializer.hpp"
 #include "Mixture/Assets/AssetRegistry.hpp"
+#include "Mixture/Core/Threading/TaskSystem.hpp"
 
 #include "Mixture/Assets/Shaders/ShaderSerializer.hpp"
 #include "Mixture/Assets/Textures/TextureSerializer.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <limits>
 
@@ -46,40 +49,47 @@ namespace Mixture
                     {
                         std::unique_lock<std::mutex> lock(m_QueueMutex);
 
-                        m_QueueCV.wait(lock, [this] {
-                            return !m_LoadQueue.empty() || !m_Running;
-                        });
+                        // Reads stop running ahead once enough loads wait for decoding. A reload
+                        // of an asset that is still decoding waits for that load to finish.
+                        std::deque<LoadRequest>* queue = nullptr;
+                        std::deque<LoadRequest>::iterator next;
+                        const auto findNext = [&]
+                        {
+                            if (m_InFlightLoads.size() >= MaxInFlightLoads) return false;
+                            for (auto level = m_LoadQueues.rbegin(); level != m_LoadQueues.rend(); ++level)
+                            {
+                                next = std::find_if(level->begin(), level->end(),
+                                    [this](const LoadRequest& candidate) { return !m_InFlightLoads.contains(candidate.ID); });
+                                if (next == level->end()) continue;
+
+                                queue = &*level;
+                                return true;
+                            }
+                            return false;
+                        };
+                        m_QueueCV.wait(lock, [&] { return !m_Running || findNext(); });
 
                         if (!m_Running)
                             return;
 
-                        if (m_LoadQueue.empty())
-                            continue;
-
-                        request = m_LoadQueue.front();
-                        m_LoadQueue.pop();
-                        m_ActiveLoadID = request.ID;
-                        m_ActiveLoadCancellable = true;
+                        request = std::move(*next);
+                        queue->erase(next);
+                        m_InFlightLoads[request.ID] = true;
                     }
 
                     try
                     {
-                        this->LoadAssetInternal(request.Type, request.Path, request.ID, request.Magic);
+                        this->ReadAsset(request);
                     }
                     catch (const std::exception& e)
                     {
                         OPAL_ERROR("AssetManager", "Asset Load Dispatch Exception: {}", e.what());
 
-                        std::lock_guard<std::mutex> lock(m_CacheMutex);
-                        m_LoadingAssets.erase(request.ID);
-                    }
-
-                    {
-                        std::lock_guard<std::mutex> lock(m_QueueMutex);
-                        m_ActiveLoadID = UUID::Invalid();
-                        m_ActiveLoadCancellable = false;
-                        m_CancelledLoads.erase(request.ID);
-                        if (m_LoadQueue.empty()) m_IdleCV.notify_all();
+                        {
+                            std::lock_guard<std::mutex> lock(m_CacheMutex);
+                            m_LoadingAssets.erase(request.ID);
+                        }
+                        FinishLoad(request.ID);
                     }
                 }
             });
@@ -117,12 +127,11 @@ namespace Mixture
         }
 
         {
-            std::lock_guard<std::mutex> lock(m_QueueMutex);
-            std::queue<LoadRequest> emptyQueue;
-            m_LoadQueue.swap(emptyQueue);
+            // Decoding jobs see that the manager stopped and discard their results.
+            std::unique_lock<std::mutex> lock(m_QueueMutex);
+            m_IdleCV.wait(lock, [this] { return m_InFlightLoads.empty(); });
+            for (auto& queue : m_LoadQueues) queue.clear();
             m_CancelledLoads.clear();
-            m_ActiveLoadID = UUID::Invalid();
-            m_ActiveLoadCancellable = false;
             m_IdleCV.notify_all();
         }
         {
@@ -140,6 +149,7 @@ namespace Mixture
         m_RootDirectory.clear();
         m_AssetFileResolver.reset();
         m_GraphicsAPI = RHI::GraphicsAPI::None;
+        m_HotReloadEnabled = true;
         m_Initialized = false;
     }
 
@@ -148,7 +158,8 @@ namespace Mixture
         std::unique_lock<std::mutex> lock(m_QueueMutex);
         m_IdleCV.wait(lock, [this]
         {
-            return m_LoadQueue.empty() && !m_ActiveLoadID.IsValid();
+            return m_InFlightLoads.empty() && std::all_of(m_LoadQueues.begin(), m_LoadQueues.end(),
+                [](const auto& queue) { return queue.empty(); });
         });
     }
 
@@ -160,28 +171,22 @@ namespace Mixture
         bool removedFromQueue = false;
         {
             std::lock_guard<std::mutex> lock(m_QueueMutex);
-            found = m_ActiveLoadID == id && m_ActiveLoadCancellable;
+            const auto inFlight = m_InFlightLoads.find(id);
+            found = inFlight != m_InFlightLoads.end() && inFlight->second;
             if (found) m_CancelledLoads.insert(id);
 
-            std::queue<LoadRequest> retained;
-            while (!m_LoadQueue.empty())
+            for (auto& queue : m_LoadQueues)
             {
-                LoadRequest request = std::move(m_LoadQueue.front());
-                m_LoadQueue.pop();
-                if (request.ID == id)
-                {
-                    found = true;
-                    removedFromQueue = true;
-                }
-                else
-                {
-                    retained.push(std::move(request));
-                }
+                const auto removed = std::remove_if(queue.begin(), queue.end(),
+                    [id](const LoadRequest& request) { return request.ID == id; });
+                if (removed == queue.end()) continue;
+
+                queue.erase(removed, queue.end());
+                found = true;
+                removedFromQueue = true;
             }
-            m_LoadQueue.swap(retained);
 
-            if (m_LoadQueue.empty() && !m_ActiveLoadID.IsValid())
-                m_IdleCV.notify_all();
+            if (removedFromQueue) m_IdleCV.notify_all();
         }
 
         if (removedFromQueue)
@@ -210,17 +215,30 @@ namespace Mixture
             OPAL_WARN("AssetManager", "Asset Directory does not exist!");
         }
 
-        // Initialize File Watcher
-        if (std::filesystem::exists(m_RootDirectory))
-        {
-            if (m_FileWatcher) m_FileWatcher->Stop();
+        RestartFileWatcher();
+    }
 
-            m_FileWatcher = CreateScope<FileSystemWatcher>(m_RootDirectory, [this](const std::filesystem::path& path, FileAction action)
-            {
-                this->OnAssetChange(path, action);
-            });
-            m_FileWatcher->Start();
+    void AssetManager::SetHotReloadEnabled(bool enabled)
+    {
+        m_HotReloadEnabled = enabled;
+        RestartFileWatcher();
+    }
+
+    void AssetManager::RestartFileWatcher()
+    {
+        if (m_FileWatcher)
+        {
+            m_FileWatcher->Stop();
+            m_FileWatcher.reset();
         }
+
+        if (!m_HotReloadEnabled || m_RootDirectory.empty() || !std::filesystem::exists(m_RootDirectory)) return;
+
+        m_FileWatcher = CreateScope<FileSystemWatcher>(m_RootDirectory, [this](const std::filesystem::path& path, FileAction action)
+        {
+            this->OnAssetChange(path, action);
+        });
+        m_FileWatcher->Start();
     }
 
     void AssetManager::SetAssetFileResolver(Ref<IAssetFileResolver> resolver)
@@ -249,6 +267,35 @@ namespace Mixture
         return m_ReloadCallbacks.erase(handle) != 0;
     }
 
+    bool AssetManager::SetLoadPriority(UUID id, AssetLoadPriority priority)
+    {
+        if (!id.IsValid() || priority >= AssetLoadPriority::Count) return false;
+
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        return MoveQueuedLoad(id, priority, false);
+    }
+
+    bool AssetManager::MoveQueuedLoad(UUID id, AssetLoadPriority priority, bool raiseOnly)
+    {
+        for (size_t level = 0; level < m_LoadQueues.size(); ++level)
+        {
+            auto& queue = m_LoadQueues[level];
+            const auto it = std::find_if(queue.begin(), queue.end(),
+                [id](const LoadRequest& request) { return request.ID == id; });
+            if (it == queue.end()) continue;
+
+            const auto current = static_cast<AssetLoadPriority>(level);
+            if (current == priority || (raiseOnly && priority < current)) return true;
+
+            LoadRequest request = std::move(*it);
+            queue.erase(it);
+            request.Priority = priority;
+            m_LoadQueues[static_cast<size_t>(priority)].push_back(std::move(request));
+            return true;
+        }
+        return false;
+    }
+
     bool AssetManager::EnqueueLoad(LoadRequest request)
     {
         if (!m_Running) return false;
@@ -257,7 +304,7 @@ namespace Mixture
             std::lock_guard<std::mutex> lock(m_QueueMutex);
             if (!m_Running) return false;
             m_CancelledLoads.erase(request.ID);
-            m_LoadQueue.push(std::move(request));
+            m_LoadQueues[static_cast<size_t>(request.Priority)].push_back(std::move(request));
         }
         m_QueueCV.notify_one();
         return true;
@@ -341,8 +388,10 @@ namespace Mixture
         return m_AssetCache.Contains(id);
     }
 
-    AssetHandle AssetManager::GetAsset(AssetType type, const std::filesystem::path& path)
+    AssetHandle AssetManager::GetAsset(AssetType type, const std::filesystem::path& path, AssetLoadPriority priority)
     {
+        if (priority >= AssetLoadPriority::Count) priority = AssetLoadPriority::Normal;
+
         // Resolve path through redirectors in case the asset has moved
         std::filesystem::path resolvedPath = AssetRegistry::Get().ResolvePath(type, path);
 
@@ -401,6 +450,7 @@ namespace Mixture
         }
 
         // Check Cache & Loading Map
+        bool loading = true;
         {
             std::lock_guard<std::mutex> lock(m_CacheMutex);
 
@@ -409,8 +459,15 @@ namespace Mixture
             if (cachedAsset) return AssetHandle{ metadata.ID, cachedAsset->GetMagic() };
 
             // Check if already loading
-            auto it = m_LoadingAssets.find(metadata.ID);
-            if (it != m_LoadingAssets.end()) return AssetHandle{ metadata.ID, 0 };
+            if (!m_LoadingAssets.contains(metadata.ID)) loading = false;
+        }
+
+        if (loading)
+        {
+            // A request that is still queued follows the most urgent caller.
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            MoveQueuedLoad(metadata.ID, priority, true);
+            return AssetHandle{ metadata.ID, 0 };
         }
 
         // Submit Load Task
@@ -426,7 +483,7 @@ namespace Mixture
             m_LoadingAssets[metadata.ID] = newMagic;
         }
 
-        if (!EnqueueLoad({ type, resolvedPath, metadata.ID, newMagic }))
+        if (!EnqueueLoad({ type, resolvedPath, metadata.ID, newMagic, priority }))
         {
             std::lock_guard<std::mutex> lock(m_CacheMutex);
             m_LoadingAssets.erase(metadata.ID);
@@ -438,43 +495,94 @@ namespace Mixture
         return AssetHandle{ metadata.ID, 0 };
     }
 
-    void AssetManager::LoadAssetInternal(AssetType type, const std::filesystem::path& path, UUID id, uint32_t magic)
+    void AssetManager::ReadAsset(const LoadRequest& request)
     {
-        const char* typeString = Utils::AssetTypeToString(type);
-        auto serializerIt = m_Serializers.find(type);
-        if (serializerIt == m_Serializers.end())
+        MX_PROFILE_SCOPE("AssetManager::ReadAsset");
+        const UUID id = request.ID;
+        const auto failLoad = [this, id]
         {
-            OPAL_ERROR("AssetManager", "No serializer registered for AssetType='{}'", typeString);
-            std::lock_guard<std::mutex> lock(m_CacheMutex);
-            m_LoadingAssets.erase(id);
+            {
+                std::lock_guard<std::mutex> lock(m_CacheMutex);
+                m_LoadingAssets.erase(id);
+            }
+            FinishLoad(id);
+        };
+
+        if (!m_Serializers.contains(request.Type))
+        {
+            OPAL_ERROR("AssetManager", "No serializer registered for AssetType='{}'", Utils::AssetTypeToString(request.Type));
+            failLoad();
             return;
         }
 
-        const auto fullPath = ResolveFullPath(type, path);
+        const auto fullPath = ResolveFullPath(request.Type, request.Path);
         if (!fullPath)
         {
-            OPAL_ERROR("AssetManager", "Rejected asset load outside its type root: {}", path.string());
-            std::lock_guard<std::mutex> lock(m_CacheMutex);
-            m_LoadingAssets.erase(id);
+            OPAL_ERROR("AssetManager", "Rejected asset load outside its type root: {}", request.Path.string());
+            failLoad();
             return;
         }
 
-        std::ifstream stream(*fullPath, std::ios::binary | std::ios::ate);
-        if (!stream)
+        FileContents contents;
+        if (!ReadFileContents(id, *fullPath, contents) || IsLoadCancelled(id))
         {
-            OPAL_ERROR("AssetManager", "Failed to open file {}", fullPath->string());
-            std::lock_guard<std::mutex> lock(m_CacheMutex);
-            m_LoadingAssets.erase(id);
+            failLoad();
             return;
         }
 
+        if (!TaskSystem::IsInitialized())
+        {
+            DecodeAsset(request, contents);
+            FinishLoad(id);
+            return;
+        }
+
+        try
+        {
+            TaskSystem::Submit([this, request, contents = std::move(contents)]
+            {
+                DecodeAsset(request, contents);
+                FinishLoad(request.ID);
+            });
+        }
+        catch (const std::exception& e)
+        {
+            OPAL_ERROR("AssetManager", "Failed to dispatch decoding of {}: {}", request.Path.string(), e.what());
+            failLoad();
+        }
+    }
+
+    bool AssetManager::ReadFileContents(UUID id, const std::filesystem::path& fullPath, FileContents& contents)
+    {
+        if (!m_HotReloadEnabled)
+        {
+            // Cooked content is never rewritten while the application runs, so assets may keep
+            // referencing the mapping; the OS serves page faults from the read-ahead started here.
+            Ref<MappedFile> file = MappedFile::Open(fullPath);
+            if (!file)
+            {
+                OPAL_ERROR("AssetManager", "Failed to map file {}", fullPath.string());
+                return false;
+            }
+            contents.Data = file->GetData();
+            contents.Storage = std::move(file);
+            return true;
+        }
+
+        // Watched files are rewritten in place by compilers and exporters. A mapping would fault
+        // once the file shrinks and, on Windows, block replacing it, so they are read into memory.
+        std::ifstream stream(fullPath, std::ios::binary | std::ios::ate);
+        if (!stream)
+        {
+            OPAL_ERROR("AssetManager", "Failed to open file {}", fullPath.string());
+            return false;
+        }
+
         const std::streampos end = stream.tellg();
         if (end <= 0)
         {
-            OPAL_ERROR("AssetManager", "Read empty data or failed from file: {}", path.string());
-            std::lock_guard<std::mutex> lock(m_CacheMutex);
-            m_LoadingAssets.erase(id);
-            return;
+            OPAL_ERROR("AssetManager", "Read empty data or failed from file: {}", fullPath.string());
+            return false;
         }
 
         const auto endOffset = static_cast<std::streamoff>(end);
@@ -482,65 +590,60 @@ namespace Mixture
         if (fileSize > std::numeric_limits<size_t>::max()
             || fileSize > static_cast<uintmax_t>(std::numeric_limits<std::streamsize>::max()))
         {
-            OPAL_ERROR("AssetManager", "Asset file is too large to read safely: {}", fullPath->string());
-            std::lock_guard<std::mutex> lock(m_CacheMutex);
-            m_LoadingAssets.erase(id);
-            return;
+            OPAL_ERROR("AssetManager", "Asset file is too large to read safely: {}", fullPath.string());
+            return false;
         }
 
-        Vector<char> data(static_cast<size_t>(endOffset));
+        auto data = CreateRef<Vector<char>>(static_cast<size_t>(endOffset));
         stream.seekg(0, std::ios::beg);
 
         constexpr size_t ReadChunkSize = 1024 * 1024;
         size_t offset = 0;
-        while (offset < data.size())
+        while (offset < data->size())
         {
-            if (IsLoadCancelled(id))
-            {
-                std::lock_guard<std::mutex> lock(m_CacheMutex);
-                m_LoadingAssets.erase(id);
-                return;
-            }
+            if (IsLoadCancelled(id)) return false;
 
-            const size_t bytesToRead = std::min(ReadChunkSize, data.size() - offset);
-            stream.read(data.data() + offset, static_cast<std::streamsize>(bytesToRead));
+            const size_t bytesToRead = std::min(ReadChunkSize, data->size() - offset);
+            stream.read(data->data() + offset, static_cast<std::streamsize>(bytesToRead));
             if (stream.gcount() != static_cast<std::streamsize>(bytesToRead))
             {
-                OPAL_ERROR("AssetManager", "Failed while reading file: {}", fullPath->string());
-                std::lock_guard<std::mutex> lock(m_CacheMutex);
-                m_LoadingAssets.erase(id);
-                return;
+                OPAL_ERROR("AssetManager", "Failed while reading file: {}", fullPath.string());
+                return false;
             }
             offset += bytesToRead;
         }
 
-        if (IsLoadCancelled(id))
-        {
-            std::lock_guard<std::mutex> lock(m_CacheMutex);
-            m_LoadingAssets.erase(id);
-            return;
-        }
+        contents.Data = std::as_bytes(std::span<const char>(*data));
+        contents.Storage = std::move(data);
+        return true;
+    }
+
+    void AssetManager::DecodeAsset(const LoadRequest& request, const FileContents& contents)
+    {
+        MX_PROFILE_SCOPE("AssetManager::DecodeAsset");
+        const UUID id = request.ID;
+        const char* typeString = Utils::AssetTypeToString(request.Type);
 
         AssetMetadata metadata;
         metadata.ID = id;
-        metadata.Type = type;
-        metadata.FilePath = path;
+        metadata.Type = request.Type;
+        metadata.FilePath = request.Path;
 
         Ref<IAsset> asset = nullptr;
         try
         {
-            asset = serializerIt->second->Load(data, metadata);
+            asset = m_Serializers.at(request.Type)->Load(contents.Data, contents.Storage, metadata);
         }
         catch (const std::exception& e)
         {
-            OPAL_ERROR("AssetManager", "Exception deserializing {}: {}", path.string(), e.what());
+            OPAL_ERROR("AssetManager", "Exception deserializing {}: {}", request.Path.string(), e.what());
         }
 
         bool cancelled = false;
         {
             std::lock_guard<std::mutex> lock(m_QueueMutex);
             cancelled = !m_Running || m_CancelledLoads.contains(id);
-            if (!cancelled) m_ActiveLoadCancellable = false;
+            if (!cancelled) m_InFlightLoads[id] = false;
         }
 
         bool notifyReload = false;
@@ -550,9 +653,9 @@ namespace Mixture
 
             if (asset && !cancelled)
             {
-                asset->SetMagic(magic);
+                asset->SetMagic(request.Magic);
                 m_AssetCache.Put(id, asset, asset->GetMemoryUsage());
-                OPAL_LOG_DEBUG("AssetManager", "Loaded {} from '{}' (ID: {})", typeString, path.string(), (uint64_t)id);
+                OPAL_LOG_DEBUG("AssetManager", "Loaded {} from '{}' (ID: {})", typeString, request.Path.string(), (uint64_t)id);
                 notifyReload = true;
             }
             else if (!cancelled)
@@ -575,8 +678,21 @@ namespace Mixture
 
             for (const auto& callback : callbacks)
             {
-                callback(type, id);
+                callback(request.Type, id);
             }
         }
     }
+
+    void AssetManager::FinishLoad(UUID id)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_InFlightLoads.erase(id);
+            m_CancelledLoads.erase(id);
+        }
+
+        // Wakes the I/O thread if it waited for a free in-flight slot.
+        m_QueueCV.notify_all();
+        m_IdleCV.notify_all();
+    }
 }
@@ -6,38 +6,31 @@
 
 namespace Mixture
 {
-    Ref<IAsset> ShaderSerializer::Load(const Vector<char>& data, const AssetMetadata& metadata)
+    Ref<IAsset> ShaderSerializer::Load(std::span<const std::byte> data, const Ref<const void>& storage, const AssetMetadata& metadata)
     {
         if (data.empty()) return nullptr;
 
-        size_t fileSize = data.size();
-
-        std::vector<uint8_t> compiledBlob;
         std::string ext = metadata.FilePath.extension().string();
 
         if (ext == ".slang")
         {
             // --- PATH: COMPILE SOURCE ---
-            // Construct string from data (careful if not null terminated)
-            std::string sourceCode(data.begin(), data.end());
+            std::string sourceCode(reinterpret_cast<const char*>(data.data()), data.size());
 
-            compiledBlob = ShaderCompiler::Compile(sourceCode);
+            std::vector<uint8_t> compiledBlob = ShaderCompiler::Compile(sourceCode);
 
             if (compiledBlob.empty())
             {
                 OPAL_ERROR("AssetManager", "Shader Compilation Failed: {}", metadata.FilePath.string());
                 return nullptr;
             }
-        }
-        else
-        {
-            // --- PATH: LOAD BINARY ---
-            // File is already .cso / .spv (pre-compiled)
-            compiledBlob.resize(fileSize);
-            memcpy(compiledBlob.data(), data.data(), fileSize);
+
+            return CreateRef<ShaderAsset>(metadata.ID, metadata.FilePath.filename().string(), std::move(compiledBlob));
         }
 
-        // Create the Asset
-        return CreateRef<ShaderAsset>(metadata.ID, metadata.FilePath.filename().string(), std::move(compiledBlob));
+        // --- PATH: LOAD BINARY ---
+        // File is already .cso / .spv (pre-compiled), so the asset references the file data.
+        const std::span<const uint8_t> byteCode(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+        return CreateRef<ShaderAsset>(metadata.ID, metadata.FilePath.filename().string(), byteCode, storage);
     }
 }
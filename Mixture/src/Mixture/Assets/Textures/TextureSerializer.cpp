@@ -3,11 +3,88 @@
 #include "Mixture/Assets/Textures/TextureAsset.hpp"
 
 #include <stb_image.h>
+#include <cstring>
 #include <limits>
 
 namespace Mixture
 {
-    Ref<IAsset> TextureSerializer::Load(const Vector<char>& data, const AssetMetadata& metadata)
+    namespace
+    {
+        constexpr uint32_t DDSMagic = 0x20534444;           // "DDS "
+        constexpr uint32_t DDSFourCCDX10 = 0x30315844;      // "DX10"
+        constexpr uint32_t DDSPixelFormatFourCC = 0x4;
+        constexpr uint32_t DDSPixelFormatRGB = 0x40;
+        constexpr uint32_t DDSCaps2CubeMap = 0x200;
+        constexpr uint32_t DDSCaps2Volume = 0x200000;
+        constexpr uint32_t DXGIFormatR8G8B8A8UNorm = 28;
+        constexpr uint32_t DXGIFormatB8G8R8A8UNorm = 87;
+        constexpr size_t DDSHeaderSize = 128;
+        constexpr size_t DDSHeaderDX10Size = 20;
+
+        uint32_t ReadU32(std::span<const std::byte> data, size_t offset)
+        {
+            uint32_t value;
+            std::memcpy(&value, data.data() + offset, sizeof(value));
+            return value;
+        }
+
+        bool IsDDS(std::span<const std::byte> data)
+        {
+            return data.size() >= DDSHeaderSize && ReadU32(data, 0) == DDSMagic;
+        }
+
+        /**
+         * @brief Serves the top mip of an uncompressed 8-bit RGBA/BGRA DDS directly from the file data.
+         *
+         * Those files are already in the layout the renderer uploads, so nothing is decoded or copied.
+         */
+        Ref<IAsset> LoadCookedDDS(std::span<const std::byte> data, const Ref<const void>& storage, const AssetMetadata& metadata)
+        {
+            const uint32_t height = ReadU32(data, 12);
+            const uint32_t width = ReadU32(data, 16);
+            const uint32_t pixelFlags = ReadU32(data, 80);
+            const uint32_t fourCC = ReadU32(data, 84);
+            const uint32_t caps2 = ReadU32(data, 112);
+
+            size_t offset = DDSHeaderSize;
+            RHI::Format format = RHI::Format::Undefined;
+            if ((pixelFlags & DDSPixelFormatFourCC) && fourCC == DDSFourCCDX10)
+            {
+                if (data.size() < DDSHeaderSize + DDSHeaderDX10Size) return nullptr;
+
+                const uint32_t dxgiFormat = ReadU32(data, DDSHeaderSize);
+                if (dxgiFormat == DXGIFormatR8G8B8A8UNorm) format = RHI::Format::R8G8B8A8_UNORM;
+                else if (dxgiFormat == DXGIFormatB8G8R8A8UNorm) format = RHI::Format::B8G8R8A8_UNORM;
+                offset += DDSHeaderDX10Size;
+            }
+            else if ((pixelFlags & DDSPixelFormatRGB) && ReadU32(data, 88) == 32 && ReadU32(data, 104) == 0xFF000000)
+            {
+                const uint32_t redMask = ReadU32(data, 92);
+                if (redMask == 0x000000FF) format = RHI::Format::R8G8B8A8_UNORM;
+                else if (redMask == 0x00FF0000) format = RHI::Format::B8G8R8A8_UNORM;
+            }
+
+            if (format == RHI::Format::Undefined || (caps2 & (DDSCaps2CubeMap | DDSCaps2Volume)))
+            {
+                OPAL_ERROR("AssetManager", "Unsupported DDS layout in '{}': only 2D 8-bit RGBA/BGRA is supported",
+                    metadata.FilePath.string());
+                return nullptr;
+            }
+
+            if (width == 0 || height == 0
+                || static_cast<uint64_t>(width) * height * 4 > static_cast<uint64_t>(data.size() - offset))
+            {
+                OPAL_ERROR("AssetManager", "Truncated DDS texture: {}", metadata.FilePath.string());
+                return nullptr;
+            }
+
+            const size_t dataSize = static_cast<size_t>(width) * height * 4;
+            const std::span<const uint8_t> pixels(reinterpret_cast<const uint8_t*>(data.data() + offset), dataSize);
+            return CreateRef<TextureAsset>(metadata.ID, metadata.FilePath.filename().string(), width, height, format, pixels, storage);
+        }
+    }
+
+    Ref<IAsset> TextureSerializer::Load(std::span<const std::byte> data, const Ref<const void>& storage, const AssetMetadata& metadata)
     {
         if (data.empty())
         {
@@ -15,6 +92,8 @@ namespace Mixture
             return nullptr;
         }
 
+        if (IsDDS(data)) return LoadCookedDDS(data, storage, metadata);
+
         if (data.size() > static_cast<size_t>(std::numeric_limits<int>::max()))
         {
             OPAL_ERROR("AssetManager", "Texture file is too large for the decoder: {}", metadata.FilePath.string());
@@ -33,24 +112,23 @@ namespace Mixture
             return nullptr;
         }
 
+        // The asset adopts the decoder's buffer instead of copying it.
+        Ref<const void> decoded(pixels, [](const void* buffer) { stbi_image_free(const_cast<void*>(buffer)); });
+
         if (width <= 0 || height <= 0
             || static_cast<size_t>(width) > std::numeric_limits<size_t>::max() / static_cast<size_t>(height)
             || static_cast<size_t>(width) * static_cast<size_t>(height) > std::numeric_limits<size_t>::max() / 4)
         {
-            stbi_image_free(pixels);
             OPAL_ERROR("AssetManager", "Decoded texture dimensions overflow: {}", metadata.FilePath.string());
             return nullptr;
         }
 
-        // Copy to vector
         const size_t dataSize = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
-        Vector<uint8_t> textureData(pixels, pixels + dataSize);
-
-        stbi_image_free(pixels);
 
         // Name from filename
         std::string name = metadata.FilePath.filename().string();
 
-        return CreateRef<TextureAsset>(metadata.ID, name, static_cast<uint32_t>(width), static_cast<uint32_t>(height), RHI::Format::R8G8B8A8_UNORM, std::move(textureData));
+        return CreateRef<TextureAsset>(metadata.ID, name, static_cast<uint32_t>(width), static_cast<uint32_t>(height),
+            RHI::Format::R8G8B8A8_UNORM, std::span<const uint8_t>(pixels, dataSize), std::move(decoded));
     }
 }
@@ -1,6 +1,7 @@
 #include "mxpch.hpp"
 #include "Mixture/Core/Application.hpp"
 
+#include "Mixture/Core/Profiler.hpp"
 #include "Mixture/Core/Time.hpp"
 #include "Mixture/Core/Version.hpp"
 #include "Mixture/Core/Threading/TaskSystem.hpp"
@@ -25,14 +26,48 @@
 
 #include <Opal/Base.hpp>
 
+#include <charconv>
 #include <stdexcept>
+#include <string_view>
 
 namespace Mixture
 {
+    namespace
+    {
+        /** Applies --headless and --frames <count> on top of the description the client built. */
+        ApplicationDescription ApplyCommandLine(ApplicationDescription description)
+        {
+            if (!description.Args.Args) return description;
+
+            for (int index = 1; index < description.Args.Count; ++index)
+            {
+                const std::string_view argument = description.Args[index];
+                if (argument == "--headless")
+                {
+                    description.Headless = true;
+                    description.EnableImGui = false;
+                }
+                else if (argument == "--frames")
+                {
+                    if (index + 1 >= description.Args.Count)
+                        throw std::invalid_argument("--frames expects a frame count");
+
+                    const std::string_view count = description.Args[++index];
+                    uint32_t frames = 0;
+                    const auto [end, error] = std::from_chars(count.data(), count.data() + count.size(), frames);
+                    if (error != std::errc{} || end != count.data() + count.size())
+                        throw std::invalid_argument("--frames expects a frame count");
+                    description.FrameLimit = frames;
+                }
+            }
+            return description;
+        }
+    }
+
     Application* Application::s_Instance = nullptr;
 
     Application::Application(const ApplicationDescription& appDescription)
-        : m_AppDescription(appDescription)
+        : m_AppDescription(ApplyCommandLine(appDescription))
     {
         if (s_Instance)
         {
@@ -45,24 +80,33 @@ namespace Mixture
             TaskSystem::Init();
 
             AssetManager::Get().Init();
+#ifdef OPAL_DIST
+            // Shipped assets are cooked and never rewritten, so they are served from file mappings.
+            AssetManager::Get().SetHotReloadEnabled(false);
+#endif
             AssetManager::Get().SetAssetRoot("Assets");
-            AssetManager::Get().SetGraphicsAPI(appDescription.API);
-
-            auto props = WindowProps();
-            props.Title = appDescription.Name;
-            props.Width = appDescription.Width;
-            props.Height = appDescription.Height;
+            AssetManager::Get().SetGraphicsAPI(m_AppDescription.API);
 
-            m_Window = CreateScope<Window>(props);
-            m_Window->SetEventCallback(OPAL_BIND_EVENT_FN(OnEvent));
+            void* nativeWindow = nullptr;
+            if (!m_AppDescription.Headless)
+            {
+                auto props = WindowProps();
+                props.Title = m_AppDescription.Name;
+                props.Width = m_AppDescription.Width;
+                props.Height = m_AppDescription.Height;
+
+                m_Window = CreateScope<Window>(props);
+                m_Window->SetEventCallback(OPAL_BIND_EVENT_FN(OnEvent));
+                nativeWindow = m_Window->GetNativeWindow();
+            }
 
-            m_Context = RHI::IGraphicsContext::Create(appDescription, m_Window->GetNativeWindow());
+            m_Context = RHI::IGraphicsContext::Create(m_AppDescription, nativeWindow);
             if (!m_Context)
             {
                 throw std::runtime_error("Failed to create graphics context");
             }
 
-            if (appDescription.EnableImGui)
+            if (m_AppDescription.EnableImGui && m_Window)
             {
                 m_ImGuiContext = CreateScope<ImGuiContext>(m_Window->GetNativeWindow(), *m_Context);
             }
@@ -104,6 +148,9 @@ namespace Mixture
 
         AssetManager::Get().Shutdown();
         TaskSystem::Shutdown();
+
+        // Writes a capture that was still running, including the tasks drained above.
+        Profiler::EndCapture();
         s_Instance = nullptr;
     }
 
@@ -115,9 +162,15 @@ namespace Mixture
     void Application::Run() const
     {
         Timer frameTimer{};
+        const uint32_t frameLimit = m_AppDescription.FrameLimit;
+        uint32_t renderedFrames = 0;
+        float totalFrameMs = 0.0f;
 
-        while (m_Running)
+        while (m_Running && (frameLimit == 0 || renderedFrames < frameLimit))
         {
+            Profiler::MarkFrame();
+            MX_PROFILE_SCOPE("Frame");
+
             float timestep = frameTimer.Tick();
             float frameTimeMs = timestep * 1000.0f;
             float fps = timestep > 0.0f ? 1.0f / timestep : 0.0f;
@@ -165,7 +218,7 @@ namespace Mixture
             RenderStats::Get().SetMemoryUsage(vramMB, ramMB);
 #endif // !defined(OPAL_DIST)
 
-            m_Window->OnUpdate();
+            if (m_Window) m_Window->OnUpdate();
 
             // CPU Logic
             for (const auto& layer : m_LayerStack) layer->OnUpdate(timestep);
@@ -174,7 +227,11 @@ namespace Mixture
 
             if (RHI::ITexture* backbufferTex = m_Context->BeginFrame())
             {
-                m_RenderGraph->ImportResource("SwapchainBackbuffer", backbufferTex);
+                // The offscreen backbuffer of a headless context is left ready to be read back.
+                const RHI::ResourceState backbufferState = m_AppDescription.Headless
+                    ? RHI::ResourceState::CopySource : RHI::ResourceState::Present;
+                m_RenderGraph->ImportResource("SwapchainBackbuffer", backbufferTex,
+                    { .DiscardContents = true, .FinalState = backbufferState });
                 m_RenderGraph->AddAlias("Backbuffer", "SwapchainBackbuffer");
 
                 if (m_ImGuiContext)
@@ -197,8 +254,24 @@ namespace Mixture
                 }
 
                 m_Context->EndFrame();
+
+                ++renderedFrames;
+                if (m_AppDescription.Headless)
+                {
+                    // GPU times lag behind by the frames in flight and stay negative without timestamps.
+                    const float cpuFrameMs = frameTimer.ElapsedMillis();
+                    totalFrameMs += cpuFrameMs;
+                    OPAL_INFO("Core", "Frame {}: {:.3f} ms CPU, {:.3f} ms GPU",
+                        renderedFrames, cpuFrameMs, RenderStats::Get().GetStats().GpuFrameTimeMs);
+                }
             }
         }
+
+        if (m_AppDescription.Headless && renderedFrames > 0)
+        {
+            OPAL_INFO("Core", "Rendered {} headless frames, {:.3f} ms CPU on average",
+                renderedFrames, totalFrameMs / static_cast<float>(renderedFrames));
+        }
     }
 
     void Application::OnEvent(Event& event)
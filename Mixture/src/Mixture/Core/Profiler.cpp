@@ -0,0 +1,268 @@
+#include "mxpch.hpp"
+#include "Mixture/Core/Profiler.hpp"
+
+#if !defined(OPAL_DIST)
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <string>
+
+namespace Mixture
+{
+    struct Profiler::State
+    {
+        std::mutex RingsMutex;
+        Vector<Scope<ThreadRing>> Rings;
+        uint32_t NextThreadId = 0;
+
+        std::mutex CaptureMutex;
+        std::filesystem::path OutputPath;
+        uint32_t FramesRemaining = 0;
+        /** @brief Ticks() at the start and end of the capture, and Now() taken right after each to calibrate them. */
+        std::atomic<int64_t> CaptureBegin = 0;
+        std::atomic<int64_t> CaptureEnd = 0;
+        std::atomic<int64_t> CaptureBeginNanoseconds = 0;
+        std::atomic<int64_t> CaptureEndNanoseconds = 0;
+    };
+
+    struct Profiler::ThreadRingOwner
+    {
+        ~ThreadRingOwner()
+        {
+            if (!s_ThreadRing) return;
+            auto& state = GetState();
+            std::lock_guard<std::mutex> lock(state.RingsMutex);
+            s_ThreadRing->State = RingState::Exited;
+            s_ThreadRing = nullptr;
+        }
+    };
+
+    namespace
+    {
+        void WriteJSONString(std::ostream& stream, std::string_view value)
+        {
+            stream << '"';
+            for (const char c : value)
+            {
+                switch (c)
+                {
+                    case '"': stream << "\\\""; break;
+                    case '\\': stream << "\\\\"; break;
+                    case '\n': stream << "\\n"; break;
+                    case '\t': stream << "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) stream << ' ';
+                        else stream << c;
+                        break;
+                }
+            }
+            stream << '"';
+        }
+
+        void WriteMicroseconds(std::ostream& stream, int64_t nanoseconds)
+        {
+            stream << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000;
+        }
+    }
+
+    std::atomic<bool> Profiler::s_Capturing = false;
+    std::atomic<uint32_t> Profiler::s_CaptureIndex = 0;
+
+    Profiler::State& Profiler::GetState()
+    {
+        static State state;
+        return state;
+    }
+
+    Profiler::ThreadRing& Profiler::AcquireThreadRing()
+    {
+        thread_local ThreadRingOwner owner;
+        auto& state = GetState();
+        const uint32_t captureIndex = s_CaptureIndex.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(state.RingsMutex);
+
+        ThreadRing* ring = s_ThreadRing;
+        if (!ring)
+        {
+            const auto reusable = std::find_if(state.Rings.begin(), state.Rings.end(),
+                [](const Scope<ThreadRing>& candidate) { return candidate->State == RingState::Free; });
+            if (reusable != state.Rings.end())
+            {
+                ring = reusable->get();
+                ring->Head.store(0, std::memory_order_relaxed);
+                ring->State = RingState::Active;
+            }
+            else
+            {
+                ring = state.Rings.emplace_back(CreateScope<ThreadRing>()).get();
+            }
+            ring->ThreadId = state.NextThreadId++;
+            s_ThreadRing = ring;
+        }
+
+        // The thread name may have changed since the previous capture.
+        ring->ThreadName = Opal::LogRegistry::GetThreadName();
+        if (ring->ThreadName.empty()) ring->ThreadName = "Thread " + std::to_string(ring->ThreadId);
+        ring->CaptureIndex = captureIndex;
+        return *ring;
+    }
+
+    void Profiler::BeginCapture(std::filesystem::path outputPath, uint32_t frameCount)
+    {
+        auto& state = GetState();
+        {
+            // Events of threads that have exited belong to the previous capture; their rings can be reused.
+            std::lock_guard<std::mutex> ringsLock(state.RingsMutex);
+            for (auto& ring : state.Rings)
+            {
+                if (ring->State == RingState::Exited) ring->State = RingState::Free;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(state.CaptureMutex);
+        s_CaptureIndex.fetch_add(1, std::memory_order_relaxed);
+        state.OutputPath = std::move(outputPath);
+        state.FramesRemaining = frameCount;
+        state.CaptureBegin = Ticks();
+        state.CaptureBeginNanoseconds = Now();
+        state.CaptureEnd = 0;
+        s_Capturing = true;
+    }
+
+    bool Profiler::EndCapture()
+    {
+        auto& state = GetState();
+        std::filesystem::path outputPath;
+        {
+            std::lock_guard<std::mutex> lock(state.CaptureMutex);
+            if (!s_Capturing) return false;
+            s_Capturing = false;
+            state.CaptureEnd = Ticks();
+            state.CaptureEndNanoseconds = Now();
+            outputPath = std::move(state.OutputPath);
+            state.OutputPath.clear();
+        }
+
+        if (outputPath.empty()) return true;
+
+        std::ofstream stream(outputPath, std::ios::trunc);
+        if (!stream)
+        {
+            OPAL_ERROR("Core/Profiler", "Failed to open trace file {}", outputPath.string());
+            return false;
+        }
+
+        WriteChromeTrace(stream);
+        if (!stream)
+        {
+            OPAL_ERROR("Core/Profiler", "Failed to write trace file {}", outputPath.string());
+            return false;
+        }
+
+        OPAL_INFO("Core/Profiler", "Wrote trace to {}", outputPath.string());
+        return true;
+    }
+
+    void Profiler::MarkFrame()
+    {
+        if (!IsCapturing()) return;
+
+        bool finished = false;
+        {
+            auto& state = GetState();
+            std::lock_guard<std::mutex> lock(state.CaptureMutex);
+            finished = state.FramesRemaining > 0 && --state.FramesRemaining == 0;
+        }
+        if (finished) EndCapture();
+    }
+
+    size_t Profiler::GetThreadRingCount()
+    {
+        auto& state = GetState();
+        std::lock_guard<std::mutex> lock(state.RingsMutex);
+        return state.Rings.size();
+    }
+
+    void Profiler::RecordCopy(std::string_view name, int64_t begin, int64_t end)
+    {
+        ThreadRing& ring = GetThreadRing();
+        const uint64_t head = ring.Head.load(std::memory_order_relaxed);
+        TraceEvent& event = ring.Events[head % RingCapacity];
+        event.Begin = begin;
+        event.End = end;
+        event.Name = nullptr;
+        const size_t length = std::min(name.size(), MaxCopiedNameLength);
+        std::memcpy(event.CopiedName, name.data(), length);
+        event.CopiedName[length] = '\0';
+        ring.Head.store(head + 1, std::memory_order_release);
+    }
+
+    void Profiler::WriteChromeTrace(std::ostream& stream)
+    {
+        auto& state = GetState();
+        const int64_t captureBegin = state.CaptureBegin.load();
+        const int64_t captureEnd = state.CaptureEnd.load();
+
+        // A running capture is calibrated up to now.
+        const int64_t calibrationEnd = captureEnd != 0 ? captureEnd : Ticks();
+        const int64_t calibrationEndNanoseconds = captureEnd != 0 ? state.CaptureEndNanoseconds.load() : Now();
+        const int64_t elapsedTicks = calibrationEnd - captureBegin;
+        const double nanosecondsPerTick = elapsedTicks > 0
+            ? static_cast<double>(calibrationEndNanoseconds - state.CaptureBeginNanoseconds.load()) / static_cast<double>(elapsedTicks)
+            : 1.0;
+        const auto toNanoseconds = [&](int64_t ticks) { return std::llround(static_cast<double>(ticks) * nanosecondsPerTick); };
+
+        stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        const auto separate = [&]() { if (!first) stream << ','; first = false; stream << '\n'; };
+
+        std::lock_guard<std::mutex> lock(state.RingsMutex);
+        Vector<TraceEvent> events;
+        for (const auto& ring : state.Rings)
+        {
+            if (ring->State == RingState::Free) continue;
+
+            const uint64_t head = ring->Head.load(std::memory_order_acquire);
+            const uint64_t tail = head > RingCapacity ? head - RingCapacity : 0;
+            events.clear();
+            for (uint64_t index = tail; index < head; ++index) events.push_back(ring->Events[index % RingCapacity]);
+
+            // Slots the owner reused or started reusing while they were copied may be torn.
+            const uint64_t newHead = ring->Head.load(std::memory_order_acquire);
+            const uint64_t validTail = newHead >= RingCapacity ? newHead - RingCapacity + 1 : 0;
+            const size_t skipped = static_cast<size_t>(std::min(head, std::max(tail, validTail)) - tail);
+            events.erase(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(skipped));
+            std::erase_if(events, [&](const TraceEvent& event)
+            {
+                return event.Begin < captureBegin || (captureEnd != 0 && event.Begin > captureEnd);
+            });
+
+            // Threads without events in this capture get no track.
+            if (events.empty()) continue;
+
+            separate();
+            stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ring->ThreadId << ",\"args\":{\"name\":";
+            WriteJSONString(stream, ring->ThreadName);
+            stream << "}}";
+
+            for (const TraceEvent& event : events)
+            {
+                separate();
+                stream << "{\"name\":";
+                WriteJSONString(stream, event.Name ? std::string_view(event.Name) : std::string_view(event.CopiedName));
+                stream << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << ring->ThreadId << ",\"ts\":";
+                WriteMicroseconds(stream, toNanoseconds(event.Begin - captureBegin));
+                stream << ",\"dur\":";
+                WriteMicroseconds(stream, toNanoseconds(std::max<int64_t>(event.End - event.Begin, 0)));
+                stream << '}';
+            }
+        }
+        stream << "\n]}\n";
+    }
+}
+
+#endif
@@ -1,28 +1,473 @@
 #include "mxpch.hpp"
 #include "Mixture/Core/Threading/TaskSystem.hpp"
 
+#include "Mixture/Core/Memory/PoolAllocator.hpp"
+#include "Mixture/Core/Profiler.hpp"
+
 #include <thread>
-#include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <vector>
 #include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <stdexcept>
 
 namespace Mixture
 {
-    struct TaskQueue
+    /**
+     * @brief Node of the job graph.
+     *
+     * Dependencies counts unfinished prerequisites plus one guard reference held by the
+     * scheduling thread while edges are wired; whoever drops it to zero queues the job.
+     */
+    struct TaskNode
     {
-        std::queue<std::function<void()>> Queue;
+        Job Work;
+        std::atomic<uint32_t> Dependencies = 1;
+        std::atomic<bool> Finished = false;
+
         std::mutex Mutex;
-        std::condition_variable Condition;
-        std::atomic<bool> Running = false;
+        Vector<Ref<TaskNode>> Continuations;
     };
 
-    static TaskQueue s_TaskQueue;
-    static std::vector<std::thread> s_Threads;
-    static std::mutex s_LifecycleMutex;
-    static std::atomic<bool> s_Initialized = false;
+    namespace
+    {
+        constexpr uint32_t NotAWorker = std::numeric_limits<uint32_t>::max();
+        constexpr size_t JobsPerPool = 1024;
+        constexpr size_t InitialRingCapacity = 256;
+
+        struct JobSlab;
+
+        /** @brief Pool-allocated storage for one queued job. */
+        struct JobRecord
+        {
+            Job Work;
+            JobSlab* Owner = nullptr;
+            PoolAllocator* Pool = nullptr;
+            JobRecord* NextFree = nullptr;
+        };
+
+        /**
+         * @brief Job record pools owned by one submitting thread.
+         *
+         * Only the owning thread allocates and frees directly; records executed on another
+         * thread are pushed onto RemoteFrees and reclaimed by the owner on its next allocation.
+         */
+        struct JobSlab
+        {
+            Vector<Scope<PoolAllocator>> Pools;
+            std::atomic<JobRecord*> RemoteFrees = nullptr;
+        };
+
+        /** @brief Keeps slabs alive after their thread exits so in-flight records can still be returned. */
+        struct JobSlabRegistry
+        {
+            std::mutex Mutex;
+            Vector<Scope<JobSlab>> Slabs;
+            Vector<JobSlab*> Available;
+        };
+
+        JobSlabRegistry s_SlabRegistry;
+
+        /** @brief Hands the thread's slab back to the registry when the thread exits. */
+        struct JobSlabLease
+        {
+            JobSlab* Slab = nullptr;
+
+            ~JobSlabLease()
+            {
+                if (!Slab) return;
+                std::lock_guard<std::mutex> lock(s_SlabRegistry.Mutex);
+                s_SlabRegistry.Available.push_back(Slab);
+            }
+        };
+
+        thread_local JobSlabLease t_JobSlab;
+
+        /**
+         * @brief Growable ring buffer of queued records.
+         *
+         * Unlike std::deque it never releases storage, so a warmed-up queue pushes and pops
+         * without allocating.
+         */
+        class JobRing
+        {
+        public:
+            bool IsEmpty() const { return m_Count == 0; }
+            size_t Size() const { return m_Count; }
+
+            void PushBack(JobRecord* record)
+            {
+                if (m_Count == m_Slots.size()) Grow();
+                m_Slots[(m_Head + m_Count) & (m_Slots.size() - 1)] = record;
+                ++m_Count;
+            }
+
+            JobRecord* PopBack()
+            {
+                --m_Count;
+                return m_Slots[(m_Head + m_Count) & (m_Slots.size() - 1)];
+            }
+
+            JobRecord* PopFront()
+            {
+                JobRecord* record = m_Slots[m_Head];
+                m_Head = (m_Head + 1) & (m_Slots.size() - 1);
+                --m_Count;
+                return record;
+            }
+
+        private:
+            void Grow()
+            {
+                Vector<JobRecord*> slots(std::max(InitialRingCapacity, m_Slots.size() * 2));
+                for (size_t i = 0; i < m_Count; ++i)
+                    slots[i] = m_Slots[(m_Head + i) & (m_Slots.size() - 1)];
+
+                m_Slots.swap(slots);
+                m_Head = 0;
+            }
+
+            Vector<JobRecord*> m_Slots;
+            size_t m_Head = 0;
+            size_t m_Count = 0;
+        };
+
+        /**
+         * @brief Deque owned by a single worker.
+         *
+         * The owner pushes and pops at the back, thieves take from the front so the
+         * oldest (usually largest) work migrates while the owner keeps its cache-hot tail.
+         */
+        struct alignas(64) WorkerQueue
+        {
+            JobRing Tasks;
+            std::mutex Mutex;
+
+            std::atomic<uint64_t> Executed = 0;
+            std::atomic<uint64_t> Steals = 0;
+            std::atomic<uint64_t> LocalSubmissions = 0;
+            std::atomic<uint64_t> IdleNanoseconds = 0;
+        };
+
+        struct Scheduler
+        {
+            Vector<Scope<WorkerQueue>> Queues;
+
+            /** @brief Tasks that were enqueued but not yet dequeued by a worker. */
+            std::atomic<uint64_t> Pending = 0;
+            std::atomic<uint64_t> Submitted = 0;
+            std::atomic<uint64_t> Helped = 0;
+            std::atomic<uint32_t> NextQueue = 0;
+            std::atomic<uint32_t> Sleeping = 0;
+            std::atomic<bool> Running = false;
+
+            std::mutex SleepMutex;
+            std::condition_variable WakeCondition;
+        };
+
+        Scheduler s_Scheduler;
+        std::vector<std::thread> s_Threads;
+        std::mutex s_LifecycleMutex;
+        std::atomic<bool> s_Initialized = false;
+
+        thread_local uint32_t t_WorkerIndex = NotAWorker;
+
+        JobSlab& AcquireSlab()
+        {
+            if (t_JobSlab.Slab) return *t_JobSlab.Slab;
+
+            std::lock_guard<std::mutex> lock(s_SlabRegistry.Mutex);
+            if (!s_SlabRegistry.Available.empty())
+            {
+                t_JobSlab.Slab = s_SlabRegistry.Available.back();
+                s_SlabRegistry.Available.pop_back();
+            }
+            else
+            {
+                s_SlabRegistry.Slabs.push_back(CreateScope<JobSlab>());
+                // Reserve up front so returning a lease on thread exit cannot throw.
+                s_SlabRegistry.Available.reserve(s_SlabRegistry.Slabs.size());
+                t_JobSlab.Slab = s_SlabRegistry.Slabs.back().get();
+            }
+            return *t_JobSlab.Slab;
+        }
+
+        void ReclaimRemoteFrees(JobSlab& slab)
+        {
+            JobRecord* record = slab.RemoteFrees.exchange(nullptr, std::memory_order_acquire);
+            while (record)
+            {
+                JobRecord* next = record->NextFree;
+                record->Pool->Destroy(record);
+                record = next;
+            }
+        }
+
+        JobRecord* AllocateRecord(Job&& work)
+        {
+            JobSlab& slab = AcquireSlab();
+            if (slab.RemoteFrees.load(std::memory_order_relaxed))
+                ReclaimRemoteFrees(slab);
+
+            PoolAllocator* pool = nullptr;
+            for (const auto& candidate : slab.Pools)
+            {
+                if (candidate->GetUsedCount() < candidate->GetCapacity())
+                {
+                    pool = candidate.get();
+                    break;
+                }
+            }
+
+            if (!pool)
+            {
+                // Grow geometrically so a burst of in-flight jobs only adds a handful of pools.
+                slab.Pools.push_back(CreateScope<PoolAllocator>(sizeof(JobRecord), alignof(JobRecord),
+                    JobsPerPool << slab.Pools.size()));
+                pool = slab.Pools.back().get();
+            }
+
+            JobRecord* record = pool->Create<JobRecord>();
+            record->Work = std::move(work);
+            record->Owner = &slab;
+            record->Pool = pool;
+            return record;
+        }
+
+        void ReleaseRecord(JobRecord* record)
+        {
+            JobSlab* owner = record->Owner;
+            if (owner == t_JobSlab.Slab)
+            {
+                record->Pool->Destroy(record);
+                return;
+            }
+
+            // Captures are destroyed here; only the raw block travels back to the owner.
+            record->Work.Reset();
+            JobRecord* head = owner->RemoteFrees.load(std::memory_order_relaxed);
+            do
+            {
+                record->NextFree = head;
+            } while (!owner->RemoteFrees.compare_exchange_weak(head, record,
+                std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        JobRecord* PopLocal(WorkerQueue& queue)
+        {
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            return queue.Tasks.IsEmpty() ? nullptr : queue.Tasks.PopBack();
+        }
+
+        JobRecord* StealFrom(uint32_t first, uint32_t attempts)
+        {
+            const uint32_t count = static_cast<uint32_t>(s_Scheduler.Queues.size());
+            for (uint32_t offset = 0; offset < attempts && offset < count; ++offset)
+            {
+                WorkerQueue& victim = *s_Scheduler.Queues[(first + offset) % count];
+
+                std::unique_lock<std::mutex> lock(victim.Mutex, std::try_to_lock);
+                if (!lock.owns_lock() || victim.Tasks.IsEmpty()) continue;
+
+                return victim.Tasks.PopFront();
+            }
+            return nullptr;
+        }
+
+        JobRecord* Steal(uint32_t thief)
+        {
+            const uint32_t count = static_cast<uint32_t>(s_Scheduler.Queues.size());
+            return count > 1 ? StealFrom(thief + 1, count - 1) : nullptr;
+        }
+
+        template<typename F>
+        void RunTask(F&& task)
+        {
+            MX_PROFILE_SCOPE("Task");
+            try
+            {
+                task();
+            }
+            catch (const std::exception& e)
+            {
+                OPAL_ERROR("Core/Threading", "Task threw exception: {}", e.what());
+            }
+            catch (...)
+            {
+                OPAL_ERROR("Core/Threading", "Task threw unknown exception!");
+            }
+        }
+
+        void Execute(JobRecord* record)
+        {
+            s_Scheduler.Pending.fetch_sub(1);
+            RunTask(record->Work);
+            ReleaseRecord(record);
+        }
+
+        bool IsWorkerThread()
+        {
+            // Reads only thread-local state; workers are joined before Shutdown clears the queues.
+            return t_WorkerIndex != NotAWorker;
+        }
+
+        /**
+         * @brief Queues a task if the system is running.
+         *
+         * Workers may keep spawning work while Shutdown drains the queues; they stay alive
+         * until Pending reaches zero, so nothing they push can be lost.
+         */
+        void Enqueue(Job task)
+        {
+            // Count the task before checking Running so Shutdown's drain cannot miss it.
+            s_Scheduler.Pending.fetch_add(1);
+            const bool local = IsWorkerThread();
+            if (!local && (!s_Initialized || !s_Scheduler.Running))
+            {
+                s_Scheduler.Pending.fetch_sub(1);
+                throw std::runtime_error("Cannot submit a task while TaskSystem is stopped");
+            }
+
+            const uint32_t count = static_cast<uint32_t>(s_Scheduler.Queues.size());
+            const uint32_t target = local ? t_WorkerIndex : s_Scheduler.NextQueue.fetch_add(1, std::memory_order_relaxed) % count;
+            WorkerQueue& queue = *s_Scheduler.Queues[target];
+
+            if (local) queue.LocalSubmissions.fetch_add(1, std::memory_order_relaxed);
+            s_Scheduler.Submitted.fetch_add(1, std::memory_order_relaxed);
+
+            JobRecord* record = nullptr;
+            try
+            {
+                record = AllocateRecord(std::move(task));
+                std::lock_guard<std::mutex> lock(queue.Mutex);
+                queue.Tasks.PushBack(record);
+            }
+            catch (...)
+            {
+                if (record) ReleaseRecord(record);
+                if (local) queue.LocalSubmissions.fetch_sub(1, std::memory_order_relaxed);
+                s_Scheduler.Submitted.fetch_sub(1, std::memory_order_relaxed);
+                s_Scheduler.Pending.fetch_sub(1);
+                throw;
+            }
+
+            if (s_Scheduler.Sleeping.load() > 0)
+            {
+                // Taking the mutex orders this wake-up after a sleeper's predicate check.
+                { std::lock_guard<std::mutex> lock(s_Scheduler.SleepMutex); }
+                s_Scheduler.WakeCondition.notify_one();
+            }
+        }
+
+        JobRecord* TryAcquire(bool& stolen)
+        {
+            stolen = false;
+            if (IsWorkerThread())
+            {
+                if (JobRecord* record = PopLocal(*s_Scheduler.Queues[t_WorkerIndex])) return record;
+                JobRecord* record = Steal(t_WorkerIndex);
+                stolen = record != nullptr;
+                return record;
+            }
+
+            const uint32_t count = static_cast<uint32_t>(s_Scheduler.Queues.size());
+            return StealFrom(s_Scheduler.NextQueue.load(std::memory_order_relaxed), count);
+        }
+
+        void Dispatch(const Ref<TaskNode>& node);
+
+        void Complete(const Ref<TaskNode>& node)
+        {
+            Vector<Ref<TaskNode>> continuations;
+            {
+                std::lock_guard<std::mutex> lock(node->Mutex);
+                node->Work.Reset();
+                node->Finished = true;
+                continuations.swap(node->Continuations);
+            }
+
+            for (const auto& continuation : continuations)
+            {
+                if (continuation->Dependencies.fetch_sub(1) == 1)
+                    Dispatch(continuation);
+            }
+        }
+
+        void Dispatch(const Ref<TaskNode>& node)
+        {
+            if (!node->Work)
+            {
+                Complete(node);
+                return;
+            }
+
+            Enqueue([node]()
+            {
+                RunTask(node->Work);
+                Complete(node);
+            });
+        }
+
+        void AddEdge(const Ref<TaskNode>& node, TaskNode& antecedent)
+        {
+            std::lock_guard<std::mutex> lock(antecedent.Mutex);
+            if (antecedent.Finished) return;
+
+            node->Dependencies.fetch_add(1);
+            antecedent.Continuations.push_back(node);
+        }
+
+        void WorkerLoop(uint32_t index)
+        {
+            t_WorkerIndex = index;
+            WorkerQueue& own = *s_Scheduler.Queues[index];
+
+            // Touching the lease registers its thread-exit destructor, which may allocate, before
+            // the first job runs rather than in the middle of a steady-state batch.
+            static_cast<void>(t_JobSlab);
+
+            while (true)
+            {
+                JobRecord* record = PopLocal(own);
+                if (!record && (record = Steal(index)))
+                    own.Steals.fetch_add(1, std::memory_order_relaxed);
+
+                if (record)
+                {
+                    Execute(record);
+                    own.Executed.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+
+                // A try_lock may have skipped a busy victim, so only sleep once nothing is pending.
+                if (s_Scheduler.Pending.load() > 0)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                if (!s_Scheduler.Running.load())
+                    return;
+
+                const auto idleStart = std::chrono::steady_clock::now();
+                {
+                    std::unique_lock<std::mutex> lock(s_Scheduler.SleepMutex);
+                    s_Scheduler.Sleeping.fetch_add(1);
+                    s_Scheduler.WakeCondition.wait(lock, [] {
+                        return s_Scheduler.Pending.load() > 0 || !s_Scheduler.Running.load();
+                    });
+                    s_Scheduler.Sleeping.fetch_sub(1);
+                }
+                const auto idle = std::chrono::steady_clock::now() - idleStart;
+                own.IdleNanoseconds.fetch_add(
+                    static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(idle).count()),
+                    std::memory_order_relaxed);
+            }
+        }
+    }
 
     void TaskSystem::Init(uint32_t threadCount)
     {
@@ -42,7 +487,15 @@ namespace Mixture
 
         OPAL_INFO("Core/Threading", "Initializing TaskSystem with {} threads.", threadCount);
 
-        s_TaskQueue.Running = true;
+        s_Scheduler.Queues.clear();
+        for (uint32_t i = 0; i < threadCount; ++i)
+            s_Scheduler.Queues.push_back(CreateScope<WorkerQueue>());
+
+        s_Scheduler.Pending = 0;
+        s_Scheduler.Submitted = 0;
+        s_Scheduler.Helped = 0;
+        s_Scheduler.NextQueue = 0;
+        s_Scheduler.Running = true;
 
         try
         {
@@ -53,50 +506,23 @@ namespace Mixture
                     std::string threadName = "Worker Thread " + std::to_string(i);
                     Opal::LogRegistry::SetThreadName(threadName);
 
-                    while (true)
-                    {
-                        std::function<void()> task;
-                        {
-                            std::unique_lock<std::mutex> lock(s_TaskQueue.Mutex);
-                            s_TaskQueue.Condition.wait(lock, [] {
-                                return !s_TaskQueue.Queue.empty() || !s_TaskQueue.Running;
-                            });
-
-                            if (!s_TaskQueue.Running && s_TaskQueue.Queue.empty())
-                                return;
-
-                            if (s_TaskQueue.Queue.empty())
-                                continue;
-
-                            task = std::move(s_TaskQueue.Queue.front());
-                            s_TaskQueue.Queue.pop();
-                        }
-
-                        try
-                        {
-                            task();
-                        }
-                        catch (const std::exception& e)
-                        {
-                            OPAL_ERROR("Core/Threading", "Task threw exception: {}", e.what());
-                        }
-                        catch (...)
-                        {
-                            OPAL_ERROR("Core/Threading", "Task threw unknown exception!");
-                        }
-                    }
+                    WorkerLoop(i);
                 });
             }
         }
         catch (...)
         {
-            s_TaskQueue.Running = false;
-            s_TaskQueue.Condition.notify_all();
+            {
+                std::lock_guard<std::mutex> lock(s_Scheduler.SleepMutex);
+                s_Scheduler.Running = false;
+            }
+            s_Scheduler.WakeCondition.notify_all();
             for (auto& thread : s_Threads)
             {
                 if (thread.joinable()) thread.join();
             }
             s_Threads.clear();
+            s_Scheduler.Queues.clear();
             throw;
         }
 
@@ -109,11 +535,11 @@ namespace Mixture
         if (!s_Initialized) return;
 
         {
-            std::lock_guard<std::mutex> queueLock(s_TaskQueue.Mutex);
+            std::lock_guard<std::mutex> lock(s_Scheduler.SleepMutex);
             s_Initialized = false;
-            s_TaskQueue.Running = false;
+            s_Scheduler.Running = false;
         }
-        s_TaskQueue.Condition.notify_all();
+        s_Scheduler.WakeCondition.notify_all();
 
         for (auto& thread : s_Threads)
         {
@@ -122,6 +548,7 @@ namespace Mixture
         }
 
         s_Threads.clear();
+        s_Scheduler.Queues.clear();
         OPAL_INFO("Core/Threading", "TaskSystem Shutdown.");
     }
 
@@ -130,14 +557,132 @@ namespace Mixture
         return s_Initialized.load();
     }
 
-    void TaskSystem::Submit(std::function<void()> task)
+    void TaskSystem::Submit(Job task)
     {
+        Enqueue(std::move(task));
+    }
+
+    TaskSystem::Statistics TaskSystem::GetStatistics()
+    {
+        std::lock_guard<std::mutex> lifecycleLock(s_LifecycleMutex);
+
+        Statistics stats;
+        stats.WorkerCount = static_cast<uint32_t>(s_Scheduler.Queues.size());
+        stats.TasksSubmitted = s_Scheduler.Submitted.load(std::memory_order_relaxed);
+        stats.HelpedTasks = s_Scheduler.Helped.load(std::memory_order_relaxed);
+        stats.TasksExecuted = stats.HelpedTasks;
+        stats.QueueDepths.reserve(s_Scheduler.Queues.size());
+
+        for (const auto& queue : s_Scheduler.Queues)
         {
-            std::lock_guard<std::mutex> lock(s_TaskQueue.Mutex);
-            if (!s_Initialized || !s_TaskQueue.Running)
+            stats.TasksExecuted += queue->Executed.load(std::memory_order_relaxed);
+            stats.LocalSubmissions += queue->LocalSubmissions.load(std::memory_order_relaxed);
+            stats.Steals += queue->Steals.load(std::memory_order_relaxed);
+            stats.IdleNanoseconds += queue->IdleNanoseconds.load(std::memory_order_relaxed);
+
+            std::lock_guard<std::mutex> lock(queue->Mutex);
+            stats.QueueDepths.push_back(queue->Tasks.Size());
+        }
+
+        return stats;
+    }
+
+    bool TaskHandle::IsFinished() const
+    {
+        return !m_Node || m_Node->Finished.load();
+    }
+
+    TaskHandle TaskSystem::Schedule(Job task, std::span<const TaskHandle> dependencies)
+    {
+        if (!IsWorkerThread() && !s_Initialized)
+            throw std::runtime_error("Cannot submit a task while TaskSystem is stopped");
+
+        auto node = CreateRef<TaskNode>();
+        node->Work = std::move(task);
+        for (const TaskHandle& dependency : dependencies)
+        {
+            if (dependency.m_Node) AddEdge(node, *dependency.m_Node);
+        }
+
+        if (node->Dependencies.fetch_sub(1) == 1)
+            Dispatch(node);
+
+        return TaskHandle(node);
+    }
+
+    TaskHandle TaskSystem::ParallelFor(size_t count, size_t grain, std::function<void(size_t, size_t)> fn,
+        std::span<const TaskHandle> dependencies)
+    {
+        if (grain == 0) grain = 1;
+
+        // Chunks report to the join node directly instead of through edges, so a range
+        // costs one counter decrement per chunk and no continuation bookkeeping.
+        auto join = CreateRef<TaskNode>();
+        join->Dependencies = static_cast<uint32_t>((count + grain - 1) / grain) + 1;
+
+        auto body = CreateRef<std::function<void(size_t, size_t)>>(std::move(fn));
+        auto launch = [join, body, count, grain]()
+        {
+            for (size_t begin = 0; begin < count; begin += grain)
+            {
+                const size_t end = std::min(count, begin + grain);
+                Enqueue([join, body, begin, end]()
+                {
+                    RunTask([&]() { (*body)(begin, end); });
+                    if (join->Dependencies.fetch_sub(1) == 1) Complete(join);
+                });
+            }
+
+            if (join->Dependencies.fetch_sub(1) == 1) Complete(join);
+        };
+
+        bool ready = true;
+        for (const TaskHandle& dependency : dependencies)
+            ready = ready && dependency.IsFinished();
+
+        if (ready)
+        {
+            if (!IsWorkerThread() && !s_Initialized)
                 throw std::runtime_error("Cannot submit a task while TaskSystem is stopped");
-            s_TaskQueue.Queue.push(std::move(task));
+            launch();
+        }
+        else
+        {
+            Schedule(std::move(launch), dependencies);
+        }
+
+        return TaskHandle(join);
+    }
+
+    void TaskSystem::WaitAndHelp(const TaskHandle& handle)
+    {
+        if (handle.m_Node) HelpUntil(handle.m_Node->Finished);
+    }
+
+    void TaskSystem::HelpUntil(const std::atomic<bool>& done)
+    {
+        while (!done.load(std::memory_order_acquire))
+        {
+            bool stolen = false;
+            JobRecord* record = TryAcquire(stolen);
+            if (!record)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            Execute(record);
+
+            if (IsWorkerThread())
+            {
+                WorkerQueue& own = *s_Scheduler.Queues[t_WorkerIndex];
+                own.Executed.fetch_add(1, std::memory_order_relaxed);
+                if (stolen) own.Steals.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                s_Scheduler.Helped.fetch_add(1, std::memory_order_relaxed);
+            }
         }
-        s_TaskQueue.Condition.notify_one();
     }
 }
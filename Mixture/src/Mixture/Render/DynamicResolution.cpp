@@ -0,0 +1,64 @@
+#include "mxpch.hpp"
+#include "Mixture/Render/DynamicResolution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mixture
+{
+    void DynamicResolution::SetSettings(const Settings& settings)
+    {
+        if (!(settings.MinScale > 0.0f) || !(settings.MaxScale >= settings.MinScale))
+            throw std::invalid_argument("DynamicResolution needs 0 < MinScale <= MaxScale");
+        if (!(settings.TargetFrameTimeMs > 0.0f))
+            throw std::invalid_argument("DynamicResolution needs a positive target frame time");
+        if (!(settings.Smoothing > 0.0f) || settings.Smoothing > 1.0f)
+            throw std::invalid_argument("DynamicResolution smoothing must be in (0, 1]");
+
+        m_Settings = settings;
+        m_Scale = std::clamp(m_Scale, m_Settings.MinScale, m_Settings.MaxScale);
+    }
+
+    bool DynamicResolution::Update(float gpuFrameTimeMs)
+    {
+        if (!(gpuFrameTimeMs >= 0.0f)) return false;
+
+        // Frames recorded before the last change still resolve at the old scale.
+        if (m_SettleFramesLeft > 0)
+        {
+            --m_SettleFramesLeft;
+            return false;
+        }
+
+        m_SmoothedFrameTimeMs = m_SmoothedFrameTimeMs < 0.0f ? gpuFrameTimeMs
+            : m_SmoothedFrameTimeMs + (gpuFrameTimeMs - m_SmoothedFrameTimeMs) * m_Settings.Smoothing;
+
+        const float target = m_Settings.TargetFrameTimeMs;
+        const float frameTime = std::max(m_SmoothedFrameTimeMs, 0.001f);
+        if (std::abs(frameTime - target) <= target * m_Settings.Tolerance) return false;
+
+        float scale = m_Scale * std::sqrt(target / frameTime);
+        if (m_Settings.MaxStep > 0.0f)
+            scale = std::clamp(scale, m_Scale - m_Settings.MaxStep, m_Scale + m_Settings.MaxStep);
+
+        // Rounding down settles below the budget instead of oscillating around it.
+        if (m_Settings.Granularity > 0.0f)
+            scale = std::floor(scale / m_Settings.Granularity + 1e-4f) * m_Settings.Granularity;
+
+        scale = std::clamp(scale, m_Settings.MinScale, m_Settings.MaxScale);
+        if (scale == m_Scale) return false;
+
+        m_Scale = scale;
+        m_SmoothedFrameTimeMs = -1.0f;
+        m_SettleFramesLeft = m_Settings.SettleFrames;
+        return true;
+    }
+
+    void DynamicResolution::Reset()
+    {
+        m_Scale = m_Settings.MaxScale;
+        m_SmoothedFrameTimeMs = -1.0f;
+        m_SettleFramesLeft = 0;
+    }
+}
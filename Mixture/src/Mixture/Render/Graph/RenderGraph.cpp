@@ -1,17 +1,21 @@
 #include "mxpch.hpp"
 #include "Mixture/Render/Graph/RenderGraph.hpp"
 #include "Mixture/Render/RenderStats.hpp"
+#include "Mixture/Render/ResourceStateTracker.hpp"
 
 #include "Mixture/Core/Application.hpp"
+#include "Mixture/Core/Profiler.hpp"
+#include "Mixture/Core/Threading/TaskSystem.hpp"
 #include "Mixture/Render/RHI/IGraphicsContext.hpp"
 #include "Mixture/Render/RHI/IGraphicsDevice.hpp"
 
 #include <algorithm>
+#include <bit>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
-#include <queue>
+#include <mutex>
 #include <unordered_map>
-#include <unordered_set>
 #include <stdexcept>
 
 namespace Mixture
@@ -39,6 +43,8 @@ namespace Mixture
 
             void String(std::string_view value) { BeforeValue(); WriteString(value); }
             void Number(uint64_t value) { BeforeValue(); m_Output << value; }
+            void Decimal(double value) { BeforeValue(); m_Output << value; }
+            void Bool(bool value) { BeforeValue(); m_Output << (value ? "true" : "false"); }
 
         private:
             enum class Type { Object, Array };
@@ -109,9 +115,143 @@ namespace Mixture
         };
     }
 
+    namespace
+    {
+        struct AccessCounts
+        {
+            /** One past the largest valid resource ID any pass accesses. */
+            size_t ResourceSlots = 0;
+            size_t Reads = 0;
+            size_t Writes = 0;
+        };
+
+        AccessCounts CountAccesses(const Vector<RGPassNode>& passes)
+        {
+            AccessCounts counts;
+            const auto include = [&](RGResourceHandle handle)
+            {
+                if (handle.IsValid()) counts.ResourceSlots = std::max<size_t>(counts.ResourceSlots, static_cast<size_t>(handle.ID) + 1);
+            };
+
+            for (const auto& pass : passes)
+            {
+                for (const auto handle : pass.Reads) include(handle);
+                for (const auto& write : pass.Writes) include(write.Handle);
+                for (const auto handle : pass.BufferWrites) include(handle);
+                counts.Reads += pass.Reads.size();
+                counts.Writes += pass.Writes.size() + pass.BufferWrites.size();
+            }
+            return counts;
+        }
+
+        /** Fixed-size bitset over dense indices. */
+        class DenseBitset
+        {
+        public:
+            explicit DenseBitset(size_t size) : m_Words((size + 63) / 64, 0) {}
+
+            bool Test(size_t index) const { return (m_Words[index / 64] >> (index % 64)) & 1u; }
+            void Set(size_t index) { m_Words[index / 64] |= uint64_t{ 1 } << (index % 64); }
+            void Reset(size_t index) { m_Words[index / 64] &= ~(uint64_t{ 1 } << (index % 64)); }
+
+            /** Returns the first set index at or after @p from, or the bit count rounded up to words if none is set. */
+            size_t FindFirst(size_t from) const
+            {
+                size_t word = from / 64;
+                if (word >= m_Words.size()) return m_Words.size() * 64;
+
+                uint64_t bits = m_Words[word] & (~uint64_t{ 0 } << (from % 64));
+                while (bits == 0)
+                {
+                    if (++word == m_Words.size()) return m_Words.size() * 64;
+                    bits = m_Words[word];
+                }
+                return word * 64 + static_cast<size_t>(std::countr_zero(bits));
+            }
+
+        private:
+            Vector<uint64_t> m_Words;
+        };
+
+        /** Transition one texture subresource needs, merged with equal neighbours before it is emitted. */
+        struct SubresourceTransition
+        {
+            uint16_t Mip = 0;
+            uint16_t Layer = 0;
+            RHI::ResourceState Before = RHI::ResourceState::Undefined;
+            RHI::QueueType SourceQueue = RHI::QueueType::Graphics;
+            /** Pass on another queue that releases the subresource, or -1. */
+            int32_t ReleasingPass = -1;
+            /** Pass after which a split transition starts, or -1. */
+            int32_t SplitAfterPass = -1;
+
+            bool Matches(const SubresourceTransition& other) const
+            {
+                return Before == other.Before && SourceQueue == other.SourceQueue &&
+                    ReleasingPass == other.ReleasingPass && SplitAfterPass == other.SplitAfterPass;
+            }
+        };
+
+        /**
+         * Merges the transitions of a texture with @p mips x @p layers subresources into as few
+         * rectangles of mips and layers as a greedy sweep finds: runs of equal neighbouring layers
+         * first, then extended over consecutive mips. @p emit receives the first transition of
+         * every rectangle and a handle addressing it in the canonical form of ResolveSubresources.
+         *
+         * @param transitions Transitions in mip-major order, at most one per subresource.
+         * @param lookup Scratch storage reused between calls.
+         */
+        template<typename EmitFn>
+        void MergeSubresourceTransitions(RGResourceHandle resource, uint32_t mips, uint32_t layers,
+            const Vector<SubresourceTransition>& transitions, Vector<uint32_t>& lookup, EmitFn&& emit)
+        {
+            constexpr uint32_t Unset = ~0u;
+            lookup.assign(static_cast<size_t>(mips) * layers, Unset);
+            for (uint32_t index = 0; index < transitions.size(); ++index)
+            {
+                lookup[static_cast<size_t>(transitions[index].Mip) * layers + transitions[index].Layer] = index;
+            }
+
+            // Merged subresources are removed from the lookup, which also marks them as emitted.
+            const auto matches = [&](const SubresourceTransition& first, uint32_t mip, uint32_t layer)
+            {
+                const uint32_t index = lookup[static_cast<size_t>(mip) * layers + layer];
+                return index != Unset && transitions[index].Matches(first);
+            };
+
+            for (uint32_t index = 0; index < transitions.size(); ++index)
+            {
+                const auto& first = transitions[index];
+                if (lookup[static_cast<size_t>(first.Mip) * layers + first.Layer] != index) continue;
+
+                uint32_t layerEnd = first.Layer + 1u;
+                while (layerEnd < layers && matches(first, first.Mip, layerEnd)) ++layerEnd;
+
+                uint32_t mipEnd = first.Mip + 1u;
+                while (mipEnd < mips)
+                {
+                    bool rowMatches = true;
+                    for (uint32_t layer = first.Layer; layer < layerEnd && rowMatches; ++layer) rowMatches = matches(first, mipEnd, layer);
+                    if (!rowMatches) break;
+                    ++mipEnd;
+                }
+
+                for (uint32_t mip = first.Mip; mip < mipEnd; ++mip)
+                {
+                    for (uint32_t layer = first.Layer; layer < layerEnd; ++layer) lookup[static_cast<size_t>(mip) * layers + layer] = Unset;
+                }
+
+                const bool allMips = first.Mip == 0 && mipEnd == mips;
+                const bool allLayers = first.Layer == 0 && layerEnd == layers;
+                emit(first, resource.Mips(first.Mip, allMips ? 0 : static_cast<uint16_t>(mipEnd - first.Mip))
+                    .Layers(first.Layer, allLayers ? 0 : static_cast<uint16_t>(layerEnd - first.Layer)));
+            }
+        }
+    }
+
     void RenderGraphAlgorithms::CullPasses(Vector<RGPassNode>& passes, const Vector<RGResourceNode>& resources)
     {
-        std::unordered_set<RGResourceHandle::IDType> requiredResources;
+        DenseBitset requiredResources(CountAccesses(passes).ResourceSlots);
         Vector<bool> livePasses(passes.size(), false);
 
         auto isImported = [&](RGResourceHandle handle)
@@ -123,7 +263,18 @@ namespace Mixture
 
         auto isRequired = [&](RGResourceHandle handle)
         {
-            return handle.IsValid() && requiredResources.contains(handle.ID);
+            return handle.IsValid() && requiredResources.Test(handle.ID);
+        };
+
+        // Only a write of every subresource replaces the whole contents; earlier writers of the
+        // mips or layers it leaves alone are still required.
+        auto coversResource = [&](RGResourceHandle handle)
+        {
+            if (handle.IsWholeResource()) return true;
+            if (handle.ID >= resources.size()) return false;
+            const RHI::TextureDesc& desc = resources[handle.ID].TextureDesc;
+            return handle.BaseMip == 0 && (handle.MipCount == 0 || handle.MipCount >= desc.MipLevels)
+                && handle.BaseLayer == 0 && (handle.LayerCount == 0 || handle.LayerCount >= desc.ArrayLayers);
         };
 
         for (size_t passIndex = passes.size(); passIndex-- > 0;)
@@ -154,33 +305,30 @@ namespace Mixture
             // The latest live writer satisfies the downstream requirement.
             for (const auto& write : pass.Writes)
             {
-                requiredResources.erase(write.Handle.ID);
-                if (write.LoadOp == RHI::LoadOp::Load)
-                {
-                    requiredResources.insert(write.Handle.ID);
-                }
+                if (!write.Handle.IsValid()) continue;
+                if (write.LoadOp == RHI::LoadOp::Load) requiredResources.Set(write.Handle.ID);
+                else if (coversResource(write.Handle)) requiredResources.Reset(write.Handle.ID);
             }
             for (const auto handle : pass.BufferWrites)
             {
-                requiredResources.erase(handle.ID);
+                if (handle.IsValid()) requiredResources.Reset(handle.ID);
             }
 
             for (const auto handle : pass.Reads)
             {
-                if (handle.IsValid()) requiredResources.insert(handle.ID);
+                if (handle.IsValid()) requiredResources.Set(handle.ID);
             }
         }
 
-        Vector<RGPassNode> culledPasses;
-        culledPasses.reserve(passes.size());
+        // Compact the live passes in place, keeping their relative order.
+        size_t liveCount = 0;
         for (size_t passIndex = 0; passIndex < passes.size(); ++passIndex)
         {
-            if (livePasses[passIndex])
-            {
-                culledPasses.push_back(std::move(passes[passIndex]));
-            }
+            if (!livePasses[passIndex]) continue;
+            if (liveCount != passIndex) passes[liveCount] = std::move(passes[passIndex]);
+            ++liveCount;
         }
-        passes = std::move(culledPasses);
+        passes.erase(passes.begin() + static_cast<std::ptrdiff_t>(liveCount), passes.end());
     }
 
     bool RenderGraphAlgorithms::SortPasses(Vector<RGPassNode>& passes)
@@ -188,61 +336,71 @@ namespace Mixture
         const size_t passCount = passes.size();
         if (passCount < 2) return true;
 
-        Vector<Vector<size_t>> adjacencyList(passCount);
-        Vector<std::unordered_set<size_t>> adjacencySets(passCount);
-        Vector<size_t> inDegree(passCount, 0);
-
-        std::unordered_map<RGResourceHandle::IDType, size_t> lastWriters;
-        std::unordered_map<RGResourceHandle::IDType, Vector<size_t>> readersSinceLastWrite;
+        constexpr uint32_t None = std::numeric_limits<uint32_t>::max();
+        const AccessCounts accesses = CountAccesses(passes);
 
-        auto addDependency = [&](size_t before, size_t after)
+        // Hazard tracking indexed by resource ID. Readers since the last write form a
+        // per-resource linked list in one flat node array, newest reader first.
+        struct ReaderNode
         {
-            if (before == after) return;
+            uint32_t Pass;
+            uint32_t Next;
+        };
+        Vector<uint32_t> lastWriters(accesses.ResourceSlots, None);
+        Vector<uint32_t> readerHeads(accesses.ResourceSlots, None);
+        Vector<ReaderNode> readerNodes;
+        readerNodes.reserve(accesses.Reads);
+
+        // Edges are discovered while visiting their later pass, so a per-pass stamp on the
+        // earlier pass is enough to drop duplicates.
+        // Every access adds at most one edge except write-after-read fan-in, so this rarely grows.
+        Vector<std::pair<uint32_t, uint32_t>> edges;
+        edges.reserve(accesses.Reads + accesses.Writes);
+        Vector<uint32_t> dependencyStamps(passCount, None);
+        Vector<uint32_t> inDegree(passCount, 0);
+
+        auto addDependency = [&](uint32_t before, uint32_t after)
+        {
+            if (before == after || dependencyStamps[before] == after) return;
 
-            if (adjacencySets[before].insert(after).second)
-            {
-                adjacencyList[before].push_back(after);
-                ++inDegree[after];
-            }
+            dependencyStamps[before] = after;
+            edges.emplace_back(before, after);
+            ++inDegree[after];
         };
 
-        auto registerRead = [&](RGResourceHandle handle, size_t passIndex)
+        auto registerRead = [&](RGResourceHandle handle, uint32_t passIndex)
         {
-            const auto writer = lastWriters.find(handle.ID);
-            if (writer != lastWriters.end())
-            {
-                // Read-after-write (RAW).
-                addDependency(writer->second, passIndex);
-            }
+            if (!handle.IsValid()) return;
 
-            auto& readers = readersSinceLastWrite[handle.ID];
-            if (std::find(readers.begin(), readers.end(), passIndex) == readers.end())
-            {
-                readers.push_back(passIndex);
-            }
+            // Read-after-write (RAW).
+            if (lastWriters[handle.ID] != None) addDependency(lastWriters[handle.ID], passIndex);
+
+            // A pass registers all of its reads before the next pass, so a repeated read
+            // of the same resource finds itself at the head of the list.
+            uint32_t& head = readerHeads[handle.ID];
+            if (head != None && readerNodes[head].Pass == passIndex) return;
+            readerNodes.push_back({ passIndex, head });
+            head = static_cast<uint32_t>(readerNodes.size() - 1);
         };
 
-        auto registerWrite = [&](RGResourceHandle handle, size_t passIndex)
+        auto registerWrite = [&](RGResourceHandle handle, uint32_t passIndex)
         {
-            const auto writer = lastWriters.find(handle.ID);
-            if (writer != lastWriters.end())
-            {
-                // Write-after-write (WAW).
-                addDependency(writer->second, passIndex);
-            }
+            if (!handle.IsValid()) return;
+
+            // Write-after-write (WAW).
+            if (lastWriters[handle.ID] != None) addDependency(lastWriters[handle.ID], passIndex);
 
-            auto& readers = readersSinceLastWrite[handle.ID];
-            for (const size_t reader : readers)
+            // Write-after-read (WAR).
+            for (uint32_t node = readerHeads[handle.ID]; node != None; node = readerNodes[node].Next)
             {
-                // Write-after-read (WAR).
-                addDependency(reader, passIndex);
+                addDependency(readerNodes[node].Pass, passIndex);
             }
-            readers.clear();
+            readerHeads[handle.ID] = None;
 
             lastWriters[handle.ID] = passIndex;
         };
 
-        for (size_t passIndex = 0; passIndex < passCount; ++passIndex)
+        for (uint32_t passIndex = 0; passIndex < passCount; ++passIndex)
         {
             const auto& pass = passes[passIndex];
 
@@ -260,41 +418,71 @@ namespace Mixture
             }
         }
 
+        // Compressed adjacency: the dependents of pass i are dependents[offsets[i], offsets[i + 1]).
+        Vector<uint32_t> offsets(passCount + 1, 0);
+        for (const auto& edge : edges) ++offsets[edge.first + 1];
+        for (size_t passIndex = 0; passIndex < passCount; ++passIndex) offsets[passIndex + 1] += offsets[passIndex];
+
+        Vector<uint32_t> dependents(edges.size());
+        Vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (const auto& edge : edges) dependents[fill[edge.first]++] = edge.second;
+
         // Always choose the earliest declared ready pass. This keeps independent
-        // passes stable while still honoring every resource dependency.
-        std::priority_queue<size_t, Vector<size_t>, std::greater<size_t>> readyPasses;
+        // passes stable while still honoring every resource dependency. The ready
+        // set is a bitset and the cursor only moves back when a dependency resolves
+        // for an earlier pass, which declaration-ordered hazards never produce.
+        DenseBitset readyPasses(passCount);
         for (size_t passIndex = 0; passIndex < passCount; ++passIndex)
         {
-            if (inDegree[passIndex] == 0) readyPasses.push(passIndex);
+            if (inDegree[passIndex] == 0) readyPasses.Set(passIndex);
         }
 
-        Vector<size_t> sortedIndices;
+        Vector<uint32_t> sortedIndices;
         sortedIndices.reserve(passCount);
 
-        while (!readyPasses.empty())
+        size_t cursor = 0;
+        while (true)
         {
-            const size_t passIndex = readyPasses.top();
-            readyPasses.pop();
-            sortedIndices.push_back(passIndex);
+            const size_t passIndex = readyPasses.FindFirst(cursor);
+            if (passIndex >= passCount) break;
 
-            for (const size_t dependentPass : adjacencyList[passIndex])
+            readyPasses.Reset(passIndex);
+            sortedIndices.push_back(static_cast<uint32_t>(passIndex));
+            cursor = passIndex;
+
+            for (uint32_t edge = offsets[passIndex]; edge < offsets[passIndex + 1]; ++edge)
             {
+                const uint32_t dependentPass = dependents[edge];
                 if (--inDegree[dependentPass] == 0)
                 {
-                    readyPasses.push(dependentPass);
+                    readyPasses.Set(dependentPass);
+                    cursor = std::min<size_t>(cursor, dependentPass);
                 }
             }
         }
 
         if (sortedIndices.size() != passCount) return false;
 
-        Vector<RGPassNode> sortedPasses;
-        sortedPasses.reserve(passCount);
-        for (const size_t passIndex : sortedIndices)
+        // Apply the permutation in place by following its cycles; an unchanged order moves nothing.
+        for (size_t start = 0; start < passCount; ++start)
         {
-            sortedPasses.push_back(std::move(passes[passIndex]));
+            if (sortedIndices[start] == None || sortedIndices[start] == start) continue;
+
+            RGPassNode displaced = std::move(passes[start]);
+            size_t target = start;
+            while (true)
+            {
+                const size_t source = sortedIndices[target];
+                sortedIndices[target] = None;
+                if (source == start)
+                {
+                    passes[target] = std::move(displaced);
+                    break;
+                }
+                passes[target] = std::move(passes[source]);
+                target = source;
+            }
         }
-        passes = std::move(sortedPasses);
         return true;
     }
 
@@ -306,6 +494,7 @@ namespace Mixture
         {
             resource.FirstPassIndex = -1;
             resource.LastPassIndex = -1;
+            resource.UsedByAsyncQueue = false;
         }
 
         auto updateResource = [&](RGResourceHandle handle, int32_t passIndex)
@@ -315,6 +504,7 @@ namespace Mixture
             auto& resource = resources[handle.ID];
             if (resource.FirstPassIndex == -1) resource.FirstPassIndex = passIndex;
             resource.LastPassIndex = passIndex;
+            if (passes[passIndex].Queue != RHI::QueueType::Graphics) resource.UsedByAsyncQueue = true;
         };
 
         for (int32_t passIndex = 0; passIndex < static_cast<int32_t>(passes.size()); ++passIndex)
@@ -326,24 +516,376 @@ namespace Mixture
         }
     }
 
+    uint32_t RenderGraphAlgorithms::CalculateDependencyLevels(Vector<RGPassNode>& passes)
+    {
+        // First level on which a pass may touch the resource again: after its last
+        // writer for reads, and additionally after every reader since then for writes.
+        std::unordered_map<RGResourceHandle::IDType, uint32_t> readReadyLevels;
+        std::unordered_map<RGResourceHandle::IDType, uint32_t> writeReadyLevels;
+        uint32_t levelCount = 0;
+
+        auto readyLevel = [](const auto& levels, RGResourceHandle handle)
+        {
+            const auto level = levels.find(handle.ID);
+            return level != levels.end() ? level->second : 0u;
+        };
+
+        for (auto& pass : passes)
+        {
+            uint32_t level = 0;
+            for (const auto handle : pass.Reads)
+                level = std::max(level, readyLevel(readReadyLevels, handle));
+            for (const auto& write : pass.Writes)
+                level = std::max(level, readyLevel(writeReadyLevels, write.Handle));
+            for (const auto handle : pass.BufferWrites)
+                level = std::max(level, readyLevel(writeReadyLevels, handle));
+
+            pass.DependencyLevel = level;
+            levelCount = std::max(levelCount, level + 1);
+
+            for (const auto handle : pass.Reads)
+            {
+                auto& writeReady = writeReadyLevels[handle.ID];
+                writeReady = std::max(writeReady, level + 1);
+            }
+
+            auto registerWrite = [&](RGResourceHandle handle)
+            {
+                readReadyLevels[handle.ID] = level + 1;
+                writeReadyLevels[handle.ID] = level + 1;
+            };
+            for (const auto& write : pass.Writes) registerWrite(write.Handle);
+            for (const auto handle : pass.BufferWrites) registerWrite(handle);
+        }
+        return levelCount;
+    }
+
+    Vector<RGSubmission> RenderGraphAlgorithms::BuildSubmissions(const Vector<RGPassNode>& passes)
+    {
+        Vector<RGSubmission> submissions;
+        Vector<uint32_t> submissionOfPass(passes.size(), 0);
+        std::unordered_map<RHI::QueueType, uint32_t> openSubmissions;
+
+        auto alreadyWaits = [&](const RGSubmission& submission, uint32_t dependency)
+        {
+            // Waiting on a later submission of the same queue implies waiting on this one.
+            const RHI::QueueType queue = submissions[dependency].Queue;
+            return std::any_of(submission.WaitSubmissions.begin(), submission.WaitSubmissions.end(),
+                [&](uint32_t wait) { return submissions[wait].Queue == queue && wait >= dependency; });
+        };
+
+        for (uint32_t passIndex = 0; passIndex < static_cast<uint32_t>(passes.size()); ++passIndex)
+        {
+            const auto& pass = passes[passIndex];
+
+            // Work another queue waits for has to be submitted before the wait, so the
+            // submission containing a dependency cannot grow any further.
+            for (const uint32_t dependency : pass.QueueDependencies)
+            {
+                const uint32_t dependencySubmission = submissionOfPass[dependency];
+                const auto open = openSubmissions.find(submissions[dependencySubmission].Queue);
+                if (open != openSubmissions.end() && open->second == dependencySubmission)
+                    openSubmissions.erase(open);
+            }
+
+            auto open = openSubmissions.find(pass.Queue);
+            const bool needsNewWait = open != openSubmissions.end() && std::any_of(
+                pass.QueueDependencies.begin(), pass.QueueDependencies.end(),
+                [&](uint32_t dependency) { return !alreadyWaits(submissions[open->second], submissionOfPass[dependency]); });
+
+            if (open == openSubmissions.end() || needsNewWait)
+            {
+                auto& submission = submissions.emplace_back();
+                submission.Queue = pass.Queue;
+                open = openSubmissions.insert_or_assign(pass.Queue, static_cast<uint32_t>(submissions.size() - 1)).first;
+            }
+
+            auto& submission = submissions[open->second];
+            for (const uint32_t dependency : pass.QueueDependencies)
+            {
+                if (!alreadyWaits(submission, submissionOfPass[dependency]))
+                    submission.WaitSubmissions.push_back(submissionOfPass[dependency]);
+            }
+            submission.Passes.push_back(passIndex);
+            submissionOfPass[passIndex] = open->second;
+        }
+        return submissions;
+    }
+
+    uint32_t RenderGraphAlgorithms::MergeRenderPasses(Vector<RGPassNode>& passes, const Vector<RGSubmission>& submissions)
+    {
+        Vector<uint32_t> submissionOfPass(passes.size(), 0);
+        for (uint32_t submissionIndex = 0; submissionIndex < static_cast<uint32_t>(submissions.size()); ++submissionIndex)
+        {
+            for (const uint32_t passIndex : submissions[submissionIndex].Passes) submissionOfPass[passIndex] = submissionIndex;
+        }
+
+        auto writesAttachment = [](const RGPassNode& pass, RGResourceHandle handle)
+        {
+            return std::any_of(pass.Writes.begin(), pass.Writes.end(),
+                [&](const RGAttachmentInfo& write) { return write.Handle.HasSameSubresources(handle); });
+        };
+
+        auto continuesScope = [&](size_t passIndex)
+        {
+            const auto& previous = passes[passIndex - 1];
+            const auto& pass = passes[passIndex];
+            if (!previous.Execute || !pass.Execute || previous.Writes.empty()) return false;
+            if (previous.Queue != RHI::QueueType::Graphics || pass.Queue != RHI::QueueType::Graphics) return false;
+            if (submissionOfPass[passIndex - 1] != submissionOfPass[passIndex]) return false;
+
+            // Events and ownership transfers cannot be recorded inside a rendering scope.
+            if (!previous.SplitBarrierBegins.empty() || !previous.ReleaseBarriers.empty() || !pass.QueueDependencies.empty())
+                return false;
+
+            if (pass.Writes.size() != previous.Writes.size()) return false;
+            for (const auto& write : pass.Writes)
+            {
+                if (write.LoadOp != RHI::LoadOp::Load || !writesAttachment(previous, write.Handle)) return false;
+            }
+            return std::all_of(pass.Barriers.begin(), pass.Barriers.end(), [&](const RGBarrier& barrier)
+            {
+                return barrier.Split == RGBarrier::NoSplit && barrier.Before == barrier.After &&
+                    writesAttachment(previous, barrier.Resource);
+            });
+        };
+
+        uint32_t mergedCount = 0;
+        for (size_t passIndex = 0; passIndex < passes.size(); ++passIndex)
+        {
+            auto& pass = passes[passIndex];
+            pass.MergedWithPrevious = passIndex > 0 && continuesScope(passIndex);
+            pass.MergedWithNext = false;
+            if (!pass.MergedWithPrevious) continue;
+
+            passes[passIndex - 1].MergedWithNext = true;
+            pass.Barriers.clear();
+            ++mergedCount;
+        }
+        return mergedCount;
+    }
+
+    uint32_t RenderGraphAlgorithms::ResolveAttachmentOps(Vector<RGPassNode>& passes, Vector<RGResourceNode>& resources)
+    {
+        for (auto& resource : resources) resource.Memoryless = false;
+
+        uint32_t memorylessCount = 0;
+        for (size_t first = 0; first < passes.size();)
+        {
+            size_t last = first;
+            while (passes[last].MergedWithNext) ++last;
+            const int32_t scopeBegin = static_cast<int32_t>(first);
+            const int32_t scopeEnd = static_cast<int32_t>(last);
+
+            auto readInScope = [&](RGResourceHandle handle)
+            {
+                for (size_t passIndex = first; passIndex <= last; ++passIndex)
+                {
+                    const auto& reads = passes[passIndex].Reads;
+                    if (std::find(reads.begin(), reads.end(), handle) != reads.end()) return true;
+                }
+                return false;
+            };
+
+            // Only the pass opening the scope binds attachments. Imported resources and
+            // textures with an initial state carry contents from outside the graph.
+            for (auto& write : passes[first].Writes)
+            {
+                auto& resource = resources[write.Handle.ID];
+                if (resource.Type != RGResourceType::Texture) continue;
+
+                const bool bornInScope = resource.FirstPassIndex == scopeBegin &&
+                    resource.TextureDesc.InitialState == RHI::ResourceState::Undefined;
+                const bool deadAfterScope = resource.LastPassIndex <= scopeEnd;
+
+                if (bornInScope && write.LoadOp == RHI::LoadOp::Load) write.LoadOp = RHI::LoadOp::DontCare;
+                if (deadAfterScope && write.StoreOp == RHI::StoreOp::Store) write.StoreOp = RHI::StoreOp::DontCare;
+
+                if (bornInScope && deadAfterScope && !readInScope(write.Handle))
+                {
+                    resource.Memoryless = true;
+                    ++memorylessCount;
+                }
+            }
+            first = last + 1;
+        }
+        return memorylessCount;
+    }
+
+    RenderGraph::~RenderGraph()
+    {
+        RunArenaFinalizers();
+
+        // The persistent textures die with the graph, so their tracked states go too.
+        auto& tracker = ResourceStateTracker::Get();
+        for (const auto& entry : m_PersistentResources)
+        {
+            for (const auto& texture : entry.Textures) tracker.SetState(texture.get(), RHI::ResourceState::Undefined);
+        }
+    }
+
     void RenderGraph::Clear()
     {
+        RunArenaFinalizers();
         m_PassAllocator.Reset();
-        m_Passes.clear();
+        RecyclePasses(m_Passes);
         m_Resources.clear();
-        m_ResourceLookup.clear();
-        m_Aliases.clear();
-        m_ResourcesEndingAtPass.clear();
+        std::fill(m_ResourceLookup.begin(), m_ResourceLookup.end(), RGResourceHandle());
+        std::fill(m_AliasTargets.begin(), m_AliasTargets.end(), InvalidNameID);
+        m_AliasesResolved = false;
         m_Registry.Clear();
-        // Note: m_Cache is NOT cleared here, to support persistence across frames.
+        m_PersistentBindings.clear();
+        // Note: m_Cache, the persistent textures and the compiled schedule (including
+        // m_ResourcesEndingAtPass) are NOT cleared here, to support persistence across frames.
+
+        // More frames than can be in flight have passed since these were last used.
+        ++m_FrameNumber;
+        std::erase_if(m_RetiredPersistentTextures, [this](const auto& retired) { return m_FrameNumber - retired.first > 3; });
+    }
+
+    void RenderGraph::RunArenaFinalizers()
+    {
+        for (auto it = m_ArenaFinalizers.rbegin(); it != m_ArenaFinalizers.rend(); ++it)
+        {
+            it->Destroy(it->Object);
+        }
+        m_ArenaFinalizers.clear();
+    }
+
+    void RenderGraph::RecyclePasses(Vector<RGPassNode>& passes)
+    {
+        // Execute callbacks point into the arena, so they are dropped right away;
+        // the dependency lists are only emptied once the node is acquired again.
+        for (auto& pass : passes)
+        {
+            pass.Execute = nullptr;
+            m_PassPool.push_back(std::move(pass));
+        }
+        passes.clear();
+    }
+
+    RGPassNode& RenderGraph::AcquirePassNode(std::string_view name)
+    {
+        const std::string_view internedName = InternName(RGResourceName(name)).second;
+        if (m_PassPool.empty())
+        {
+            auto& pass = m_Passes.emplace_back();
+            pass.Name = internedName;
+            return pass;
+        }
+
+        auto& pass = m_Passes.emplace_back(std::move(m_PassPool.back()));
+        m_PassPool.pop_back();
+
+        pass.Name = internedName;
+        pass.Reads.clear();
+        pass.Writes.clear();
+        pass.BufferWrites.clear();
+        pass.Barriers.clear();
+        pass.ReleaseBarriers.clear();
+        pass.SplitBarrierBegins.clear();
+        pass.QueueDependencies.clear();
+        pass.Queue = RHI::QueueType::Graphics;
+        pass.HasSideEffects = false;
+        pass.MergedWithPrevious = false;
+        pass.MergedWithNext = false;
+        pass.DeclarationIndex = 0;
+        pass.DependencyLevel = 0;
+        return pass;
+    }
+
+    uint32_t RenderGraph::FindNameID(uint64_t hash) const
+    {
+        const size_t mask = m_NameSlots.size() - 1;
+        for (size_t slot = hash & mask;; slot = (slot + 1) & mask)
+        {
+            const NameSlot& entry = m_NameSlots[slot];
+            if (entry.ID == InvalidNameID || entry.Hash == hash) return entry.ID;
+        }
+    }
+
+    std::pair<uint32_t, std::string_view> RenderGraph::InternName(const RGResourceName& name)
+    {
+        const uint32_t existing = FindNameID(name.Hash);
+        if (existing != InvalidNameID)
+        {
+            // Lookups trust the 64-bit hash, so two names sharing one must be caught here.
+            if (m_Names[existing] != name.Name)
+                throw std::invalid_argument("Render-graph names '" + m_Names[existing] + "' and '" +
+                    std::string(name.Name) + "' have the same hash");
+            return { existing, m_Names[existing] };
+        }
+
+        // Keep the table at most half full so probe sequences stay short.
+        if ((m_Names.size() + 1) * 2 > m_NameSlots.size())
+        {
+            Vector<NameSlot> slots(m_NameSlots.size() * 2);
+            const size_t mask = slots.size() - 1;
+            for (const NameSlot& entry : m_NameSlots)
+            {
+                if (entry.ID == InvalidNameID) continue;
+                size_t slot = entry.Hash & mask;
+                while (slots[slot].ID != InvalidNameID) slot = (slot + 1) & mask;
+                slots[slot] = entry;
+            }
+            m_NameSlots = std::move(slots);
+        }
+
+        const uint32_t id = static_cast<uint32_t>(m_Names.size());
+        const size_t mask = m_NameSlots.size() - 1;
+        size_t slot = name.Hash & mask;
+        while (m_NameSlots[slot].ID != InvalidNameID) slot = (slot + 1) & mask;
+        m_NameSlots[slot] = { name.Hash, id };
+
+        m_Names.emplace_back(name.Name);
+        m_ResourceLookup.push_back(RGResourceHandle());
+        m_AliasTargets.push_back(InvalidNameID);
+        m_PersistentLookup.push_back(InvalidNameID);
+        return { id, m_Names.back() };
+    }
+
+    void RenderGraph::ResolveAliases() const
+    {
+        m_ResolvedAliases.resize(m_AliasTargets.size());
+        for (uint32_t id = 0; id < m_AliasTargets.size(); ++id)
+        {
+            // A chain longer than the number of names can only be a cycle, which resolves to nothing.
+            uint32_t current = id;
+            size_t step = 0;
+            for (; step <= m_AliasTargets.size() && m_AliasTargets[current] != InvalidNameID; ++step)
+                current = m_AliasTargets[current];
+            m_ResolvedAliases[id] = step > m_AliasTargets.size() ? InvalidNameID : current;
+        }
+        m_AliasesResolved = true;
     }
 
     void RenderGraph::Compile()
     {
+        MX_PROFILE_SCOPE("RenderGraph::Compile");
+        for (size_t passIndex = 0; passIndex < m_Passes.size(); ++passIndex)
+        {
+            m_Passes[passIndex].DeclarationIndex = static_cast<uint32_t>(passIndex);
+        }
+
+        // Comparing the whole key costs no more than hashing it, and a hash collision cannot replay a wrong schedule.
+        BuildTopologyKey(m_TopologyKey);
+        if (m_Compiled.Valid && m_Compiled.TopologyKey == m_TopologyKey)
+        {
+            ++m_CompileStats.CacheHits;
+            ReplayCompiledGraph();
+            return;
+        }
+
+        ++m_CompileStats.CacheMisses;
+
         CullPasses();
-        SortPasses();
+        const bool sorted = SortPasses();
         CalculateLifetimes();
         CalculateBarriers();
+        CalculateDependencyLevels();
+        m_Submissions = RenderGraphAlgorithms::BuildSubmissions(m_Passes);
+        m_MergedPassCount = m_RenderPassMerging ? RenderGraphAlgorithms::MergeRenderPasses(m_Passes, m_Submissions) : 0;
+        m_MemorylessResourceCount = RenderGraphAlgorithms::ResolveAttachmentOps(m_Passes, m_Resources);
 
         m_ResourcesEndingAtPass.clear();
         m_ResourcesEndingAtPass.resize(m_Passes.size());
@@ -355,14 +897,164 @@ namespace Mixture
                 m_ResourcesEndingAtPass[static_cast<size_t>(node.LastPassIndex)].push_back(node.Handle);
             }
         }
+
+        // A failed sort is reported again on the next frame instead of being replayed.
+        m_Compiled.Valid = false;
+        if (sorted) StoreCompiledGraph();
+    }
+
+    void RenderGraph::BuildTopologyKey(Vector<uint64_t>& key) const
+    {
+        key.clear();
+        const auto append = [&key](auto... values) { (key.push_back(static_cast<uint64_t>(values)), ...); };
+        append(m_Passes.size(), m_Resources.size());
+
+        for (const auto& node : m_Resources)
+        {
+            append(node.Type);
+            if (node.Type == RGResourceType::Texture || node.Type == RGResourceType::ImportedTexture)
+            {
+                // Compiling does not depend on the extent passes render at, so a scaled
+                // resource keeps the schedule while the render scale changes.
+                const bool scaled = node.AllocationWidth != 0;
+                append(scaled ? node.AllocationWidth : node.TextureDesc.Width,
+                    scaled ? node.AllocationHeight : node.TextureDesc.Height, node.TextureDesc.PixelFormat,
+                    node.TextureDesc.InitialState, node.TextureDesc.Usage,
+                    node.TextureDesc.MipLevels, node.TextureDesc.ArrayLayers);
+            }
+            else
+            {
+                append(node.BufferDesc.Size, node.BufferDesc.Usage, node.BufferInitialState);
+            }
+            append(node.FinalState);
+        }
+
+        for (const auto& pass : m_Passes)
+        {
+            // Pass names are interned at stable addresses, so the address identifies the name.
+            append(reinterpret_cast<uintptr_t>(pass.Name.data()), pass.HasSideEffects, pass.Queue,
+                pass.Reads.size(), pass.Writes.size(), pass.BufferWrites.size());
+            const auto appendHandle = [&](RGResourceHandle handle)
+            {
+                append(handle.ID, handle.BaseMip, handle.MipCount, handle.BaseLayer, handle.LayerCount);
+            };
+            for (const auto handle : pass.Reads) appendHandle(handle);
+            for (const auto& write : pass.Writes)
+            {
+                appendHandle(write.Handle);
+                append(write.LoadOp, write.StoreOp);
+            }
+            for (const auto handle : pass.BufferWrites) append(handle.ID);
+        }
+    }
+
+    void RenderGraph::StoreCompiledGraph()
+    {
+        m_Compiled.Valid = true;
+        m_Compiled.TopologyKey = m_TopologyKey;
+
+        m_Compiled.Passes.clear();
+        for (const auto& pass : m_Passes)
+        {
+            auto& compiled = m_Compiled.Passes.emplace_back();
+            compiled.DeclarationIndex = pass.DeclarationIndex;
+            compiled.DependencyLevel = pass.DependencyLevel;
+            compiled.Barriers = pass.Barriers;
+            compiled.ReleaseBarriers = pass.ReleaseBarriers;
+            compiled.SplitBarrierBegins = pass.SplitBarrierBegins;
+            compiled.QueueDependencies = pass.QueueDependencies;
+            compiled.MergedWithPrevious = pass.MergedWithPrevious;
+            compiled.MergedWithNext = pass.MergedWithNext;
+            for (const auto& write : pass.Writes)
+            {
+                compiled.LoadOps.push_back(write.LoadOp);
+                compiled.StoreOps.push_back(write.StoreOp);
+            }
+        }
+
+        m_Compiled.Resources.clear();
+        for (const auto& node : m_Resources)
+        {
+            m_Compiled.Resources.push_back({ node.FirstPassIndex, node.LastPassIndex, node.UsedByAsyncQueue, node.Memoryless });
+        }
+    }
+
+    void RenderGraph::ReplayCompiledGraph()
+    {
+        // The freshly declared passes carry this frame's execute callbacks; only
+        // their order, barriers and the resource lifetimes come from the cache.
+        // Nodes are permuted in place so they keep the capacity of their lists.
+        m_ReplayPositions.resize(m_Passes.size());
+        m_ReplayDeclarations.resize(m_Passes.size());
+        for (uint32_t index = 0; index < m_Passes.size(); ++index)
+        {
+            m_ReplayPositions[index] = index;
+            m_ReplayDeclarations[index] = index;
+        }
+
+        for (size_t scheduledIndex = 0; scheduledIndex < m_Compiled.Passes.size(); ++scheduledIndex)
+        {
+            const auto& compiled = m_Compiled.Passes[scheduledIndex];
+            const uint32_t position = m_ReplayPositions[compiled.DeclarationIndex];
+            if (position != scheduledIndex)
+            {
+                std::swap(m_Passes[scheduledIndex], m_Passes[position]);
+                const uint32_t displaced = m_ReplayDeclarations[scheduledIndex];
+                m_ReplayDeclarations[position] = displaced;
+                m_ReplayPositions[displaced] = position;
+                m_ReplayDeclarations[scheduledIndex] = compiled.DeclarationIndex;
+                m_ReplayPositions[compiled.DeclarationIndex] = static_cast<uint32_t>(scheduledIndex);
+            }
+
+            auto& pass = m_Passes[scheduledIndex];
+            pass.Barriers = compiled.Barriers;
+            pass.ReleaseBarriers = compiled.ReleaseBarriers;
+            pass.SplitBarrierBegins = compiled.SplitBarrierBegins;
+            pass.QueueDependencies = compiled.QueueDependencies;
+            pass.DependencyLevel = compiled.DependencyLevel;
+            pass.MergedWithPrevious = compiled.MergedWithPrevious;
+            pass.MergedWithNext = compiled.MergedWithNext;
+            for (size_t writeIndex = 0; writeIndex < pass.Writes.size(); ++writeIndex)
+            {
+                pass.Writes[writeIndex].LoadOp = compiled.LoadOps[writeIndex];
+                pass.Writes[writeIndex].StoreOp = compiled.StoreOps[writeIndex];
+            }
+        }
+
+        // Culled passes end up behind the schedule and go back to the pool.
+        while (m_Passes.size() > m_Compiled.Passes.size())
+        {
+            m_Passes.back().Execute = nullptr;
+            m_PassPool.push_back(std::move(m_Passes.back()));
+            m_Passes.pop_back();
+        }
+
+        for (size_t resourceIndex = 0; resourceIndex < m_Resources.size(); ++resourceIndex)
+        {
+            const auto& compiled = m_Compiled.Resources[resourceIndex];
+            m_Resources[resourceIndex].FirstPassIndex = compiled.FirstPassIndex;
+            m_Resources[resourceIndex].LastPassIndex = compiled.LastPassIndex;
+            m_Resources[resourceIndex].UsedByAsyncQueue = compiled.UsedByAsyncQueue;
+            m_Resources[resourceIndex].Memoryless = compiled.Memoryless;
+        }
     }
 
     void RenderGraph::Execute(RHI::ICommandList* cmdList, RHI::IGraphicsContext* context)
     {
+        MX_PROFILE_SCOPE("RenderGraph::Execute");
         RenderStats::Get().ResetFrameStats();
         m_Cache.BeginFrame(context->GetCurrentFrameIndex());
+        m_Profiler.BeginFrame(*context, m_Passes);
+        RenderStats::Get().RecordPassTimings(m_Profiler.GetResults(), m_Profiler.GetGpuFrameTimeMs());
 
         // Realize Resources (Allocation Phase)
+        const auto& transients = m_Cache.AcquireTransients(m_Resources);
+        const auto& memoryStats = m_Cache.GetStatistics();
+        RenderStats::Get().RecordTransientMemory(memoryStats.HeapBytes + memoryStats.LinearBufferBytes,
+            memoryStats.BytesSavedByAliasing);
+        RenderStats::Get().RecordTransientPool(memoryStats.PoolHits, memoryStats.PoolMisses, memoryStats.PoolEvictions,
+            memoryStats.PooledBytes);
+
         for (const auto& node : m_Resources)
         {
             if (node.FirstPassIndex < 0) continue;
@@ -377,233 +1069,602 @@ namespace Mixture
             }
             else if (node.Type == RGResourceType::Texture)
             {
-                // Get from Cache
-                auto texture = m_Cache.GetOrCreateTexture(node.TextureDesc);
-                m_Registry.RegisterTexture(node.Handle, texture.get());
+                // Aliased or pooled by the cache
+                m_Registry.RegisterTexture(node.Handle, transients[node.Handle.ID].Texture.get());
+            }
+            else if (node.Type == RGResourceType::Buffer)
+            {
+                // Suballocated or pooled by the cache
+                const auto& transient = transients[node.Handle.ID];
+                m_Registry.RegisterBuffer(node.Handle, transient.Buffer.get(), transient.Range);
+            }
+        }
+
+        const bool multiQueue = RecordSubmissions(cmdList, context);
+        if (!multiQueue && !RecordPassesInParallel(cmdList, context))
+        {
+            // Execute Passes
+            for (size_t passIndex = 0; passIndex < m_Passes.size(); ++passIndex)
+            {
+                RecordPass(passIndex, cmdList, context);
+                ReleaseEndingResources(passIndex);
+            }
+        }
+
+        if (cmdList && !m_FinalBarriers.empty()) RecordBarrierBatch(m_FinalBarriers, cmdList, multiQueue);
+        StoreImportedStates();
+    }
+
+    void RenderGraph::StoreImportedStates()
+    {
+        // The next import of the same physical resource starts from the state this
+        // execution leaves it in. Undefined drops the entry of a texture whose subresources
+        // end in different states.
+        auto& tracker = ResourceStateTracker::Get();
+        for (const auto& node : m_Resources)
+        {
+            if (node.FirstPassIndex < 0) continue;
+            const RHI::ResourceState state = m_FinalStates[node.Handle.ID];
+
+            if (node.Type == RGResourceType::ImportedTexture) tracker.SetState(node.ExternalTexture, state);
+            else if (node.Type == RGResourceType::ImportedBuffer) tracker.SetState(node.ExternalBuffer, state);
+        }
+    }
+
+    bool RenderGraph::RecordPassesInParallel(RHI::ICommandList* cmdList, RHI::IGraphicsContext* context)
+    {
+        // A graph without independent passes gains nothing from secondary lists.
+        const bool hasIndependentPasses = m_PassesByLevel.size() < m_Passes.size();
+        if (!m_ParallelRecording || !hasIndependentPasses || !cmdList ||
+            !context->SupportsParallelRecording() || !TaskSystem::IsInitialized())
+        {
+            return false;
+        }
+
+        m_SecondaryLists.clear();
+        m_SecondaryLists.resize(m_Passes.size());
+
+        std::mutex failureMutex;
+        std::exception_ptr failure;
+
+        // Levels are recorded one after another so that execute callbacks still observe
+        // their dependencies in order; passes within a level run on any worker.
+        for (const auto& levelPasses : m_PassesByLevel)
+        {
+            const TaskHandle level = TaskSystem::ParallelFor(levelPasses.size(), 1, [&](size_t begin, size_t end)
+            {
+                for (size_t index = begin; index < end; ++index)
+                {
+                    const uint32_t passIndex = levelPasses[index];
+                    // A rendering scope cannot span command lists, so merged passes are
+                    // recorded by the pass that opens their scope.
+                    if (m_Passes[passIndex].MergedWithPrevious) continue;
+                    try
+                    {
+                        auto secondary = context->CreateSecondaryCommandList();
+                        if (!secondary) throw std::runtime_error("Graphics context failed to create a secondary command list");
+
+                        secondary->Begin();
+                        size_t scopePass = passIndex;
+                        RecordPass(scopePass, secondary.get(), context);
+                        while (m_Passes[scopePass].MergedWithNext) RecordPass(++scopePass, secondary.get(), context);
+                        secondary->End();
+                        m_SecondaryLists[passIndex] = std::move(secondary);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(failureMutex);
+                        if (!failure) failure = std::current_exception();
+                    }
+                }
+            });
+            TaskSystem::WaitAndHelp(level);
+
+            if (failure)
+            {
+                m_SecondaryLists.clear();
+                std::rethrow_exception(failure);
+            }
+        }
+
+        // Stitch in schedule order so the GPU sees exactly the serial command stream.
+        m_SecondaryListPointers.clear();
+        for (const auto& secondary : m_SecondaryLists)
+        {
+            if (secondary) m_SecondaryListPointers.push_back(secondary.get());
+        }
+        cmdList->ExecuteSecondary(m_SecondaryListPointers);
+        m_SecondaryListPointers.clear();
+        m_SecondaryLists.clear();
+
+        for (size_t passIndex = 0; passIndex < m_Passes.size(); ++passIndex)
+        {
+            ReleaseEndingResources(passIndex);
+        }
+        return true;
+    }
+
+    bool RenderGraph::RecordSubmissions(RHI::ICommandList* cmdList, RHI::IGraphicsContext* context)
+    {
+        const bool hasAsyncPasses = std::any_of(m_Submissions.begin(), m_Submissions.end(),
+            [](const RGSubmission& submission) { return submission.Queue != RHI::QueueType::Graphics; });
+        if (!hasAsyncPasses || !cmdList || !context->SupportsAsyncCompute()) return false;
+
+        // The frame's own list carries the last graphics submission, which is the one
+        // that ends up writing the swapchain image.
+        size_t frameSubmission = m_Submissions.size();
+        for (size_t index = m_Submissions.size(); index-- > 0;)
+        {
+            if (m_Submissions[index].Queue == RHI::QueueType::Graphics)
+            {
+                frameSubmission = index;
+                break;
+            }
+        }
+
+        // Submissions are recorded serially: secondary lists cannot be shared between
+        // queues, and a submission rarely holds enough independent passes to pay off.
+        Vector<uint32_t> queuedIndices(m_Submissions.size(), 0);
+        Vector<uint32_t> waits;
+        for (size_t index = 0; index < m_Submissions.size(); ++index)
+        {
+            const auto& submission = m_Submissions[index];
+
+            Scope<RHI::ICommandList> queueList;
+            RHI::ICommandList* target = cmdList;
+            if (index != frameSubmission)
+            {
+                queueList = context->CreateQueueCommandList(submission.Queue);
+                if (!queueList) throw std::runtime_error("Graphics context failed to create a queue command list");
+                target = queueList.get();
+                target->Begin();
+            }
+
+            for (const uint32_t passIndex : submission.Passes)
+            {
+                RecordPass(passIndex, target, context, true);
+                ReleaseEndingResources(passIndex);
+            }
+            if (queueList) target->End();
+
+            waits.clear();
+            for (const uint32_t wait : submission.WaitSubmissions) waits.push_back(queuedIndices[wait]);
+            queuedIndices[index] = context->QueueCommandList(std::move(queueList), waits);
+        }
+        return true;
+    }
+
+    void RenderGraph::RecordPass(size_t passIndex, RHI::ICommandList* cmdList, RHI::IGraphicsContext* context, bool multiQueue)
+    {
+        const RGPassNode& pass = m_Passes[passIndex];
+        MX_PROFILE_SCOPE_COPY(pass.Name);
+        RenderStats::Get().RecordRenderPass();
+        m_Profiler.BeginPass(passIndex, cmdList);
+
+        // Execute Barriers. Split barriers complete first: a pass reading and then
+        // writing a resource records the split read transition before the write.
+        RecordSplitBarriers(pass.Barriers, cmdList, false);
+        RecordBarrierBatch(pass.Barriers, cmdList, multiQueue);
+
+        // Run Logic
+        if (pass.Execute)
+        {
+            RHI::RenderingInfo renderingInfo;
+
+            // Setup Render Area from Attachment Writes. The requested extent is used rather than
+            // the texture's, which the cache may have rounded up to a size class.
+            if (!pass.Writes.empty())
+            {
+                const RGResourceHandle firstWrite = pass.Writes[0].Handle;
+                if (m_Registry.GetTexture(firstWrite))
+                {
+                    const RHI::TextureDesc& desc = m_Resources[firstWrite.ID].TextureDesc;
+                    renderingInfo.RenderAreaWidth = std::max(desc.Width >> firstWrite.BaseMip, 1u);
+                    renderingInfo.RenderAreaHeight = std::max(desc.Height >> firstWrite.BaseMip, 1u);
+                }
             }
-            else if (node.Type == RGResourceType::Buffer)
+            else
             {
-                // Get from Cache
-                auto buffer = m_Cache.GetOrCreateBuffer(node.BufferDesc);
-                m_Registry.RegisterBuffer(node.Handle, buffer.get());
+                // Fallback
+                renderingInfo.RenderAreaWidth = context->GetSwapchainWidth();
+                renderingInfo.RenderAreaHeight = context->GetSwapchainHeight();
             }
-        }
 
-        // Execute Passes
-        for (size_t passIndex = 0; passIndex < m_Passes.size(); ++passIndex)
-        {
-            const auto& pass = m_Passes[passIndex];
-            RenderStats::Get().RecordRenderPass();
+            // Populate Attachments
+            RHI::RenderingAttachment depthAttachmentTemp;
+            renderingInfo.DepthAttachment = nullptr;
 
-            // Execute Barriers
-            for (const auto& barrier : pass.Barriers)
+            for (const auto& write : pass.Writes)
             {
-                auto& resNode = m_Resources[barrier.Resource.ID];
-                if (resNode.Type == RGResourceType::Texture || resNode.Type == RGResourceType::ImportedTexture)
+                // Look up the actual RHI Texture from the handle
+                auto texture = m_Registry.GetTexture(write.Handle);
+
+                // Create the attachment struct
+                RHI::RenderingAttachment attachment;
+                attachment.Image = texture;
+                attachment.LoadOp = write.LoadOp;
+                attachment.StoreOp = write.StoreOp;
+                attachment.MipLevel = write.Handle.BaseMip;
+                attachment.ArrayLayer = write.Handle.BaseLayer;
+
+                // Copy Clear Color
+                memcpy(attachment.ClearColor, write.ClearColor, sizeof(float) * 4);
+                attachment.DepthClearValue = write.DepthClearValue;
+
+                // Sort into Color vs Depth
+                if (IsDepthFormat(texture->GetFormat()))
                 {
-                    cmdList->PipelineBarrier(
-                        m_Registry.GetTexture(barrier.Resource),
-                        barrier.Before,
-                        barrier.After
-                    );
+                    depthAttachmentTemp = attachment;
+                    renderingInfo.DepthAttachment = &depthAttachmentTemp;
                 }
                 else
                 {
-                    cmdList->PipelineBarrier(
-                        m_Registry.GetBuffer(barrier.Resource),
-                        barrier.Before,
-                        barrier.After
-                    );
+                    renderingInfo.ColorAttachments.push_back(attachment);
                 }
             }
 
-            // Run Logic
-            if (pass.Execute)
+            // Only call BeginRendering if we have attachments. Merged passes share
+            // the scope of the pass that opened it.
+            if (!renderingInfo.ColorAttachments.empty() || renderingInfo.DepthAttachment)
             {
-                RHI::RenderingInfo renderingInfo;
+                uint32_t width = renderingInfo.RenderAreaWidth;
+                uint32_t height = renderingInfo.RenderAreaHeight;
 
-                // Setup Render Area from Attachment Writes
-                if (!pass.Writes.empty())
-                {
-                    RHI::ITexture* firstTex = m_Registry.GetTexture(pass.Writes[0].Handle);
-                    if (firstTex)
-                    {
-                        renderingInfo.RenderAreaWidth = firstTex->GetWidth();
-                        renderingInfo.RenderAreaHeight = firstTex->GetHeight();
-                    }
-                }
-                else
-                {
-                    // Fallback
-                    renderingInfo.RenderAreaWidth = context->GetSwapchainWidth();
-                    renderingInfo.RenderAreaHeight = context->GetSwapchainHeight();
-                }
+                if (!pass.MergedWithPrevious) cmdList->BeginRendering(renderingInfo);
+                cmdList->SetViewport(0, 0, (float)width, (float)height);
+                cmdList->SetScissor(0, 0, width, height);
 
-                // Populate Attachments
-                RHI::RenderingAttachment depthAttachmentTemp;
-                renderingInfo.DepthAttachment = nullptr;
+                pass.Execute(m_Registry, cmdList); // Draw commands happen here
 
-                for (const auto& write : pass.Writes)
-                {
-                    // Look up the actual RHI Texture from the handle
-                    auto texture = m_Registry.GetTexture(write.Handle);
+                if (!pass.MergedWithNext) cmdList->EndRendering();
+            }
+            else
+            {
+                // Just execute without dynamic rendering scope (Compute, Copy, etc.)
+                pass.Execute(m_Registry, cmdList);
+            }
+        }
 
-                    // Create the attachment struct
-                    RHI::RenderingAttachment attachment;
-                    attachment.Image = texture;
-                    attachment.LoadOp = write.LoadOp;
-                    attachment.StoreOp = write.StoreOp;
+        RecordSplitBarriers(pass.SplitBarrierBegins, cmdList, true);
+        if (multiQueue) RecordBarrierBatch(pass.ReleaseBarriers, cmdList, multiQueue);
+        m_Profiler.EndPass(passIndex, cmdList);
+    }
 
-                    // Copy Clear Color
-                    memcpy(attachment.ClearColor, write.ClearColor, sizeof(float) * 4);
-                    attachment.DepthClearValue = write.DepthClearValue;
+    RHI::ResourceBarrier RenderGraph::ToResourceBarrier(const RGBarrier& barrier, bool multiQueue)
+    {
+        RHI::ResourceBarrier resourceBarrier;
+        const auto& resNode = m_Resources[barrier.Resource.ID];
+        if (resNode.Type == RGResourceType::Texture || resNode.Type == RGResourceType::ImportedTexture)
+            resourceBarrier.Texture = m_Registry.GetTexture(barrier.Resource);
+        else
+        {
+            resourceBarrier.Buffer = m_Registry.GetBuffer(barrier.Resource);
+            resourceBarrier.Range = m_Registry.GetBufferRange(barrier.Resource);
+        }
+        resourceBarrier.Before = barrier.Before;
+        resourceBarrier.After = barrier.After;
+        resourceBarrier.Subresources = barrier.Resource.GetSubresources();
 
-                    // Sort into Color vs Depth
-                    if (IsDepthFormat(texture->GetFormat()))
-                    {
-                        depthAttachmentTemp = attachment;
-                        renderingInfo.DepthAttachment = &depthAttachmentTemp;
-                    }
-                    else
-                    {
-                        renderingInfo.ColorAttachments.push_back(attachment);
-                    }
-                }
+        // Ownership transfers only exist when the passes really run on different
+        // queues; on a single queue the queue fields are dropped.
+        if (multiQueue)
+        {
+            resourceBarrier.SourceQueue = barrier.SourceQueue;
+            resourceBarrier.DestinationQueue = barrier.DestinationQueue;
+        }
+        return resourceBarrier;
+    }
 
-                // Only call BeginRendering if we have attachments
-                if (!renderingInfo.ColorAttachments.empty() || renderingInfo.DepthAttachment)
-                {
-                    uint32_t width = renderingInfo.RenderAreaWidth;
-                    uint32_t height = renderingInfo.RenderAreaHeight;
+    void RenderGraph::RecordBarrierBatch(std::span<const RGBarrier> barriers, RHI::ICommandList* cmdList, bool multiQueue)
+    {
+        Vector<RHI::ResourceBarrier> batch;
+        batch.reserve(barriers.size());
 
-                    cmdList->BeginRendering(renderingInfo);
-                    cmdList->SetViewport(0, 0, (float)width, (float)height);
-                    cmdList->SetScissor(0, 0, width, height);
+        auto flush = [&]()
+        {
+            if (batch.empty()) return;
+            cmdList->PipelineBarriers(batch);
+            RenderStats::Get().RecordBarrierBatch(static_cast<uint32_t>(batch.size()));
+            batch.clear();
+        };
 
-                    pass.Execute(m_Registry, cmdList); // Draw commands happen here
+        for (size_t index = 0; index < barriers.size(); ++index)
+        {
+            const auto& barrier = barriers[index];
+            if (barrier.Split != RGBarrier::NoSplit) continue;
 
-                    cmdList->EndRendering();
-                }
-                else
-                {
-                    // Just execute without dynamic rendering scope (Compute, Copy, etc.)
-                    pass.Execute(m_Registry, cmdList);
-                }
+            // Transitions within one batch are unordered, so a second transition of the
+            // same subresource has to go into the next batch.
+            const bool seen = std::any_of(barriers.begin(), barriers.begin() + index, [&](const RGBarrier& previous)
+            {
+                return previous.Split == RGBarrier::NoSplit && previous.Resource.Overlaps(barrier.Resource);
+            });
+            if (seen) flush();
+            batch.push_back(ToResourceBarrier(barrier, multiQueue));
+        }
+        flush();
+    }
+
+    void RenderGraph::RecordSplitBarriers(std::span<const RGBarrier> barriers, RHI::ICommandList* cmdList, bool begin)
+    {
+        Vector<RGBarrier> splits;
+        for (const auto& barrier : barriers)
+        {
+            if (barrier.Split != RGBarrier::NoSplit) splits.push_back(barrier);
+        }
+        if (splits.empty()) return;
+
+        // Begin and end see the transitions of a split in the same relative order, so
+        // grouping them stably yields identical batches on both sides.
+        std::stable_sort(splits.begin(), splits.end(),
+            [](const RGBarrier& lhs, const RGBarrier& rhs) { return lhs.Split < rhs.Split; });
+
+        Vector<RHI::ResourceBarrier> batch;
+        for (size_t first = 0; first < splits.size();)
+        {
+            size_t last = first;
+            batch.clear();
+            while (last < splits.size() && splits[last].Split == splits[first].Split)
+            {
+                batch.push_back(ToResourceBarrier(splits[last], false));
+                ++last;
             }
 
-            // Virtual handles are valid only through their calculated lifetime.
-            // The frame-slot cache retains physical ownership until GPU-safe reuse.
-            for (const RGResourceHandle handle : m_ResourcesEndingAtPass[passIndex])
+            if (begin)
             {
-                const auto& resource = m_Resources[handle.ID];
-                if (resource.Type == RGResourceType::Texture)
-                    m_Registry.UnregisterTexture(handle);
-                else
-                    m_Registry.UnregisterBuffer(handle);
+                cmdList->BeginSplitBarriers(splits[first].Split, batch);
+            }
+            else
+            {
+                cmdList->EndSplitBarriers(splits[first].Split, batch);
+                RenderStats::Get().RecordBarrierBatch(static_cast<uint32_t>(batch.size()));
             }
+            first = last;
+        }
+    }
+
+    void RenderGraph::ReleaseEndingResources(size_t passIndex)
+    {
+        // Virtual handles are valid only through their calculated lifetime.
+        // The frame-slot cache retains physical ownership until GPU-safe reuse.
+        for (const RGResourceHandle handle : m_ResourcesEndingAtPass[passIndex])
+        {
+            const auto& resource = m_Resources[handle.ID];
+            if (resource.Type == RGResourceType::Texture)
+                m_Registry.UnregisterTexture(handle);
+            else
+                m_Registry.UnregisterBuffer(handle);
         }
     }
 
-    RGResourceHandle RenderGraph::ImportResource(const std::string& name, RHI::ITexture* resource)
+    RGResourceHandle RenderGraph::ImportResource(RGResourceName name, RHI::ITexture* resource, const RGImportInfo& info)
     {
         if (!resource) throw std::invalid_argument("Cannot import a null render-graph texture");
-        const RGResourceHandle handle = NextResourceHandle();
 
         RGResourceNode node;
-        node.Handle = handle;
-        node.Name = name;
         node.Type = RGResourceType::ImportedTexture;
 
         node.TextureDesc.Width = resource->GetWidth();
         node.TextureDesc.Height = resource->GetHeight();
         node.TextureDesc.PixelFormat = resource->GetFormat();
-        node.TextureDesc.InitialState = RHI::ResourceState::Undefined; // We don't track external state yet
+        node.TextureDesc.MipLevels = resource->GetMipLevels();
+        node.TextureDesc.ArrayLayers = resource->GetArrayLayers();
+        node.TextureDesc.InitialState = info.DiscardContents ? RHI::ResourceState::Undefined : ResourceStateTracker::Get().GetState(resource);
+        node.FinalState = info.FinalState;
 
         node.ExternalTexture = resource;
 
-        m_Resources.push_back(node);
-        m_ResourceLookup.try_emplace(name, handle);
+        const RGResourceHandle handle = AddResourceNode(name, node);
         m_Registry.ImportTexture(handle, resource);
 
         return handle;
     }
 
-    RGResourceHandle RenderGraph::ImportResource(const std::string& name, RHI::IBuffer* resource)
+    RGResourceHandle RenderGraph::ImportResource(RGResourceName name, RHI::IBuffer* resource, const RGImportInfo& info)
     {
         if (!resource) throw std::invalid_argument("Cannot import a null render-graph buffer");
-        const RGResourceHandle handle = NextResourceHandle();
 
         RGResourceNode node;
-        node.Handle = handle;
-        node.Name = name;
         node.Type = RGResourceType::ImportedBuffer;
 
+        node.BufferDesc = RHI::BufferDesc{};
         node.BufferDesc.Size = resource->GetSize();
         node.BufferDesc.Usage = resource->GetUsage();
+        node.BufferInitialState = info.DiscardContents ? RHI::ResourceState::Undefined : ResourceStateTracker::Get().GetState(resource);
+        node.FinalState = info.FinalState;
 
         node.ExternalBuffer = resource;
 
-        m_Resources.push_back(node);
-        m_ResourceLookup.try_emplace(name, handle);
+        const RGResourceHandle handle = AddResourceNode(name, node);
         m_Registry.ImportBuffer(handle, resource);
 
         return handle;
     }
 
-    RGResourceHandle RenderGraph::CreateResource(const std::string& name, const RHI::TextureDesc& desc)
+    RGResourceHandle RenderGraph::CreateResource(RGResourceName name, const RHI::TextureDesc& desc)
     {
-        const RGResourceHandle handle = NextResourceHandle();
+        RGResourceNode node;
+        node.Type = RGResourceType::Texture;
+        node.TextureDesc = desc;
+
+        return AddResourceNode(name, node);
+    }
+
+    RGResourceHandle RenderGraph::CreateResource(RGResourceName name, const RHI::BufferDesc& desc)
+    {
+        RGResourceNode node;
+        node.Type = RGResourceType::Buffer;
+        node.BufferDesc = desc;
+
+        return AddResourceNode(name, node);
+    }
+
+    void RenderGraph::SetViewport(const RGViewport& viewport)
+    {
+        if (!(viewport.Scale > 0.0f)) throw std::invalid_argument("RenderGraph viewport scale must be positive");
+        m_Viewport = viewport;
+    }
+
+    RGResourceHandle RenderGraph::CreateScaledResource(RGResourceName name, const RHI::TextureDesc& desc, float relativeSize)
+    {
+        if (m_Viewport.Width == 0 || m_Viewport.Height == 0)
+            throw std::logic_error("RenderGraph::CreateScaledResource needs a viewport, see SetViewport");
+        if (!(relativeSize > 0.0f)) throw std::invalid_argument("Scaled render-graph resources need a positive relative size");
+
+        const auto scaleExtent = [](uint32_t extent, float scale)
+        {
+            return std::max(1u, static_cast<uint32_t>(std::lround(static_cast<double>(extent) * scale)));
+        };
 
         RGResourceNode node;
-        node.Handle = handle;
-        node.Name = name;
         node.Type = RGResourceType::Texture;
         node.TextureDesc = desc;
+        node.TextureDesc.Width = scaleExtent(m_Viewport.Width, relativeSize * m_Viewport.Scale);
+        node.TextureDesc.Height = scaleExtent(m_Viewport.Height, relativeSize * m_Viewport.Scale);
+        // Scales above 1 supersample and have to grow the allocation with them.
+        node.AllocationWidth = std::max(node.TextureDesc.Width, scaleExtent(m_Viewport.Width, relativeSize));
+        node.AllocationHeight = std::max(node.TextureDesc.Height, scaleExtent(m_Viewport.Height, relativeSize));
 
-        m_Resources.push_back(node);
-        m_ResourceLookup.try_emplace(name, handle);
+        return AddResourceNode(name, node);
+    }
+
+    RGResourceHandle RenderGraph::CreatePersistentResource(RGResourceName name, const RHI::TextureDesc& desc)
+    {
+        const auto [nameID, internedName] = InternName(name);
+        if (m_PersistentLookup[nameID] == InvalidNameID)
+        {
+            const uint32_t index = static_cast<uint32_t>(m_PersistentResources.size());
+            const std::string historyName = std::string(internedName) + "@History";
+            const std::string_view internedHistory = InternName(RGResourceName(historyName)).second;
+            m_PersistentLookup[nameID] = index;
+            m_PersistentResources.emplace_back().HistoryName = RGResourceName(internedHistory);
+        }
+
+        const uint32_t index = m_PersistentLookup[nameID];
+        auto& entry = m_PersistentResources[index];
+        if (entry.DeclaredInFrame == m_FrameNumber) return entry.Handle;
+
+        RHI::TextureDesc physicalDesc = desc;
+        physicalDesc.Usage |= RHI::TextureUsage::Sampled | (RHI::IsDepthFormat(desc.PixelFormat)
+            ? RHI::TextureUsage::DepthStencilAttachment : RHI::TextureUsage::ColorAttachment);
+        physicalDesc.InitialState = RHI::ResourceState::Undefined;
+
+        const bool resized = !entry.Textures[0] || entry.Desc != physicalDesc;
+        if (resized)
+        {
+            for (auto& texture : entry.Textures)
+            {
+                if (texture)
+                {
+                    // Never imported again, so its tracked state can go before the texture does.
+                    ResourceStateTracker::Get().SetState(texture.get(), RHI::ResourceState::Undefined);
+                    m_RetiredPersistentTextures.emplace_back(m_FrameNumber, std::move(texture));
+                }
+                texture = m_Device.CreateTexture(physicalDesc);
+                if (!texture) throw std::runtime_error("Graphics device failed to create a persistent render-graph texture");
+            }
+            entry.Desc = physicalDesc;
+            entry.CurrentInFrame = { PersistentResource::NeverCurrent, PersistentResource::NeverCurrent };
+        }
+        else
+        {
+            entry.Current ^= 1;
+        }
+        entry.DeclaredInFrame = m_FrameNumber;
+        entry.CurrentInFrame[entry.Current] = m_FrameNumber;
+
+        RGResourceNode node;
+        node.Type = RGResourceType::ImportedTexture;
+        node.TextureDesc = entry.Desc;
+        node.ExternalTexture = entry.Textures[entry.Current].get();
+        node.TextureDesc.InitialState = ResourceStateTracker::Get().GetState(node.ExternalTexture);
+
+        const RGResourceHandle handle = AddResourceNode(name, node);
+        m_Registry.ImportTexture(handle, node.ExternalTexture);
+        m_PersistentBindings.push_back({ handle, index });
+        entry.Handle = handle;
+        entry.HistoryHandle = RGResourceHandle();
         return handle;
     }
 
-    RGResourceHandle RenderGraph::CreateResource(const std::string& name, const RHI::BufferDesc& desc)
+    RGResourceHandle RenderGraph::GetHistory(RGResourceHandle handle)
     {
-        const RGResourceHandle handle = NextResourceHandle();
+        const PersistentBinding* binding = FindPersistentBinding(handle);
+        if (!binding || m_PersistentResources[binding->Resource].Handle != handle)
+            throw std::invalid_argument("Render-graph handle does not refer to a persistent resource of this frame");
+
+        const uint32_t resource = binding->Resource;
+        auto& entry = m_PersistentResources[resource];
+        if (entry.HistoryHandle.IsValid()) return entry.HistoryHandle;
 
         RGResourceNode node;
-        node.Handle = handle;
-        node.Name = name;
-        node.Type = RGResourceType::Buffer;
-        node.BufferDesc = desc;
+        node.Type = RGResourceType::ImportedTexture;
+        node.TextureDesc = entry.Desc;
+        node.ExternalTexture = entry.Textures[entry.Current ^ 1].get();
+        node.TextureDesc.InitialState = ResourceStateTracker::Get().GetState(node.ExternalTexture);
+
+        const RGResourceHandle history = AddResourceNode(entry.HistoryName, node);
+        m_Registry.ImportTexture(history, node.ExternalTexture);
+        m_PersistentBindings.push_back({ history, resource });
+        entry.HistoryHandle = history;
+        return history;
+    }
+
+    bool RenderGraph::HasValidHistory(RGResourceHandle handle) const
+    {
+        const PersistentBinding* binding = FindPersistentBinding(handle);
+        if (!binding) throw std::invalid_argument("Render-graph handle does not refer to a persistent resource of this frame");
+
+        const auto& entry = m_PersistentResources[binding->Resource];
+        return m_FrameNumber > 0 && entry.CurrentInFrame[entry.Current ^ 1] == m_FrameNumber - 1;
+    }
+
+    const RenderGraph::PersistentBinding* RenderGraph::FindPersistentBinding(RGResourceHandle handle) const
+    {
+        const auto it = std::find_if(m_PersistentBindings.begin(), m_PersistentBindings.end(),
+            [handle](const PersistentBinding& binding) { return binding.Handle == handle; });
+        return it != m_PersistentBindings.end() ? &*it : nullptr;
+    }
+
+    RGResourceHandle RenderGraph::AddResourceNode(const RGResourceName& name, RGResourceNode& node)
+    {
+        const RGResourceHandle handle = NextResourceHandle();
+        const auto [nameID, internedName] = InternName(name);
 
+        node.Handle = handle;
+        node.Name = internedName;
         m_Resources.push_back(node);
-        m_ResourceLookup.try_emplace(name, handle);
+
+        // The first resource declared under a name keeps it for the frame.
+        if (!m_ResourceLookup[nameID].IsValid()) m_ResourceLookup[nameID] = handle;
         return handle;
     }
 
-    void RenderGraph::AddAlias(std::string aliasName, std::string targetName)
+    void RenderGraph::AddAlias(RGResourceName aliasName, RGResourceName targetName)
     {
-        m_Aliases[std::move(aliasName)] = std::move(targetName);
+        const uint32_t aliasID = InternName(aliasName).first;
+        const uint32_t targetID = InternName(targetName).first;
+        m_AliasTargets[aliasID] = targetID;
+        m_AliasesResolved = false;
     }
 
     void RenderGraph::ClearAliases()
     {
-        m_Aliases.clear();
+        std::fill(m_AliasTargets.begin(), m_AliasTargets.end(), InvalidNameID);
+        m_AliasesResolved = false;
     }
 
-    RGResourceHandle RenderGraph::GetResource(const std::string& name) const
+    RGResourceHandle RenderGraph::GetResource(RGResourceName name) const
     {
-        std::string current = name;
-        auto aliasIt = m_Aliases.find(current);
-        while (aliasIt != m_Aliases.end())
-        {
-            current = aliasIt->second;
-            aliasIt = m_Aliases.find(current);
-        }
+        if (!m_AliasesResolved) ResolveAliases();
 
-        const auto resource = m_ResourceLookup.find(current);
-        if (resource != m_ResourceLookup.end()) return resource->second;
+        uint32_t current = FindNameID(name.Hash);
+        // Names interned after the last resolution cannot be aliases, as adding one invalidates it.
+        if (current != InvalidNameID && current < m_ResolvedAliases.size()) current = m_ResolvedAliases[current];
 
-        OPAL_ERROR("Core/RenderGraph", "Resource not found: %s", name.c_str());
+        if (current != InvalidNameID && m_ResourceLookup[current].IsValid()) return m_ResourceLookup[current];
+
+        OPAL_ERROR("Core/RenderGraph", "Resource not found: {}", name.Name);
         return RGResourceHandle();
     }
 
@@ -634,6 +1695,28 @@ namespace Mixture
         return m_Resources[handle.ID];
     }
 
+    RGResourceHandle RenderGraph::ResolveSubresources(RGResourceHandle handle) const
+    {
+        const auto& node = GetResourceNode(handle);
+        if (node.Type != RGResourceType::Texture && node.Type != RGResourceType::ImportedTexture)
+        {
+            if (!handle.IsWholeResource()) throw std::invalid_argument("Render-graph buffers have no subresources");
+            return handle;
+        }
+
+        // Counts stay explicit unless the range spans every mip or layer.
+        const auto resolve = [](uint16_t& base, uint16_t& count, uint32_t available, const char* what)
+        {
+            const uint32_t end = count ? static_cast<uint32_t>(base) + count : available;
+            if (base >= available || end > available)
+                throw std::out_of_range(std::string("Render-graph handle addresses ") + what + " the texture does not have");
+            if (end == available) count = base == 0 ? 0 : static_cast<uint16_t>(end - base);
+        };
+        resolve(handle.BaseMip, handle.MipCount, node.TextureDesc.MipLevels, "mips");
+        resolve(handle.BaseLayer, handle.LayerCount, node.TextureDesc.ArrayLayers, "layers");
+        return handle;
+    }
+
     void RenderGraph::AddTextureUsage(RGResourceHandle handle, RHI::TextureUsage usage)
     {
         if (!handle.IsValid() || handle.ID >= m_Resources.size())
@@ -651,12 +1734,14 @@ namespace Mixture
         return handle;
     }
 
-    void RenderGraph::SortPasses()
+    bool RenderGraph::SortPasses()
     {
         if (!RenderGraphAlgorithms::SortPasses(m_Passes))
         {
             OPAL_ERROR("Core/RenderGraph", "Failed to produce a valid pass ordering.");
+            return false;
         }
+        return true;
     }
 
     void RenderGraph::CullPasses()
@@ -669,44 +1754,160 @@ namespace Mixture
         RenderGraphAlgorithms::CalculateResourceLifetimes(m_Passes, m_Resources);
     }
 
+    void RenderGraph::CalculateDependencyLevels()
+    {
+        const uint32_t levelCount = RenderGraphAlgorithms::CalculateDependencyLevels(m_Passes);
+
+        m_PassesByLevel.clear();
+        m_PassesByLevel.resize(levelCount);
+        for (size_t passIndex = 0; passIndex < m_Passes.size(); ++passIndex)
+        {
+            m_PassesByLevel[m_Passes[passIndex].DependencyLevel].push_back(static_cast<uint32_t>(passIndex));
+        }
+    }
+
     void RenderGraph::CalculateBarriers()
     {
-        Vector<RHI::ResourceState> currentStates(m_Resources.size());
-        Vector<bool> wasLastWrite(m_Resources.size(), false);
+        // State is tracked per subresource. A texture's mips and layers occupy the entries
+        // from firstSubresources[id] on in mip-major order; buffers have a single entry.
+        Vector<uint32_t> firstSubresources(m_Resources.size() + 1, 0);
+        for (size_t i = 0; i < m_Resources.size(); ++i)
+        {
+            const auto& node = m_Resources[i];
+            const bool isTexture = node.Type == RGResourceType::Texture || node.Type == RGResourceType::ImportedTexture;
+            const uint32_t count = isTexture ? node.TextureDesc.MipLevels * node.TextureDesc.ArrayLayers : 1;
+            firstSubresources[i + 1] = firstSubresources[i] + count;
+        }
+
+        const size_t subresourceCount = firstSubresources.back();
+        Vector<RHI::ResourceState> currentStates(subresourceCount);
+        Vector<bool> wasLastWrite(subresourceCount, false);
+        Vector<RHI::QueueType> owningQueues(subresourceCount, RHI::QueueType::Graphics);
+        Vector<int32_t> lastUsers(subresourceCount, -1);
+        // One split barrier per pair of previous user and transitioning pass.
+        std::unordered_map<uint64_t, uint32_t> splitIndices;
+        Vector<SubresourceTransition> transitions;
+        Vector<uint32_t> mergeLookup;
 
         for (size_t i = 0; i < m_Resources.size(); ++i)
         {
+            RHI::ResourceState initialState = RHI::ResourceState::Undefined;
             if (m_Resources[i].Type == RGResourceType::Texture || m_Resources[i].Type == RGResourceType::ImportedTexture)
-                currentStates[i] = m_Resources[i].TextureDesc.InitialState;
-            else
-                currentStates[i] = RHI::ResourceState::Undefined;
+                initialState = m_Resources[i].TextureDesc.InitialState;
+            else if (m_Resources[i].Type == RGResourceType::ImportedBuffer)
+                initialState = m_Resources[i].BufferInitialState;
+            std::fill(currentStates.begin() + firstSubresources[i], currentStates.begin() + firstSubresources[i + 1], initialState);
         }
 
-        for (auto& pass : m_Passes)
+        for (size_t passIndex = 0; passIndex < m_Passes.size(); ++passIndex)
         {
+            auto& pass = m_Passes[passIndex];
             pass.Barriers.clear();
-
-            auto TransitionResource = [&](RGResourceHandle handle, RHI::ResourceState targetState, bool isWrite)
+            pass.ReleaseBarriers.clear();
+            pass.SplitBarrierBegins.clear();
+            pass.QueueDependencies.clear();
+
+            // Updates the tracked state of one subresource and fills @p transition with the
+            // barrier it needs. Returns false if it needs none.
+            auto TransitionSubresource = [&](uint32_t subresource, RHI::ResourceState targetState, bool isWrite,
+                SubresourceTransition& transition)
             {
-                uint32_t id = handle.ID;
-                RHI::ResourceState current = currentStates[id];
-                bool previousWasWrite = wasLastWrite[id];
+                RHI::ResourceState current = currentStates[subresource];
+                bool previousWasWrite = wasLastWrite[subresource];
+                const int32_t lastUser = lastUsers[subresource];
+                const RHI::QueueType owningQueue = owningQueues[subresource];
+                lastUsers[subresource] = static_cast<int32_t>(passIndex);
+                owningQueues[subresource] = pass.Queue;
+                transition.Before = current;
+
+                // Handing a resource to another queue always waits for its last user there.
+                // Defined contents additionally need a release on the old queue after that
+                // pass and a matching acquire here; undefined contents are simply discarded.
+                if (lastUser >= 0 && owningQueue != pass.Queue)
+                {
+                    const uint32_t dependency = static_cast<uint32_t>(lastUser);
+                    if (std::find(pass.QueueDependencies.begin(), pass.QueueDependencies.end(), dependency) == pass.QueueDependencies.end())
+                        pass.QueueDependencies.push_back(dependency);
+
+                    currentStates[subresource] = targetState;
+                    wasLastWrite[subresource] = isWrite;
+                    if (current != RHI::ResourceState::Undefined)
+                    {
+                        transition.SourceQueue = owningQueue;
+                        transition.ReleasingPass = lastUser;
+                        return true;
+                    }
+                    return targetState != current;
+                }
 
                 bool layoutChanged = (current != targetState);
                 bool hazardExists = previousWasWrite || (isWrite && current != RHI::ResourceState::Undefined);
 
-                if (!isWrite && !previousWasWrite && !layoutChanged) return;
+                if (!isWrite && !previousWasWrite && !layoutChanged) return false;
 
-                if (layoutChanged || hazardExists)
+                wasLastWrite[subresource] = isWrite;
+                if (!layoutChanged && !hazardExists) return false;
+
+                // Passes in between overlap the transition when it starts right after the
+                // previous user. Undefined contents have no previous user to wait for.
+                const bool farApart = lastUser >= 0 && m_SplitBarrierDistance > 0 &&
+                    passIndex - static_cast<size_t>(lastUser) >= m_SplitBarrierDistance;
+                if (farApart && current != RHI::ResourceState::Undefined) transition.SplitAfterPass = lastUser;
+                currentStates[subresource] = targetState;
+                return true;
+            };
+
+            auto EmitBarrier = [&](const SubresourceTransition& transition, RGResourceHandle handle, RHI::ResourceState targetState)
+            {
+                RGBarrier barrier;
+                barrier.Resource = handle;
+                barrier.Before = transition.Before;
+                barrier.After = targetState;
+                if (transition.ReleasingPass >= 0)
                 {
-                    RGBarrier barrier;
-                    barrier.Resource = handle;
-                    barrier.Before = current;
-                    barrier.After = targetState;
-                    pass.Barriers.push_back(barrier);
-                    currentStates[id] = targetState;
+                    barrier.SourceQueue = transition.SourceQueue;
+                    barrier.DestinationQueue = pass.Queue;
+                    m_Passes[transition.ReleasingPass].ReleaseBarriers.push_back(barrier);
+                }
+                else if (transition.SplitAfterPass >= 0)
+                {
+                    const uint64_t key = (static_cast<uint64_t>(transition.SplitAfterPass) << 32) | passIndex;
+                    barrier.Split = splitIndices.try_emplace(key, static_cast<uint32_t>(splitIndices.size())).first->second;
+                    m_Passes[transition.SplitAfterPass].SplitBarrierBegins.push_back(barrier);
+                }
+                pass.Barriers.push_back(barrier);
+            };
+
+            auto TransitionResource = [&](RGResourceHandle handle, RHI::ResourceState targetState, bool isWrite)
+            {
+                const uint32_t id = handle.ID;
+                const uint32_t first = firstSubresources[id];
+                if (firstSubresources[id + 1] - first == 1)
+                {
+                    SubresourceTransition transition;
+                    if (TransitionSubresource(first, targetState, isWrite, transition)) EmitBarrier(transition, handle, targetState);
+                    return;
+                }
+
+                // Subresources of the range that need the same transition share one barrier.
+                const auto& desc = m_Resources[id].TextureDesc;
+                const auto range = handle.GetSubresources();
+                const uint32_t mipEnd = range.MipCount == RHI::TextureSubresourceRange::Remaining ? desc.MipLevels : range.BaseMip + range.MipCount;
+                const uint32_t layerEnd = range.LayerCount == RHI::TextureSubresourceRange::Remaining ? desc.ArrayLayers : range.BaseLayer + range.LayerCount;
+                transitions.clear();
+                for (uint32_t mip = range.BaseMip; mip < mipEnd; ++mip)
+                {
+                    for (uint32_t layer = range.BaseLayer; layer < layerEnd; ++layer)
+                    {
+                        SubresourceTransition transition;
+                        transition.Mip = static_cast<uint16_t>(mip);
+                        transition.Layer = static_cast<uint16_t>(layer);
+                        if (TransitionSubresource(first + mip * desc.ArrayLayers + layer, targetState, isWrite, transition))
+                            transitions.push_back(transition);
+                    }
                 }
-                wasLastWrite[id] = isWrite;
+                MergeSubresourceTransitions(handle.Whole(), desc.MipLevels, desc.ArrayLayers, transitions, mergeLookup,
+                    [&](const SubresourceTransition& transition, RGResourceHandle merged) { EmitBarrier(transition, merged, targetState); });
             };
 
             for (auto& handle : pass.Reads)
@@ -736,6 +1937,103 @@ namespace Mixture
                  TransitionResource(handle, RHI::ResourceState::UnorderedAccess, true);
             }
         }
+        m_SplitBarrierCount = static_cast<uint32_t>(splitIndices.size());
+
+        // Imported resources are handed back in their requested final state. Undefined
+        // marks resources this graph leaves untouched.
+        m_FinalBarriers.clear();
+        m_FinalStates.assign(m_Resources.size(), RHI::ResourceState::Undefined);
+        for (size_t i = 0; i < m_Resources.size(); ++i)
+        {
+            const auto& node = m_Resources[i];
+            if (node.Type != RGResourceType::ImportedTexture && node.Type != RGResourceType::ImportedBuffer) continue;
+
+            const uint32_t first = firstSubresources[i];
+            const uint32_t last = firstSubresources[i + 1];
+            if (last - first == 1)
+            {
+                if (lastUsers[first] >= 0) m_FinalStates[i] = currentStates[first];
+
+                // A resource last used on another queue would need an ownership transfer the
+                // frame's list cannot wait for; it keeps the state of its last use.
+                if (node.FinalState == RHI::ResourceState::Undefined || node.FinalState == currentStates[first] ||
+                    owningQueues[first] != RHI::QueueType::Graphics)
+                {
+                    continue;
+                }
+
+                RGBarrier barrier;
+                barrier.Resource = node.Handle;
+                barrier.Before = currentStates[first];
+                barrier.After = node.FinalState;
+                m_FinalBarriers.push_back(barrier);
+                m_FinalStates[i] = node.FinalState;
+                continue;
+            }
+
+            // The ResourceStateTracker keeps one state per texture, so all subresources end in
+            // the same one: the requested final state, or else the state of the latest access.
+            // Subresources last used on another queue cannot move and the others follow them.
+            const auto lastUsed = std::max_element(lastUsers.begin() + first, lastUsers.begin() + last);
+            if (*lastUsed < 0) continue;
+
+            RHI::ResourceState target = node.FinalState != RHI::ResourceState::Undefined
+                ? node.FinalState : currentStates[lastUsed - lastUsers.begin()];
+            for (uint32_t subresource = first; subresource < last; ++subresource)
+            {
+                if (owningQueues[subresource] != RHI::QueueType::Graphics)
+                {
+                    target = currentStates[subresource];
+                    break;
+                }
+            }
+
+            const uint32_t layers = node.TextureDesc.ArrayLayers;
+            bool unified = true;
+            transitions.clear();
+            for (uint32_t subresource = first; subresource < last; ++subresource)
+            {
+                if (currentStates[subresource] == target) continue;
+                if (owningQueues[subresource] != RHI::QueueType::Graphics)
+                {
+                    unified = false;
+                    continue;
+                }
+
+                SubresourceTransition transition;
+                transition.Mip = static_cast<uint16_t>((subresource - first) / layers);
+                transition.Layer = static_cast<uint16_t>((subresource - first) % layers);
+                transition.Before = currentStates[subresource];
+                transitions.push_back(transition);
+            }
+            MergeSubresourceTransitions(node.Handle, node.TextureDesc.MipLevels, layers, transitions, mergeLookup,
+                [&](const SubresourceTransition& transition, RGResourceHandle merged)
+                {
+                    RGBarrier barrier;
+                    barrier.Resource = merged;
+                    barrier.Before = transition.Before;
+                    barrier.After = target;
+                    m_FinalBarriers.push_back(barrier);
+                });
+
+            // Mixed states cannot be tracked; the next import then starts from Undefined.
+            m_FinalStates[i] = unified ? target : RHI::ResourceState::Undefined;
+        }
+    }
+
+    void RenderGraph::SetRenderPassMerging(bool enabled)
+    {
+        if (m_RenderPassMerging == enabled) return;
+        m_RenderPassMerging = enabled;
+        m_Compiled.Valid = false;
+    }
+
+    void RenderGraph::SetSplitBarrierDistance(uint32_t passCount)
+    {
+        if (m_SplitBarrierDistance == passCount) return;
+        m_SplitBarrierDistance = passCount;
+        // Barriers of the cached schedule were placed for the previous distance.
+        m_Compiled.Valid = false;
     }
 
     bool RenderGraph::DumpDiagnostics(const std::filesystem::path& outputPath) const
@@ -758,13 +2056,17 @@ namespace Mixture
         for (size_t i = 0; i < m_Resources.size(); ++i)
         {
             const auto& resource = m_Resources[i];
-            const std::string name = resource.Name.empty() ? "Res_" + std::to_string(i) : resource.Name;
+            const std::string name = resource.Name.empty() ? "Res_" + std::to_string(i) : std::string(resource.Name);
             const bool isTexture = resource.Type == RGResourceType::Texture ||
                                    resource.Type == RGResourceType::ImportedTexture;
             json.BeginObject();
             json.Key("id"); json.Number(i);
             json.Key("name"); json.String(name);
             json.Key("type"); json.String(isTexture ? "Texture" : "Buffer");
+            if (resource.Memoryless)
+            {
+                json.Key("memoryless"); json.Bool(true);
+            }
             json.EndObject();
         }
         json.EndArray();
@@ -777,6 +2079,8 @@ namespace Mixture
             json.BeginObject();
             json.Key("id"); json.Number(i);
             json.Key("name"); json.String(pass.Name);
+            json.Key("level"); json.Number(pass.DependencyLevel);
+            json.Key("queue"); json.String(pass.Queue == RHI::QueueType::Compute ? "Compute" : "Graphics");
             json.Key("barriers");
             json.BeginArray();
             for (const auto& barrier : pass.Barriers)
@@ -785,10 +2089,28 @@ namespace Mixture
                 json.Key("res"); json.Number(barrier.Resource.ID);
                 json.Key("from"); json.String(RHI::ToString(barrier.Before));
                 json.Key("to"); json.String(RHI::ToString(barrier.After));
+                if (!barrier.Resource.IsWholeResource())
+                {
+                    const auto& desc = m_Resources[barrier.Resource.ID].TextureDesc;
+                    const auto& handle = barrier.Resource;
+                    json.Key("baseMip"); json.Number(handle.BaseMip);
+                    json.Key("mipCount"); json.Number(handle.MipCount ? handle.MipCount : desc.MipLevels);
+                    json.Key("baseLayer"); json.Number(handle.BaseLayer);
+                    json.Key("layerCount"); json.Number(handle.LayerCount ? handle.LayerCount : desc.ArrayLayers);
+                }
+                if (barrier.Split != RGBarrier::NoSplit)
+                {
+                    json.Key("split"); json.Number(barrier.Split);
+                }
                 json.EndObject();
             }
             json.EndArray();
 
+            json.Key("releases");
+            json.BeginArray();
+            for (const auto& barrier : pass.ReleaseBarriers) json.Number(barrier.Resource.ID);
+            json.EndArray();
+
             json.Key("writes");
             json.BeginArray();
             for (const auto& write : pass.Writes) json.Number(write.Handle.ID);
@@ -801,6 +2123,74 @@ namespace Mixture
             json.EndObject();
         }
         json.EndArray();
+
+        json.Key("submissions");
+        json.BeginArray();
+        for (const auto& submission : m_Submissions)
+        {
+            json.BeginObject();
+            json.Key("queue"); json.String(submission.Queue == RHI::QueueType::Compute ? "Compute" : "Graphics");
+            json.Key("passes");
+            json.BeginArray();
+            for (const uint32_t passIndex : submission.Passes) json.Number(passIndex);
+            json.EndArray();
+            json.Key("waits");
+            json.BeginArray();
+            for (const uint32_t wait : submission.WaitSubmissions) json.Number(wait);
+            json.EndArray();
+            json.EndObject();
+        }
+        json.EndArray();
+
+        json.Key("fusedPasses");
+        json.BeginArray();
+        for (size_t first = 0; first < m_Passes.size();)
+        {
+            size_t last = first;
+            while (m_Passes[last].MergedWithNext) ++last;
+            if (last > first)
+            {
+                json.BeginObject();
+                json.Key("passes");
+                json.BeginArray();
+                for (size_t passIndex = first; passIndex <= last; ++passIndex) json.Number(passIndex);
+                json.EndArray();
+                json.Key("attachments");
+                json.BeginArray();
+                for (const auto& write : m_Passes[first].Writes)
+                {
+                    json.BeginObject();
+                    json.Key("res"); json.Number(write.Handle.ID);
+                    json.Key("load"); json.String(RHI::ToString(write.LoadOp));
+                    json.Key("store"); json.String(RHI::ToString(write.StoreOp));
+                    json.EndObject();
+                }
+                json.EndArray();
+                json.EndObject();
+            }
+            first = last + 1;
+        }
+        json.EndArray();
+
+        // Timings belong to the latest resolved frame, whose schedule may differ from the one above.
+        const auto& timings = m_Profiler.GetResults();
+        if (!timings.empty())
+        {
+            json.Key("timings");
+            json.BeginArray();
+            for (const auto& timing : timings)
+            {
+                json.BeginObject();
+                json.Key("name"); json.String(timing.Name);
+                json.Key("cpuMs"); json.Decimal(timing.CpuTimeMs);
+                if (timing.GpuTimeMs >= 0.0f)
+                {
+                    json.Key("gpuMs"); json.Decimal(timing.GpuTimeMs);
+                }
+                json.EndObject();
+            }
+            json.EndArray();
+        }
         json.EndObject();
         out << '\n';
 
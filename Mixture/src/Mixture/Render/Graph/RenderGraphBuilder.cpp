@@ -19,9 +19,13 @@ namespace Mixture
         if (!handle.IsValid())
             throw std::out_of_range("RenderGraphBuilder::Read received an invalid handle");
 
+        handle = m_Graph.ResolveSubresources(handle);
+
         // Record that this pass READS this resource
         m_PassNode.Reads.push_back(handle);
-        m_Graph.AddTextureUsage(handle, RHI::TextureUsage::Sampled);
+        const auto type = m_Graph.GetResourceNode(handle).Type;
+        if (type == RGResourceType::Texture || type == RGResourceType::ImportedTexture)
+            m_Graph.AddTextureUsage(handle, RHI::TextureUsage::Sampled);
         return handle;
     }
 
@@ -33,7 +37,7 @@ namespace Mixture
         const auto& node = m_Graph.GetResourceNode(handle);
         if (node.Type == RGResourceType::Buffer || node.Type == RGResourceType::ImportedBuffer)
         {
-            m_PassNode.BufferWrites.push_back(handle);
+            m_PassNode.BufferWrites.push_back(m_Graph.ResolveSubresources(handle));
             return handle;
         }
         else
@@ -52,21 +56,24 @@ namespace Mixture
         if (!info.Handle.IsValid())
             throw std::out_of_range("RenderGraphBuilder::Write received an invalid attachment handle");
 
-        m_PassNode.Writes.push_back(info);
         const RHI::TextureDesc& desc = m_Graph.GetTextureDesc(info.Handle);
+        const RGResourceHandle handle = m_Graph.ResolveSubresources(info.Handle);
+
+        // An attachment is a single image; textures with several mips or layers are rendered one at a time.
+        const bool singleMip = handle.MipCount == 1 || desc.MipLevels == 1;
+        const bool singleLayer = handle.LayerCount == 1 || desc.ArrayLayers == 1;
+        if (!singleMip || !singleLayer)
+            throw std::invalid_argument("RenderGraphBuilder::Write attachments must address a single mip and layer");
+
+        m_PassNode.Writes.push_back(info);
+        m_PassNode.Writes.back().Handle = handle;
 
         if (RHI::IsDepthFormat(desc.PixelFormat))
-        {
             m_Graph.AddTextureUsage(info.Handle, RHI::TextureUsage::DepthStencilAttachment);
-            m_CurrentDepthFormat = desc.PixelFormat;
-        }
         else
-        {
             m_Graph.AddTextureUsage(info.Handle, RHI::TextureUsage::ColorAttachment);
-            m_CurrentColorFormats.push_back(desc.PixelFormat);
-        }
 
-        return info.Handle;
+        return handle;
     }
 
     void RenderGraphBuilder::SetSideEffect()
@@ -74,17 +81,27 @@ namespace Mixture
         m_PassNode.HasSideEffects = true;
     }
 
-    RGResourceHandle RenderGraphBuilder::CreateTexture(const std::string& name, const RHI::TextureDesc& desc)
+    void RenderGraphBuilder::SetQueue(RHI::QueueType queue)
+    {
+        m_PassNode.Queue = queue;
+    }
+
+    RGResourceHandle RenderGraphBuilder::CreateTexture(RGResourceName name, const RHI::TextureDesc& desc)
     {
         // Delegate the actual allocation logic to the main graph
         return m_Graph.CreateResource(name, desc);
     }
 
-    RGResourceHandle RenderGraphBuilder::CreateBuffer(const std::string& name, const RHI::BufferDesc& desc)
+    RGResourceHandle RenderGraphBuilder::CreateBuffer(RGResourceName name, const RHI::BufferDesc& desc)
     {
         return m_Graph.CreateResource(name, desc);
     }
 
+    const RHI::TextureDesc& RenderGraphBuilder::GetTextureDesc(RGResourceHandle handle) const
+    {
+        return m_Graph.GetTextureDesc(handle);
+    }
+
     RHI::IShader* RenderGraphBuilder::LoadShader(const std::string& path, RHI::ShaderStage stage)
     {
         return LoadShader(ResolveShader(path), stage);
@@ -108,8 +125,15 @@ namespace Mixture
             return nullptr;
         }
 
-        desc.ColorAttachmentFormats = m_CurrentColorFormats;
-        desc.DepthAttachmentFormat = m_CurrentDepthFormat;
+        // Formats are derived from the pass writes only here, so declaring writes stays allocation-free.
+        desc.ColorAttachmentFormats.clear();
+        desc.DepthAttachmentFormat = RHI::Format::Undefined;
+        for (const auto& write : m_PassNode.Writes)
+        {
+            const RHI::Format format = m_Graph.GetTextureDesc(write.Handle).PixelFormat;
+            if (RHI::IsDepthFormat(format)) desc.DepthAttachmentFormat = format;
+            else desc.ColorAttachmentFormats.push_back(format);
+        }
 
         if (desc.ColorAttachmentFormats.empty() && desc.DepthAttachmentFormat == RHI::Format::Undefined)
         {
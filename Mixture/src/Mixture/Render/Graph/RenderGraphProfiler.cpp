@@ -0,0 +1,68 @@
+#include "mxpch.hpp"
+#include "Mixture/Render/Graph/RenderGraphProfiler.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace Mixture
+{
+    void RenderGraphProfiler::BeginFrame(const RHI::IGraphicsContext& context, std::span<const RGPassNode> passes)
+    {
+        const uint32_t slotIndex = context.GetCurrentFrameIndex();
+        if (slotIndex >= m_Slots.size()) m_Slots.resize(slotIndex + 1);
+        if (!m_Slots[slotIndex].Passes.empty()) Resolve(context, slotIndex);
+
+        m_CurrentSlot = slotIndex;
+        auto& slot = m_Slots[slotIndex];
+        slot.HasTimestamps = !passes.empty() && passes.size() * 2 <= context.GetTimestampQueryCount();
+        slot.Passes.resize(passes.size());
+        for (size_t index = 0; index < passes.size(); ++index)
+        {
+            slot.Passes[index] = { passes[index].Name, {}, 0.0f };
+        }
+    }
+
+    void RenderGraphProfiler::BeginPass(size_t passIndex, RHI::ICommandList* cmdList)
+    {
+        auto& slot = m_Slots[m_CurrentSlot];
+        if (slot.HasTimestamps && cmdList) cmdList->WriteTimestamp(static_cast<uint32_t>(passIndex * 2));
+        slot.Passes[passIndex].CpuBegin = std::chrono::steady_clock::now();
+    }
+
+    void RenderGraphProfiler::EndPass(size_t passIndex, RHI::ICommandList* cmdList)
+    {
+        auto& slot = m_Slots[m_CurrentSlot];
+        auto& record = slot.Passes[passIndex];
+        record.CpuTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - record.CpuBegin).count();
+        if (slot.HasTimestamps && cmdList) cmdList->WriteTimestamp(static_cast<uint32_t>(passIndex * 2 + 1));
+    }
+
+    void RenderGraphProfiler::Resolve(const RHI::IGraphicsContext& context, uint32_t slotIndex)
+    {
+        const auto& slot = m_Slots[slotIndex];
+        m_Timestamps.resize(slot.Passes.size() * 2);
+        const bool hasGpuTimes = slot.HasTimestamps && context.ReadTimestamps(slotIndex, 0, m_Timestamps);
+        const double msPerTick = context.GetTimestampPeriod() / 1'000'000.0;
+
+        // Async compute passes overlap graphics work, so the frame spans from the
+        // earliest to the latest timestamp rather than from the first to the last pass.
+        uint64_t frameBegin = std::numeric_limits<uint64_t>::max();
+        uint64_t frameEnd = 0;
+        m_Results.resize(slot.Passes.size());
+        for (size_t index = 0; index < slot.Passes.size(); ++index)
+        {
+            auto& result = m_Results[index];
+            result.Name = slot.Passes[index].Name;
+            result.CpuTimeMs = slot.Passes[index].CpuTimeMs;
+            result.GpuTimeMs = -1.0f;
+            if (!hasGpuTimes) continue;
+
+            const uint64_t begin = m_Timestamps[index * 2];
+            const uint64_t end = std::max(begin, m_Timestamps[index * 2 + 1]);
+            result.GpuTimeMs = static_cast<float>(static_cast<double>(end - begin) * msPerTick);
+            frameBegin = std::min(frameBegin, begin);
+            frameEnd = std::max(frameEnd, end);
+        }
+        m_GpuFrameTimeMs = hasGpuTimes ? static_cast<float>(static_cast<double>(frameEnd - frameBegin) * msPerTick) : -1.0f;
+    }
+}
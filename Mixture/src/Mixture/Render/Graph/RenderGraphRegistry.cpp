@@ -17,7 +17,7 @@ namespace Mixture
         m_Textures[handle.ID] = texture;
     }
 
-    RHI::ITexture* RenderGraphRegistry::GetTexture(RGResourceHandle handle)
+    RHI::ITexture* RenderGraphRegistry::GetTexture(RGResourceHandle handle) const
     {
         if (!handle.IsValid()) {
             return nullptr;
@@ -40,7 +40,7 @@ namespace Mixture
         }
     }
 
-    void RenderGraphRegistry::RegisterBuffer(RGResourceHandle handle, RHI::IBuffer* buffer)
+    void RenderGraphRegistry::RegisterBuffer(RGResourceHandle handle, RHI::IBuffer* buffer, const RHI::BufferRange& range)
     {
         if (!handle.IsValid()) return;
 
@@ -48,12 +48,14 @@ namespace Mixture
         if (handle.ID >= m_Buffers.size())
         {
             m_Buffers.resize(handle.ID + 1, nullptr);
+            m_BufferRanges.resize(handle.ID + 1);
         }
 
         m_Buffers[handle.ID] = buffer;
+        m_BufferRanges[handle.ID] = range;
     }
 
-    RHI::IBuffer* RenderGraphRegistry::GetBuffer(RGResourceHandle handle)
+    RHI::IBuffer* RenderGraphRegistry::GetBuffer(RGResourceHandle handle) const
     {
         if (!handle.IsValid()) {
             return nullptr;
@@ -66,11 +68,18 @@ namespace Mixture
         return m_Buffers[handle.ID];
     }
 
+    RHI::BufferRange RenderGraphRegistry::GetBufferRange(RGResourceHandle handle) const
+    {
+        if (!handle.IsValid() || handle.ID >= m_BufferRanges.size()) return {};
+        return m_BufferRanges[handle.ID];
+    }
+
     void RenderGraphRegistry::UnregisterBuffer(RGResourceHandle handle)
     {
         if (handle.IsValid() && handle.ID < m_Buffers.size())
         {
             m_Buffers[handle.ID] = nullptr;
+            m_BufferRanges[handle.ID] = {};
         }
     }
 
@@ -88,5 +97,6 @@ namespace Mixture
     {
         m_Textures.clear();
         m_Buffers.clear();
+        m_BufferRanges.clear();
     }
 }
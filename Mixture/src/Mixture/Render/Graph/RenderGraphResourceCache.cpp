@@ -2,9 +2,102 @@
 #include "Mixture/Render/Graph/RenderGraphResourceCache.hpp"
 
 #include <algorithm>
+#include <bit>
 
 namespace Mixture
 {
+    namespace
+    {
+        /** @brief A transient waiting for a heap offset, together with its pass interval. */
+        struct PlacementRequest
+        {
+            size_t Resource = 0;
+            RHI::MemoryRequirements Requirements;
+            int32_t FirstPassIndex = -1;
+            int32_t LastPassIndex = -1;
+            uint64_t Offset = 0;
+        };
+
+        /** @brief Requests that may share one heap: intersecting memory types. */
+        struct HeapGroup
+        {
+            uint32_t MemoryTypeBits = ~0u;
+            uint64_t Alignment = 1;
+            Vector<PlacementRequest*> Requests;
+        };
+
+        uint64_t AlignUp(uint64_t value, uint64_t alignment)
+        {
+            return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+        }
+
+        bool LifetimesOverlap(const PlacementRequest& lhs, const PlacementRequest& rhs)
+        {
+            return lhs.FirstPassIndex <= rhs.LastPassIndex && rhs.FirstPassIndex <= lhs.LastPassIndex;
+        }
+
+        /**
+         * Greedy first-fit packing. Larger requests are placed first, each at the lowest
+         * aligned offset that does not intersect a request alive during the same passes.
+         *
+         * @return The heap size needed to hold every request.
+         */
+        uint64_t PackRequests(Vector<PlacementRequest*>& requests)
+        {
+            std::stable_sort(requests.begin(), requests.end(), [](const PlacementRequest* lhs, const PlacementRequest* rhs)
+            {
+                return lhs->Requirements.Size > rhs->Requirements.Size;
+            });
+
+            uint64_t heapSize = 0;
+            Vector<std::pair<uint64_t, uint64_t>> occupied;
+            for (size_t index = 0; index < requests.size(); ++index)
+            {
+                PlacementRequest& request = *requests[index];
+
+                occupied.clear();
+                for (size_t placed = 0; placed < index; ++placed)
+                {
+                    const PlacementRequest& other = *requests[placed];
+                    if (LifetimesOverlap(request, other))
+                        occupied.emplace_back(other.Offset, other.Offset + other.Requirements.Size);
+                }
+                std::sort(occupied.begin(), occupied.end());
+
+                uint64_t offset = 0;
+                for (const auto& [begin, end] : occupied)
+                {
+                    offset = AlignUp(offset, request.Requirements.Alignment);
+                    if (offset + request.Requirements.Size <= begin) break;
+                    offset = std::max(offset, end);
+                }
+                request.Offset = AlignUp(offset, request.Requirements.Alignment);
+                heapSize = std::max(heapSize, request.Offset + request.Requirements.Size);
+            }
+            return heapSize;
+        }
+
+        /** Rounds up to one of four steps per power of two, so the result is less than a quarter larger. */
+        uint32_t RoundToSizeClass(uint32_t extent)
+        {
+            if (extent <= 4) return extent;
+            const uint32_t step = std::bit_floor(extent) / 4;
+            return (extent + step - 1) / step * step;
+        }
+
+        /** Restricts a memoryless transient to attachment usage, as lazily allocated images require. */
+        RHI::TextureDesc GetMemorylessDesc(const RHI::TextureDesc& desc)
+        {
+            RHI::TextureDesc result = desc;
+            result.Usage = RHI::TextureUsage::TransientAttachment;
+            if (RHI::HasUsage(desc.Usage, RHI::TextureUsage::ColorAttachment))
+                result.Usage |= RHI::TextureUsage::ColorAttachment;
+            if (RHI::HasUsage(desc.Usage, RHI::TextureUsage::DepthStencilAttachment))
+                result.Usage |= RHI::TextureUsage::DepthStencilAttachment;
+            return result;
+        }
+    }
+
     RenderGraphResourceCache::RenderGraphResourceCache(RHI::IGraphicsDevice& device)
         : m_Device(device)
     {
@@ -18,16 +111,19 @@ namespace Mixture
     void RenderGraphResourceCache::BeginFrame(uint32_t frameIndex)
     {
         m_CurrentFrameIndex = frameIndex;
+        ++m_FrameCounter;
         m_FrameActive = true;
 
-        auto prepareCache = [frameIndex](auto& cache)
+        auto prepareCache = [this, frameIndex](auto& cache)
         {
             for (auto bucket = cache.begin(); bucket != cache.end();)
             {
                 auto& entries = bucket->second;
-                std::erase_if(entries, [frameIndex](const auto& entry)
+                std::erase_if(entries, [this, frameIndex](const auto& entry)
                 {
-                    return entry.FrameIndex == frameIndex && !entry.UsedInLastFrame;
+                    const bool retired = entry.FrameIndex == frameIndex && !entry.UsedInLastFrame;
+                    if (retired) m_PooledBytes -= entry.Bytes;
+                    return retired;
                 });
 
                 for (auto& entry : entries)
@@ -42,27 +138,63 @@ namespace Mixture
 
         prepareCache(m_TextureCache);
         prepareCache(m_BufferCache);
+
+        // Aliased heaps follow the same two-use retirement rule as pooled entries.
+        const auto aliased = m_AliasedFrames.find(frameIndex);
+        if (aliased != m_AliasedFrames.end())
+        {
+            if (!aliased->second.UsedInLastFrame) m_AliasedFrames.erase(aliased);
+            else aliased->second.UsedInLastFrame = false;
+        }
+    }
+
+    RHI::TextureDesc RenderGraphResourceCache::GetPhysicalDesc(const RHI::TextureDesc& desc) const
+    {
+        if (!m_Policy.UseSizeClasses) return desc;
+
+        // Rounding up only grows the extent, so the requested mip count stays valid.
+        RHI::TextureDesc physical = desc;
+        physical.Width = RoundToSizeClass(desc.Width);
+        physical.Height = RoundToSizeClass(desc.Height);
+        return physical;
     }
 
-    Ref<RHI::ITexture> RenderGraphResourceCache::GetOrCreateTexture(const RHI::TextureDesc& desc)
+    RHI::TextureDesc RenderGraphResourceCache::GetPhysicalDesc(const RGResourceNode& node) const
+    {
+        RHI::TextureDesc desc = node.TextureDesc;
+        if (node.AllocationWidth != 0)
+        {
+            desc.Width = node.AllocationWidth;
+            desc.Height = node.AllocationHeight;
+        }
+        return GetPhysicalDesc(desc);
+    }
+
+    Ref<RHI::ITexture> RenderGraphResourceCache::GetOrCreateTexture(const RHI::TextureDesc& requestedDesc)
     {
         if (!m_FrameActive) return nullptr;
 
-        TextureKey key{ desc.Width, desc.Height, desc.PixelFormat, desc.InitialState };
+        const RHI::TextureDesc desc = GetPhysicalDesc(requestedDesc);
+        TextureKey key{ desc.Width, desc.Height, desc.PixelFormat, desc.InitialState, desc.Usage, desc.MipLevels, desc.ArrayLayers };
         auto& entries = m_TextureCache[key];
         for (auto& entry : entries)
         {
             if (entry.FrameIndex == m_CurrentFrameIndex && !entry.UsedInLastFrame)
             {
                 entry.UsedInLastFrame = true;
+                entry.LastUsedFrame = m_FrameCounter;
+                ++m_Statistics.PoolHits;
                 return entry.ResourceRef;
             }
         }
 
+        ++m_Statistics.PoolMisses;
         auto texture = m_Device.CreateTexture(desc);
         if (texture)
         {
-            entries.push_back({ texture, m_CurrentFrameIndex, true });
+            const uint64_t bytes = EstimateBytes(desc);
+            entries.push_back({ texture, m_CurrentFrameIndex, true, m_FrameCounter, bytes });
+            m_PooledBytes += bytes;
         }
         return texture;
     }
@@ -78,22 +210,296 @@ namespace Mixture
             if (entry.FrameIndex == m_CurrentFrameIndex && !entry.UsedInLastFrame)
             {
                 entry.UsedInLastFrame = true;
+                entry.LastUsedFrame = m_FrameCounter;
+                ++m_Statistics.PoolHits;
                 return entry.ResourceRef;
             }
         }
 
+        ++m_Statistics.PoolMisses;
         auto buffer = m_Device.CreateBuffer(desc);
         if (buffer)
         {
-            entries.push_back({ buffer, m_CurrentFrameIndex, true });
+            entries.push_back({ buffer, m_CurrentFrameIndex, true, m_FrameCounter, desc.Size });
+            m_PooledBytes += desc.Size;
         }
         return buffer;
     }
 
+    const Vector<RenderGraphResourceCache::TransientResource>& RenderGraphResourceCache::AcquireTransients(
+        const Vector<RGResourceNode>& resources)
+    {
+        m_Transients.clear();
+        m_Transients.resize(resources.size());
+        m_Statistics = {};
+        if (!m_FrameActive) return m_Transients;
+
+        // Scratch storage keeps its capacity, so an unchanged graph compares without allocating.
+        // Buffers are suballocated every frame and never force the textures to be placed again.
+        auto& signature = m_SignatureScratch;
+        signature.clear();
+        for (const auto& node : resources)
+        {
+            if (node.FirstPassIndex < 0 || node.Type != RGResourceType::Texture) continue;
+
+            // Size classes and allocation extents keep the placement of a graph whose resolution changes.
+            auto& entry = signature.emplace_back();
+            entry.ID = node.Handle.ID;
+            entry.TextureDesc = GetPhysicalDesc(node);
+            entry.FirstPassIndex = node.FirstPassIndex;
+            entry.LastPassIndex = node.LastPassIndex;
+            entry.UsedByAsyncQueue = node.UsedByAsyncQueue;
+            entry.Memoryless = node.Memoryless;
+        }
+
+        // The slot's previous placement is no longer referenced by the GPU once
+        // BeginFrame was called for it, so a changed graph may simply rebuild it.
+        auto& frame = m_AliasedFrames[m_CurrentFrameIndex];
+        frame.UsedInLastFrame = true;
+        if (frame.Placed.size() != resources.size() || frame.Signature != signature)
+        {
+            frame.Signature = signature;
+            BuildAliasedFrame(frame, resources);
+        }
+        SuballocateBuffers(frame, resources);
+        m_Statistics = frame.Stats;
+
+        for (size_t index = 0; index < resources.size(); ++index)
+        {
+            const auto& node = resources[index];
+            if (node.FirstPassIndex < 0) continue;
+
+            if (node.Type == RGResourceType::Texture)
+            {
+                const auto& placed = frame.Placed[index].Texture;
+                if (placed) m_Transients[index].Texture = placed;
+                else if (node.Memoryless) m_Transients[index].Texture = GetOrCreateTexture(GetMemorylessDesc(GetPhysicalDesc(node)));
+                else m_Transients[index].Texture = GetOrCreateTexture(GetPhysicalDesc(node));
+            }
+            else if (node.Type == RGResourceType::Buffer)
+            {
+                const auto& placed = frame.Placed[index];
+                if (placed.Buffer) m_Transients[index] = placed;
+                else m_Transients[index].Buffer = GetOrCreateBuffer(node.BufferDesc);
+            }
+        }
+
+        EnforceBudget();
+        m_Statistics.PooledBytes = m_PooledBytes;
+        return m_Transients;
+    }
+
+    void RenderGraphResourceCache::BuildAliasedFrame(AliasedFrame& frame, const Vector<RGResourceNode>& resources)
+    {
+        frame.Heaps.clear();
+        frame.Placed.clear();
+        frame.Placed.resize(resources.size());
+        frame.Stats = {};
+
+        Vector<PlacementRequest> requests;
+        requests.reserve(resources.size());
+        for (size_t index = 0; index < resources.size(); ++index)
+        {
+            const auto& node = resources[index];
+            if (node.FirstPassIndex < 0) continue;
+            // Pass intervals say nothing about overlap with work running on another queue.
+            if (node.UsedByAsyncQueue || node.Memoryless) continue;
+
+            // Placed memory starts out undefined, so only textures without an initial state can alias.
+            if (node.Type != RGResourceType::Texture || node.TextureDesc.InitialState != RHI::ResourceState::Undefined) continue;
+
+            const auto requirements = m_Device.GetMemoryRequirements(GetPhysicalDesc(node));
+            if (!requirements || requirements->Size == 0) continue;
+            requests.push_back({ index, *requirements, node.FirstPassIndex, node.LastPassIndex });
+        }
+
+        Vector<HeapGroup> groups;
+        for (auto& request : requests)
+        {
+            const uint32_t typeBits = request.Requirements.MemoryTypeBits;
+            auto group = std::find_if(groups.begin(), groups.end(), [&](const HeapGroup& candidate)
+            {
+                return (candidate.MemoryTypeBits & typeBits) != 0;
+            });
+            if (group == groups.end()) group = groups.insert(groups.end(), HeapGroup{});
+
+            group->MemoryTypeBits &= typeBits;
+            group->Alignment = std::max(group->Alignment, request.Requirements.Alignment);
+            group->Requests.push_back(&request);
+        }
+
+        for (auto& group : groups)
+        {
+            // A lone transient gains nothing from a heap and is better served by pooling.
+            if (group.Requests.size() < 2) continue;
+
+            const uint64_t heapSize = PackRequests(group.Requests);
+            auto heap = m_Device.CreateMemoryHeap({ heapSize, group.Alignment, group.MemoryTypeBits });
+            if (!heap) continue;
+
+            uint64_t placedBytes = 0;
+            for (const PlacementRequest* request : group.Requests)
+            {
+                auto& placed = frame.Placed[request->Resource];
+                placed.Texture = m_Device.CreatePlacedTexture(GetPhysicalDesc(resources[request->Resource]),
+                    heap, request->Offset);
+                if (!placed.Texture) continue;
+                placedBytes += request->Requirements.Size;
+                ++frame.Stats.AliasedResources;
+            }
+
+            frame.Stats.RequestedBytes += placedBytes;
+            frame.Stats.HeapBytes += heap->GetSize();
+            ++frame.Stats.HeapCount;
+            frame.Heaps.push_back(std::move(heap));
+        }
+
+        frame.Stats.BytesSavedByAliasing = frame.Stats.RequestedBytes > frame.Stats.HeapBytes
+            ? frame.Stats.RequestedBytes - frame.Stats.HeapBytes : 0;
+
+        if (frame.Stats.HeapCount > 0)
+        {
+            OPAL_LOG_DEBUG("Core/RenderGraph", "Placed {} transients into {} heaps ({} bytes, {} saved by aliasing)",
+                frame.Stats.AliasedResources, frame.Stats.HeapCount, frame.Stats.HeapBytes, frame.Stats.BytesSavedByAliasing);
+        }
+    }
+
+    void RenderGraphResourceCache::SuballocateBuffers(AliasedFrame& frame, const Vector<RGResourceNode>& resources)
+    {
+        const auto findLinearBuffer = [&frame](RHI::BufferUsage usage) -> LinearBuffer&
+        {
+            const auto it = std::find_if(frame.LinearBuffers.begin(), frame.LinearBuffers.end(),
+                [usage](const LinearBuffer& candidate) { return candidate.Usage == usage; });
+            if (it != frame.LinearBuffers.end()) return *it;
+            return frame.LinearBuffers.emplace_back(LinearBuffer{ usage });
+        };
+        const auto isSuballocated = [](const RGResourceNode& node)
+        {
+            return node.FirstPassIndex >= 0 && node.Type == RGResourceType::Buffer && node.BufferDesc.Size > 0;
+        };
+
+        frame.Stats.SuballocatedBuffers = 0;
+        frame.Stats.LinearBufferBytes = 0;
+
+        // Every transient gets its own range, so buffers alive during the same passes never collide.
+        for (auto& linear : frame.LinearBuffers) linear.Head = 0;
+        for (size_t index = 0; index < resources.size(); ++index)
+        {
+            const auto& node = resources[index];
+            if (!isSuballocated(node)) continue;
+
+            LinearBuffer& linear = findLinearBuffer(node.BufferDesc.Usage);
+            const uint64_t offset = AlignUp(linear.Head, TransientBufferAlignment);
+            frame.Placed[index].Range = { offset, node.BufferDesc.Size };
+            linear.Head = offset + node.BufferDesc.Size;
+        }
+
+        // The GPU is done with the slot's buffers once BeginFrame was called for it, so a buffer
+        // that became too small is simply replaced. Growing to the next power of two keeps a
+        // slowly growing graph from replacing it every frame.
+        for (auto& linear : frame.LinearBuffers)
+        {
+            if (linear.Head == 0 || (linear.Buffer && linear.Buffer->GetSize() >= linear.Head)) continue;
+
+            RHI::BufferDesc desc;
+            desc.Size = std::max(std::bit_ceil(linear.Head), MinimumLinearBufferSize);
+            desc.Usage = linear.Usage;
+            desc.DebugName = "RenderGraph Linear Buffer";
+            linear.Buffer = m_Device.CreateBuffer(desc);
+        }
+
+        for (size_t index = 0; index < resources.size(); ++index)
+        {
+            const auto& node = resources[index];
+            if (node.Type != RGResourceType::Buffer) continue;
+
+            // Without a linear buffer the transient falls back to descriptor pooling.
+            auto& placed = frame.Placed[index];
+            placed.Buffer = isSuballocated(node) ? findLinearBuffer(node.BufferDesc.Usage).Buffer : nullptr;
+            if (placed.Buffer) ++frame.Stats.SuballocatedBuffers;
+            else placed.Range = {};
+        }
+
+        for (const auto& linear : frame.LinearBuffers)
+        {
+            if (linear.Buffer) frame.Stats.LinearBufferBytes += linear.Buffer->GetSize();
+        }
+    }
+
+    uint64_t RenderGraphResourceCache::EstimateBytes(const RHI::TextureDesc& desc) const
+    {
+        if (const auto requirements = m_Device.GetMemoryRequirements(desc)) return requirements->Size;
+
+        // A full mip chain adds a third of the top level.
+        const uint64_t level = RHI::GetTextureUploadSize(desc).value_or(0);
+        const uint64_t layer = desc.MipLevels > 1 ? level + level / 3 : level;
+        return layer * desc.ArrayLayers;
+    }
+
+    void RenderGraphResourceCache::EnforceBudget()
+    {
+        if (m_Policy.BudgetBytes == 0 || m_PooledBytes <= m_Policy.BudgetBytes) return;
+
+        // An idle entry was not used by its slot's latest frame, and every earlier frame
+        // of that slot has completed, so no frame in flight references it.
+        auto& candidates = m_EvictionScratch;
+        candidates.clear();
+        const auto collect = [&candidates](const auto& cache)
+        {
+            for (const auto& [key, entries] : cache)
+            {
+                for (const auto& entry : entries)
+                {
+                    if (!entry.UsedInLastFrame) candidates.push_back({ entry.LastUsedFrame, entry.Bytes, entry.ResourceRef.get() });
+                }
+            }
+        };
+        collect(m_TextureCache);
+        collect(m_BufferCache);
+
+        std::sort(candidates.begin(), candidates.end(), [](const EvictionCandidate& lhs, const EvictionCandidate& rhs)
+        {
+            return lhs.LastUsedFrame < rhs.LastUsedFrame;
+        });
+        size_t evictionCount = 0;
+        for (uint64_t remaining = m_PooledBytes; evictionCount < candidates.size() && remaining > m_Policy.BudgetBytes; ++evictionCount)
+            remaining -= candidates[evictionCount].Bytes;
+        candidates.resize(evictionCount);
+        if (candidates.empty()) return;
+
+        const auto evict = [this, &candidates](auto& cache)
+        {
+            for (auto bucket = cache.begin(); bucket != cache.end();)
+            {
+                std::erase_if(bucket->second, [this, &candidates](const auto& entry)
+                {
+                    const void* resource = entry.ResourceRef.get();
+                    const bool evicted = std::any_of(candidates.begin(), candidates.end(),
+                        [resource](const EvictionCandidate& candidate) { return candidate.Resource == resource; });
+                    if (evicted)
+                    {
+                        m_PooledBytes -= entry.Bytes;
+                        ++m_Statistics.PoolEvictions;
+                    }
+                    return evicted;
+                });
+
+                if (bucket->second.empty()) bucket = cache.erase(bucket);
+                else ++bucket;
+            }
+        };
+        evict(m_TextureCache);
+        evict(m_BufferCache);
+    }
+
     void RenderGraphResourceCache::Clear()
     {
         m_TextureCache.clear();
         m_BufferCache.clear();
+        m_PooledBytes = 0;
+        m_AliasedFrames.clear();
+        m_Transients.clear();
+        m_Statistics = {};
         m_FrameActive = false;
     }
 }
@@ -0,0 +1,17 @@
+#include "mxpch.hpp"
+#include "Mixture/Render/RHI/ITexture.hpp"
+
+#include <atomic>
+
+namespace Mixture::RHI
+{
+    namespace
+    {
+        std::atomic<uint64_t> s_NextInstanceID = 1;
+    }
+
+    ITexture::ITexture()
+        : m_InstanceID(s_NextInstanceID.fetch_add(1, std::memory_order_relaxed))
+    {
+    }
+}
@@ -1,5 +1,8 @@
 #include "mxpch.hpp"
 #include "Mixture/Render/RenderStats.hpp"
+#include "Mixture/Render/Graph/RenderGraphProfiler.hpp"
+
+#include <atomic>
 
 namespace Mixture
 {
@@ -16,25 +19,41 @@ namespace Mixture
         m_FrameStats.VertexCount = 0;
         m_FrameStats.TriangleCount = 0;
         m_FrameStats.RenderPassCount = 0;
+        m_FrameStats.BarrierCount = 0;
+        m_FrameStats.BarrierBatchCount = 0;
+        m_FrameStats.TransientMemoryBytes = 0;
+        m_FrameStats.AliasingSavedBytes = 0;
+        m_FrameStats.TransientPoolHits = 0;
+        m_FrameStats.TransientPoolMisses = 0;
+        m_FrameStats.TransientPoolEvictions = 0;
+        m_FrameStats.TransientPoolBytes = 0;
     }
 
+    // Passes may be recorded on several TaskSystem workers at once, so the
+    // per-frame counters are updated atomically.
     void RenderStats::RecordDraw(uint32_t vertexCount, uint32_t instanceCount)
     {
-        m_FrameStats.DrawCalls++;
-        m_FrameStats.VertexCount += vertexCount * instanceCount;
-        m_FrameStats.TriangleCount += (vertexCount / 3) * instanceCount;
+        std::atomic_ref(m_FrameStats.DrawCalls).fetch_add(1, std::memory_order_relaxed);
+        std::atomic_ref(m_FrameStats.VertexCount).fetch_add(vertexCount * instanceCount, std::memory_order_relaxed);
+        std::atomic_ref(m_FrameStats.TriangleCount).fetch_add((vertexCount / 3) * instanceCount, std::memory_order_relaxed);
     }
 
     void RenderStats::RecordDrawIndexed(uint32_t indexCount, uint32_t instanceCount)
     {
-        m_FrameStats.DrawCalls++;
-        m_FrameStats.VertexCount += indexCount * instanceCount;
-        m_FrameStats.TriangleCount += (indexCount / 3) * instanceCount;
+        std::atomic_ref(m_FrameStats.DrawCalls).fetch_add(1, std::memory_order_relaxed);
+        std::atomic_ref(m_FrameStats.VertexCount).fetch_add(indexCount * instanceCount, std::memory_order_relaxed);
+        std::atomic_ref(m_FrameStats.TriangleCount).fetch_add((indexCount / 3) * instanceCount, std::memory_order_relaxed);
     }
 
     void RenderStats::RecordRenderPass()
     {
-        m_FrameStats.RenderPassCount++;
+        std::atomic_ref(m_FrameStats.RenderPassCount).fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void RenderStats::RecordBarrierBatch(uint32_t barrierCount)
+    {
+        std::atomic_ref(m_FrameStats.BarrierBatchCount).fetch_add(1, std::memory_order_relaxed);
+        std::atomic_ref(m_FrameStats.BarrierCount).fetch_add(barrierCount, std::memory_order_relaxed);
     }
 
     void RenderStats::UpdateFrameTiming(float frameTimeMs, float fps)
@@ -53,5 +72,33 @@ namespace Mixture
         m_FrameStats.VRAMUsageMB = vramMB;
         m_FrameStats.SystemRAMUsageMB = ramMB;
     }
+
+    void RenderStats::RecordTransientMemory(uint64_t heapBytes, uint64_t savedBytes)
+    {
+        m_FrameStats.TransientMemoryBytes = heapBytes;
+        m_FrameStats.AliasingSavedBytes = savedBytes;
+    }
+
+    void RenderStats::RecordTransientPool(uint32_t hits, uint32_t misses, uint32_t evictions, uint64_t pooledBytes)
+    {
+        m_FrameStats.TransientPoolHits = hits;
+        m_FrameStats.TransientPoolMisses = misses;
+        m_FrameStats.TransientPoolEvictions = evictions;
+        m_FrameStats.TransientPoolBytes = pooledBytes;
+    }
+
+    void RenderStats::RecordPassTimings(std::span<const RGPassTiming> timings, float gpuFrameTimeMs)
+    {
+        // Entries are assigned in place so their name strings keep their capacity.
+        m_FrameStats.PassTimings.resize(timings.size());
+        for (size_t index = 0; index < timings.size(); ++index)
+        {
+            auto& timing = m_FrameStats.PassTimings[index];
+            timing.Name.assign(timings[index].Name);
+            timing.CpuTimeMs = timings[index].CpuTimeMs;
+            timing.GpuTimeMs = timings[index].GpuTimeMs;
+        }
+        m_FrameStats.GpuFrameTimeMs = gpuFrameTimeMs;
+    }
 #endif
 }
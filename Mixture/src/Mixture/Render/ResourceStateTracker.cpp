@@ -0,0 +1,65 @@
+#include "mxpch.hpp"
+#include "Mixture/Render/ResourceStateTracker.hpp"
+
+#include "Mixture/Render/RHI/IBuffer.hpp"
+#include "Mixture/Render/RHI/ITexture.hpp"
+
+namespace Mixture
+{
+    namespace
+    {
+        template<typename Resource, typename Entry>
+        RHI::ResourceState Lookup(std::unordered_map<const Resource*, Entry>& states, const Resource* resource)
+        {
+            const auto it = states.find(resource);
+            if (it == states.end()) return RHI::ResourceState::Undefined;
+
+            // Recorded for a destroyed resource that used to live at this address.
+            if (it->second.InstanceID != resource->GetInstanceID())
+            {
+                states.erase(it);
+                return RHI::ResourceState::Undefined;
+            }
+            return it->second.State;
+        }
+
+        template<typename Resource, typename Entry>
+        void Store(std::unordered_map<const Resource*, Entry>& states, const Resource* resource, RHI::ResourceState state)
+        {
+            if (!resource) return;
+            if (state == RHI::ResourceState::Undefined) states.erase(resource);
+            else states[resource] = { resource->GetInstanceID(), state };
+        }
+    }
+
+    ResourceStateTracker& ResourceStateTracker::Get()
+    {
+        // Never destroyed: owners releasing resources during static destruction may still drop their entries.
+        static ResourceStateTracker* instance = new ResourceStateTracker();
+        return *instance;
+    }
+
+    RHI::ResourceState ResourceStateTracker::GetState(const RHI::ITexture* texture)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return Lookup(m_TextureStates, texture);
+    }
+
+    RHI::ResourceState ResourceStateTracker::GetState(const RHI::IBuffer* buffer)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return Lookup(m_BufferStates, buffer);
+    }
+
+    void ResourceStateTracker::SetState(const RHI::ITexture* texture, RHI::ResourceState state)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        Store(m_TextureStates, texture, state);
+    }
+
+    void ResourceStateTracker::SetState(const RHI::IBuffer* buffer, RHI::ResourceState state)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        Store(m_BufferStates, buffer, state);
+    }
+}
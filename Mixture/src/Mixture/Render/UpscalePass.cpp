@@ -0,0 +1,61 @@
+#include "mxpch.hpp"
+#include "Mixture/Render/UpscalePass.hpp"
+
+#include "Mixture/Render/Graph/RenderGraphBuilder.hpp"
+#include "Mixture/Render/Graph/RenderGraphRegistry.hpp"
+
+namespace Mixture
+{
+    namespace
+    {
+        struct UpscaleConstants
+        {
+            float UVScale[2];
+            /** Texel centers of the last rendered row and column, so filtering never reads past them. */
+            float UVMax[2];
+        };
+    }
+
+    void UpscalePass::Setup(RenderGraphBuilder& builder)
+    {
+        builder.Read(m_SourceHandle);
+
+        const RHI::TextureDesc& source = builder.GetTextureDesc(m_SourceHandle);
+        m_SourceWidth = source.Width;
+        m_SourceHeight = source.Height;
+
+        // The triangle covers the whole output, so its previous contents never matter.
+        RGAttachmentInfo output;
+        output.Handle = m_OutputHandle;
+        output.LoadOp = RHI::LoadOp::DontCare;
+        output.StoreOp = RHI::StoreOp::Store;
+        builder.Write(output);
+
+        RHI::PipelineDesc desc;
+        desc.VertexShader = builder.LoadShader("Upscale.slang", RHI::ShaderStage::Vertex);
+        desc.FragmentShader = builder.LoadShader("Upscale.slang", RHI::ShaderStage::Fragment);
+        desc.Rasterizer.cullMode = RHI::CullMode::None;
+        desc.DepthStencil.depthTest = false;
+        desc.DepthStencil.depthWrite = false;
+        m_Pipeline = builder.CreatePipeline(desc);
+    }
+
+    void UpscalePass::Execute(const RenderGraphRegistry& registry, RHI::ICommandList* commandList) const
+    {
+        RHI::ITexture* source = registry.GetTexture(m_SourceHandle);
+        if (!m_Pipeline || !source || source->GetWidth() == 0 || source->GetHeight() == 0) return;
+
+        const float width = static_cast<float>(source->GetWidth());
+        const float height = static_cast<float>(source->GetHeight());
+        UpscaleConstants constants;
+        constants.UVScale[0] = static_cast<float>(m_SourceWidth) / width;
+        constants.UVScale[1] = static_cast<float>(m_SourceHeight) / height;
+        constants.UVMax[0] = (static_cast<float>(m_SourceWidth) - 0.5f) / width;
+        constants.UVMax[1] = (static_cast<float>(m_SourceHeight) - 0.5f) / height;
+
+        commandList->BindPipeline(m_Pipeline);
+        commandList->SetTexture(0, source);
+        commandList->PushConstants(m_Pipeline, RHI::ShaderStage::Fragment, &constants, sizeof(constants));
+        commandList->Draw(3, 1, 0, 0);
+    }
+}
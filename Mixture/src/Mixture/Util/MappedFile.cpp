@@ -0,0 +1,93 @@
+#include "mxpch.hpp"
+#include "Mixture/Util/MappedFile.hpp"
+
+#include <limits>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Mixture
+{
+#ifdef _WIN32
+    Ref<MappedFile> MappedFile::Open(const std::filesystem::path& path)
+    {
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return nullptr;
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0
+            || static_cast<uint64_t>(fileSize.QuadPart) > std::numeric_limits<size_t>::max())
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        // The mapping object keeps the file open, so the file handle can be closed right away.
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping) return nullptr;
+
+        const size_t size = static_cast<size_t>(fileSize.QuadPart);
+        void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+        if (!data)
+        {
+            CloseHandle(mapping);
+            return nullptr;
+        }
+
+        WIN32_MEMORY_RANGE_ENTRY range{ data, size };
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+
+        return Ref<MappedFile>(new MappedFile(data, size, mapping));
+    }
+
+    MappedFile::~MappedFile()
+    {
+        UnmapViewOfFile(m_Data);
+        CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+    }
+#else
+    Ref<MappedFile> MappedFile::Open(const std::filesystem::path& path)
+    {
+        const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0) return nullptr;
+
+        struct stat status{};
+        if (::fstat(file, &status) != 0 || !S_ISREG(status.st_mode) || status.st_size <= 0
+            || static_cast<uintmax_t>(status.st_size) > std::numeric_limits<size_t>::max())
+        {
+            ::close(file);
+            return nullptr;
+        }
+
+        // The mapping keeps its own reference to the file, so the descriptor can be closed right away.
+        const size_t size = static_cast<size_t>(status.st_size);
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+        if (data == MAP_FAILED) return nullptr;
+
+        ::posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+        ::posix_madvise(data, size, POSIX_MADV_WILLNEED);
+
+        return Ref<MappedFile>(new MappedFile(data, size, nullptr));
+    }
+
+    MappedFile::~MappedFile()
+    {
+        ::munmap(const_cast<void*>(m_Data), m_Size);
+    }
+#endif
+}
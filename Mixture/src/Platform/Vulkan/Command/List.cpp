@@ -17,31 +17,125 @@ namespace Mixture::Vulkan
     {
         namespace Utils
         {
-            void InsertImageBarrier(vk::CommandBuffer cmdbuffer, vk::Image image,
-                vk::ImageLayout oldLayout, vk::ImageLayout newLayout,
-                vk::PipelineStageFlags srcStage, vk::PipelineStageFlags dstStage,
-                vk::AccessFlags srcAccess, vk::AccessFlags dstAccess)
+            /**
+             * Resolves the queue families of an ownership transfer and trims the half that does
+             * not run on @p listQueue: a release has no destination scope, an acquire no source
+             * scope. Both halves keep their layouts so the transition happens exactly once.
+             */
+            void PrepareQueueTransfer(RHI::QueueType listQueue, RHI::QueueType sourceQueue, RHI::QueueType destinationQueue,
+                ResourceStateMapping& before, ResourceStateMapping& after, uint32_t& sourceFamily, uint32_t& destinationFamily)
             {
-                vk::ImageMemoryBarrier barrier;
-                barrier.oldLayout = oldLayout;
-                barrier.newLayout = newLayout;
-                barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                barrier.image = image;
-                barrier.subresourceRange.aspectMask = vk::ImageAspectFlagBits::eColor;
-                barrier.subresourceRange.baseMipLevel = 0;
-                barrier.subresourceRange.levelCount = 1;
-                barrier.subresourceRange.baseArrayLayer = 0;
-                barrier.subresourceRange.layerCount = 1;
-                barrier.srcAccessMask = srcAccess;
-                barrier.dstAccessMask = dstAccess;
-
-                cmdbuffer.pipelineBarrier(
-                    srcStage, dstStage,
-                    vk::DependencyFlags(),
-                    0, nullptr, 0, nullptr,
-                    1, &barrier
-                );
+                sourceFamily = VK_QUEUE_FAMILY_IGNORED;
+                destinationFamily = VK_QUEUE_FAMILY_IGNORED;
+                if (sourceQueue != destinationQueue)
+                {
+                    const uint32_t source = Context::Get().GetQueueFamilyIndex(sourceQueue);
+                    const uint32_t destination = Context::Get().GetQueueFamilyIndex(destinationQueue);
+                    if (source != destination)
+                    {
+                        sourceFamily = source;
+                        destinationFamily = destination;
+                        if (listQueue == sourceQueue)
+                        {
+                            after.Stages = vk::PipelineStageFlagBits::eBottomOfPipe;
+                            after.Access = {};
+                        }
+                        else
+                        {
+                            before.Stages = vk::PipelineStageFlagBits::eTopOfPipe;
+                            before.Access = {};
+                        }
+                    }
+                }
+
+                if (listQueue == RHI::QueueType::Compute)
+                {
+                    before = RestrictToComputeQueue(before, true);
+                    after = RestrictToComputeQueue(after, false);
+                }
+            }
+
+            vk::PipelineStageFlags2 ToStages2(vk::PipelineStageFlags stages)
+            {
+                return vk::PipelineStageFlags2(static_cast<VkPipelineStageFlags2>(static_cast<VkPipelineStageFlags>(stages)));
+            }
+
+            vk::AccessFlags2 ToAccess2(vk::AccessFlags access)
+            {
+                return vk::AccessFlags2(static_cast<VkAccessFlags2>(static_cast<VkAccessFlags>(access)));
+            }
+
+            /** Image and buffer barriers recorded together by one synchronization2 command. */
+            struct BarrierBatch
+            {
+                Vector<vk::ImageMemoryBarrier2> ImageBarriers;
+                Vector<vk::BufferMemoryBarrier2> BufferBarriers;
+
+                bool IsEmpty() const { return ImageBarriers.empty() && BufferBarriers.empty(); }
+
+                vk::DependencyInfo GetDependencyInfo() const
+                {
+                    vk::DependencyInfo dependencyInfo;
+                    dependencyInfo.setImageMemoryBarriers(ImageBarriers);
+                    dependencyInfo.setBufferMemoryBarriers(BufferBarriers);
+                    return dependencyInfo;
+                }
+            };
+
+            void AppendBarrier(BarrierBatch& batch, const RHI::ResourceBarrier& barrier, RHI::QueueType listQueue)
+            {
+                if (barrier.Before == barrier.After && barrier.SourceQueue == barrier.DestinationQueue) return;
+                auto before = MapResourceState(barrier.Before);
+                auto after = MapResourceState(barrier.After);
+
+                if (barrier.Texture)
+                {
+                    auto* vulkanTexture = static_cast<Texture*>(barrier.Texture);
+
+                    // The first use of an aliased image must wait for whichever resource used its memory before.
+                    if (barrier.Before == RHI::ResourceState::Undefined && vulkanTexture->IsAliased())
+                    {
+                        before.Stages = vk::PipelineStageFlagBits::eAllCommands;
+                        before.Access = vk::AccessFlagBits::eMemoryWrite;
+                    }
+
+                    vk::ImageMemoryBarrier2 imageBarrier;
+                    imageBarrier.oldLayout = before.Layout;
+                    imageBarrier.newLayout = after.Layout;
+                    PrepareQueueTransfer(listQueue, barrier.SourceQueue, barrier.DestinationQueue,
+                        before, after, imageBarrier.srcQueueFamilyIndex, imageBarrier.dstQueueFamilyIndex);
+                    imageBarrier.srcStageMask = ToStages2(before.Stages);
+                    imageBarrier.srcAccessMask = ToAccess2(before.Access);
+                    imageBarrier.dstStageMask = ToStages2(after.Stages);
+                    imageBarrier.dstAccessMask = ToAccess2(after.Access);
+                    imageBarrier.image = vulkanTexture->GetImage();
+                    // Remaining counts map onto VK_REMAINING_MIP_LEVELS and VK_REMAINING_ARRAY_LAYERS.
+                    const RHI::TextureSubresourceRange& range = barrier.Subresources;
+                    imageBarrier.subresourceRange = vk::ImageSubresourceRange(GetImageAspect(barrier.Texture->GetFormat()),
+                        range.BaseMip, range.MipCount, range.BaseLayer, range.LayerCount);
+                    batch.ImageBarriers.push_back(imageBarrier);
+                }
+                else if (barrier.Buffer)
+                {
+                    auto* vulkanBuffer = static_cast<Buffer*>(barrier.Buffer);
+                    if (barrier.Before == RHI::ResourceState::Undefined && vulkanBuffer->IsAliased())
+                    {
+                        before.Stages = vk::PipelineStageFlagBits::eAllCommands;
+                        before.Access = vk::AccessFlagBits::eMemoryWrite;
+                    }
+
+                    vk::BufferMemoryBarrier2 bufferBarrier;
+                    PrepareQueueTransfer(listQueue, barrier.SourceQueue, barrier.DestinationQueue,
+                        before, after, bufferBarrier.srcQueueFamilyIndex, bufferBarrier.dstQueueFamilyIndex);
+                    bufferBarrier.srcStageMask = ToStages2(before.Stages);
+                    bufferBarrier.srcAccessMask = ToAccess2(before.Access);
+                    bufferBarrier.dstStageMask = ToStages2(after.Stages);
+                    bufferBarrier.dstAccessMask = ToAccess2(after.Access);
+                    bufferBarrier.buffer = vulkanBuffer->GetHandle();
+                    bufferBarrier.offset = barrier.Range.Offset;
+                    bufferBarrier.size = barrier.Range.Size == RHI::BufferRange::WholeSize ? VK_WHOLE_SIZE : barrier.Range.Size;
+                    batch.BufferBarriers.push_back(bufferBarrier);
+                }
             }
         }
     }
@@ -49,37 +143,40 @@ namespace Mixture::Vulkan
     void CommandList::Begin()
     {
         m_IsPipelineBound = false;
-        if (m_CommandContext.Activity) m_CommandContext.Activity->Graphics = true;
 
         vk::CommandBufferBeginInfo beginInfo;
         beginInfo.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit; // Reset every frame
+
+        if (m_CommandContext.Kind == CommandListKind::Secondary)
+        {
+            // Render graph passes open their own rendering scope inside the secondary
+            // list, so there is no render pass state to inherit.
+            vk::CommandBufferInheritanceInfo inheritanceInfo;
+            beginInfo.pInheritanceInfo = &inheritanceInfo;
+            m_CommandContext.graphicsCommandBuffer.begin(beginInfo);
+            return;
+        }
+
+        if (m_CommandContext.Kind == CommandListKind::Queue)
+        {
+            m_CommandContext.graphicsCommandBuffer.begin(beginInfo);
+            return;
+        }
+
+        if (m_CommandContext.Activity) m_CommandContext.Activity->Graphics = true;
         m_CommandContext.transferCommandBuffer.begin(beginInfo);
         Context::Get().BeginTransferUploads(m_CommandContext.transferCommandBuffer);
         m_CommandContext.computeCommandBuffer.begin(beginInfo);
         m_CommandContext.graphicsCommandBuffer.begin(beginInfo);
-
-        Utils::InsertImageBarrier(
-            m_CommandContext.graphicsCommandBuffer, m_SwapchainImage,
-            vk::ImageLayout::eUndefined,
-            vk::ImageLayout::eColorAttachmentOptimal,
-            vk::PipelineStageFlagBits::eTopOfPipe,
-            vk::PipelineStageFlagBits::eColorAttachmentOutput,
-            vk::AccessFlags(),
-            vk::AccessFlagBits::eColorAttachmentWrite
-        );
     }
 
     void CommandList::End()
     {
-        Utils::InsertImageBarrier(
-            m_CommandContext.graphicsCommandBuffer, m_SwapchainImage,
-            vk::ImageLayout::eColorAttachmentOptimal,
-            vk::ImageLayout::ePresentSrcKHR,
-            vk::PipelineStageFlagBits::eColorAttachmentOutput,
-            vk::PipelineStageFlagBits::eBottomOfPipe,
-            vk::AccessFlagBits::eColorAttachmentWrite,
-            vk::AccessFlags() // Presentation reads implicitly
-        );
+        if (m_CommandContext.Kind != CommandListKind::Frame)
+        {
+            m_CommandContext.graphicsCommandBuffer.end();
+            return;
+        }
 
         Context::Get().EndTransferUploads();
         m_CommandContext.transferCommandBuffer.end();
@@ -106,7 +203,7 @@ namespace Mixture::Vulkan
             auto* vulkanTexture = static_cast<Texture*>(attachment.Image);
 
             vk::RenderingAttachmentInfo vkInfo;
-            vkInfo.imageView = vulkanTexture->GetImageView();
+            vkInfo.imageView = vulkanTexture->GetAttachmentView(attachment.MipLevel, attachment.ArrayLayer);
             vkInfo.imageLayout = vk::ImageLayout::eColorAttachmentOptimal; // Or infer from texture usage
 
             // Operations
@@ -133,7 +230,7 @@ namespace Mixture::Vulkan
             const auto& attachment = *info.DepthAttachment;
             auto* vulkanTexture = static_cast<Texture*>(attachment.Image);
 
-            vkDepthAttachment.imageView = vulkanTexture->GetImageView();
+            vkDepthAttachment.imageView = vulkanTexture->GetAttachmentView(attachment.MipLevel, attachment.ArrayLayer);
             vkDepthAttachment.imageLayout = vk::ImageLayout::eDepthStencilAttachmentOptimal;
 
             vkDepthAttachment.loadOp = EnumMapper::MapLoadOp(attachment.LoadOp);
@@ -179,6 +276,24 @@ namespace Mixture::Vulkan
         m_CommandContext.graphicsCommandBuffer.endRendering();
     }
 
+    void CommandList::ExecuteSecondary(std::span<RHI::ICommandList* const> commandLists)
+    {
+        Vector<vk::CommandBuffer> commandBuffers;
+        commandBuffers.reserve(commandLists.size());
+        for (auto* commandList : commandLists)
+        {
+            if (commandList) commandBuffers.push_back(static_cast<CommandList*>(commandList)->GetGraphicsCommandBuffer());
+        }
+        if (commandBuffers.empty()) return;
+
+        m_CommandContext.graphicsCommandBuffer.executeCommands(commandBuffers);
+
+        // Command buffer state is undefined after vkCmdExecuteCommands.
+        m_IsPipelineBound = false;
+        m_CurrentPipeline = nullptr;
+        m_DescriptorsDirty = !m_Bindings.empty();
+    }
+
     void CommandList::SetViewport(float x, float y, float width, float height, float minDepth, float maxDepth)
     {
         // Vulkan Y-flip standard: negative height, y = y + height
@@ -208,7 +323,7 @@ namespace Mixture::Vulkan
         m_CommandContext.graphicsCommandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, vkPipeline->GetHandle());
     }
 
-    void CommandList::BindVertexBuffer(RHI::IBuffer* buffer, uint32_t binding)
+    void CommandList::BindVertexBuffer(RHI::IBuffer* buffer, uint32_t binding, uint64_t offset)
     {
         // Safety check (or assert) that usage is correct
         if (buffer->GetUsage() != RHI::BufferUsage::Vertex)
@@ -220,12 +335,12 @@ namespace Mixture::Vulkan
         auto vkBuffer = static_cast<Buffer*>(buffer);
 
         vk::Buffer buffers[] = { vkBuffer->GetHandle() };
-        vk::DeviceSize offsets[] = { 0 };
+        vk::DeviceSize offsets[] = { offset };
 
         m_CommandContext.graphicsCommandBuffer.bindVertexBuffers(binding, 1, buffers, offsets);
     }
 
-    void CommandList::BindIndexBuffer(RHI::IBuffer* buffer)
+    void CommandList::BindIndexBuffer(RHI::IBuffer* buffer, uint64_t offset)
     {
         if (buffer->GetUsage() != RHI::BufferUsage::Index)
         {
@@ -236,48 +351,73 @@ namespace Mixture::Vulkan
         auto vkBuffer = static_cast<Buffer*>(buffer);
 
         // Default to 32-bit indices for simplicity
-        m_CommandContext.graphicsCommandBuffer.bindIndexBuffer(vkBuffer->GetHandle(), 0, vk::IndexType::eUint32);
+        m_CommandContext.graphicsCommandBuffer.bindIndexBuffer(vkBuffer->GetHandle(), offset, vk::IndexType::eUint32);
+    }
+
+    void CommandList::PipelineBarrier(RHI::ITexture* texture, RHI::ResourceState oldState, RHI::ResourceState newState,
+        RHI::QueueType sourceQueue, RHI::QueueType destinationQueue, const RHI::TextureSubresourceRange& subresources)
+    {
+        RHI::ResourceBarrier barrier;
+        barrier.Texture = texture;
+        barrier.Before = oldState;
+        barrier.After = newState;
+        barrier.SourceQueue = sourceQueue;
+        barrier.DestinationQueue = destinationQueue;
+        barrier.Subresources = subresources;
+        PipelineBarriers(std::span<const RHI::ResourceBarrier>(&barrier, 1));
+    }
+
+    void CommandList::PipelineBarrier(RHI::IBuffer* buffer, RHI::ResourceState oldState, RHI::ResourceState newState,
+        RHI::QueueType sourceQueue, RHI::QueueType destinationQueue, const RHI::BufferRange& range)
+    {
+        RHI::ResourceBarrier barrier;
+        barrier.Buffer = buffer;
+        barrier.Before = oldState;
+        barrier.After = newState;
+        barrier.SourceQueue = sourceQueue;
+        barrier.DestinationQueue = destinationQueue;
+        barrier.Range = range;
+        PipelineBarriers(std::span<const RHI::ResourceBarrier>(&barrier, 1));
+    }
+
+    void CommandList::PipelineBarriers(std::span<const RHI::ResourceBarrier> barriers)
+    {
+        Utils::BarrierBatch batch;
+        for (const auto& barrier : barriers) Utils::AppendBarrier(batch, barrier, m_CommandContext.Queue);
+        if (batch.IsEmpty()) return;
+
+        const vk::DependencyInfo dependencyInfo = batch.GetDependencyInfo();
+        m_CommandContext.graphicsCommandBuffer.pipelineBarrier2(dependencyInfo);
+    }
+
+    void CommandList::BeginSplitBarriers(uint32_t splitIndex, std::span<const RHI::ResourceBarrier> barriers)
+    {
+        Utils::BarrierBatch batch;
+        for (const auto& barrier : barriers) Utils::AppendBarrier(batch, barrier, m_CommandContext.Queue);
+        if (batch.IsEmpty()) return;
+
+        const vk::DependencyInfo dependencyInfo = batch.GetDependencyInfo();
+        m_CommandContext.graphicsCommandBuffer.setEvent2(Context::Get().GetSplitBarrierEvent(splitIndex), dependencyInfo);
     }
 
-    void CommandList::PipelineBarrier(RHI::ITexture* texture, RHI::ResourceState oldState, RHI::ResourceState newState)
+    void CommandList::EndSplitBarriers(uint32_t splitIndex, std::span<const RHI::ResourceBarrier> barriers)
     {
-        if (!texture || oldState == newState) return;
-        const auto before = MapResourceState(oldState);
-        const auto after = MapResourceState(newState);
-        auto* vulkanTexture = static_cast<Texture*>(texture);
-
-        vk::ImageMemoryBarrier barrier;
-        barrier.srcAccessMask = before.Access;
-        barrier.dstAccessMask = after.Access;
-        barrier.oldLayout = before.Layout;
-        barrier.newLayout = after.Layout;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.image = vulkanTexture->GetImage();
-        barrier.subresourceRange = vk::ImageSubresourceRange(
-            GetImageAspect(texture->GetFormat()), 0, 1, 0, 1);
-
-        m_CommandContext.graphicsCommandBuffer.pipelineBarrier(
-            before.Stages, after.Stages, {}, {}, {}, barrier);
+        // The dependency info has to match the one the event was set with, which holds
+        // as long as both sides are built from the same transitions.
+        Utils::BarrierBatch batch;
+        for (const auto& barrier : barriers) Utils::AppendBarrier(batch, barrier, m_CommandContext.Queue);
+        if (batch.IsEmpty()) return;
+
+        const vk::DependencyInfo dependencyInfo = batch.GetDependencyInfo();
+        const vk::Event event = Context::Get().GetSplitBarrierEvent(splitIndex);
+        m_CommandContext.graphicsCommandBuffer.waitEvents2(1, &event, &dependencyInfo);
     }
 
-    void CommandList::PipelineBarrier(RHI::IBuffer* buffer, RHI::ResourceState oldState, RHI::ResourceState newState)
+    void CommandList::WriteTimestamp(uint32_t queryIndex)
     {
-        if (!buffer || oldState == newState) return;
-        const auto before = MapResourceState(oldState);
-        const auto after = MapResourceState(newState);
-        auto* vulkanBuffer = static_cast<Buffer*>(buffer);
-
-        vk::BufferMemoryBarrier barrier;
-        barrier.srcAccessMask = before.Access;
-        barrier.dstAccessMask = after.Access;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.buffer = vulkanBuffer->GetHandle();
-        barrier.offset = 0;
-        barrier.size = VK_WHOLE_SIZE;
-        m_CommandContext.graphicsCommandBuffer.pipelineBarrier(
-            before.Stages, after.Stages, {}, {}, barrier, {});
+        const vk::QueryPool pool = Context::Get().GetTimestampQueryPool();
+        if (!pool) return;
+        m_CommandContext.graphicsCommandBuffer.writeTimestamp2(vk::PipelineStageFlagBits2::eAllCommands, pool, queryIndex);
     }
 
     void CommandList::PushConstants(RHI::IPipeline* pipeline, RHI::ShaderStage stage, const void* data, uint32_t size)
@@ -295,9 +435,10 @@ namespace Mixture::Vulkan
             vulkanPipeline->GetLayout(), range->stageFlags, range->offset, size, data);
     }
 
-    void CommandList::SetUniformBuffer(uint32_t binding, RHI::IBuffer* buffer, uint32_t set)
+    void CommandList::SetUniformBuffer(uint32_t binding, RHI::IBuffer* buffer, uint32_t set, const RHI::BufferRange& range)
     {
         m_Bindings[{ set, binding }].Buffer = buffer;
+        m_Bindings[{ set, binding }].Range = range;
         m_Bindings[{ set, binding }].Texture = nullptr;
         m_Bindings[{ set, binding }].Type = vk::DescriptorType::eUniformBuffer;
 
@@ -339,6 +480,10 @@ namespace Mixture::Vulkan
 
         auto& context = Context::Get();
 
+        // Secondary lists flush from several recording threads; the shared pools and
+        // layout cache are not thread-safe.
+        std::lock_guard<std::mutex> lock(context.GetDescriptorMutex());
+
         // Get the Allocator for the CURRENT frame
         // (Assuming you added a getter to Context for the current frame's allocator)
         auto* allocator = context.GetCurrentDescriptorAllocator();
@@ -361,7 +506,8 @@ namespace Mixture::Vulkan
                 if (state.Buffer)
                 {
                     auto* vkBuf = static_cast<Buffer*>(state.Buffer);
-                    vk::DescriptorBufferInfo info(vkBuf->GetHandle(), 0, vkBuf->GetSize());
+                    const vk::DeviceSize range = state.Range.Size == RHI::BufferRange::WholeSize ? VK_WHOLE_SIZE : state.Range.Size;
+                    vk::DescriptorBufferInfo info(vkBuf->GetHandle(), state.Range.Offset, range);
                     builder.BindBuffer(binding, info, state.Type,
                         vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment);
                 }
@@ -25,4 +25,9 @@ namespace Mixture::Vulkan
     {
         m_Device->GetHandle().destroyCommandPool(m_Handle);
     }
+
+    void CommandPool::Reset()
+    {
+        m_Device->GetHandle().resetCommandPool(m_Handle);
+    }
 }
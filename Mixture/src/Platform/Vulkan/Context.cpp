@@ -22,11 +22,14 @@
 
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+
 namespace Mixture::Vulkan
 {
 
     static Context* s_Instance = nullptr;
     static const int MAX_FRAMES_IN_FLIGHT = 2;
+    static const uint32_t TIMESTAMP_QUERY_COUNT = 512;
 
     Context& Context::Get()
     {
@@ -37,13 +40,17 @@ namespace Mixture::Vulkan
     Context::Context(const ApplicationDescription& appDescription, void* windowHandle)
     {
         s_Instance = this;
+        m_Headless = appDescription.Headless;
         try
         {
             m_Instance = CreateRef<Instance>(appDescription);
-            m_Surface = CreateScope<Surface>(*m_Instance, windowHandle);
+            if (!m_Headless) m_Surface = CreateScope<Surface>(*m_Instance, windowHandle);
             m_PhysicalDevice = CreateRef<PhysicalDevice>(*m_Instance);
             m_Device = CreateRef<Device>(m_Instance, m_PhysicalDevice);
-            m_Swapchain = CreateScope<Swapchain>(*m_PhysicalDevice, *m_Device, *m_Surface, appDescription.Width, appDescription.Height);
+            if (m_Headless)
+                CreateOffscreenBackbuffers(appDescription.Width, appDescription.Height);
+            else
+                m_Swapchain = CreateScope<Swapchain>(*m_PhysicalDevice, *m_Device, *m_Surface, appDescription.Width, appDescription.Height);
 
             QueueFamilyIndices indices = m_PhysicalDevice->GetQueueFamilies();
             m_GraphicsQueue = CreateScope<Queue>(*m_Device, indices.Graphics, MAX_FRAMES_IN_FLIGHT, "Graphics Queue");
@@ -51,15 +58,33 @@ namespace Mixture::Vulkan
             m_ComputeQueue = CreateScope<Queue>(*m_Device, indices.Compute, MAX_FRAMES_IN_FLIGHT, "Compute Queue", indices.Graphics);
             m_TransferQueue = CreateScope<Queue>(*m_Device, indices.Transfer, MAX_FRAMES_IN_FLIGHT, "Transfer Queue", indices.Graphics);
 
-            const uint32_t imageCount = m_Swapchain->GetImageCount();
+            const uint32_t imageCount = m_Swapchain ? m_Swapchain->GetImageCount() : MAX_FRAMES_IN_FLIGHT;
             m_ImageAvailableSemaphores = CreateScope<Semaphores>(*m_Device, MAX_FRAMES_IN_FLIGHT);
             m_RenderFinishedSemaphores = CreateScope<Semaphores>(*m_Device, imageCount);
             m_TransferFinishedSemaphores = CreateScope<Semaphores>(*m_Device, MAX_FRAMES_IN_FLIGHT);
             m_ComputeFinishedSemaphores = CreateScope<Semaphores>(*m_Device, MAX_FRAMES_IN_FLIGHT);
+            m_TransferToComputeSemaphores = CreateScope<Semaphores>(*m_Device, MAX_FRAMES_IN_FLIGHT);
             m_InFlightFences = CreateScope<Fences>(*m_Device, MAX_FRAMES_IN_FLIGHT, true);
+            m_AsyncComputeFences = CreateScope<Fences>(*m_Device, MAX_FRAMES_IN_FLIGHT, true);
 
             m_DescriptorLayoutCache = CreateScope<DescriptorLayoutCache>(*m_Device);
             m_DescriptorAllocators = CreateScope<DescriptorAllocators>(*m_Device, MAX_FRAMES_IN_FLIGHT);
+
+            // Every queue has to support timestamps, since graph passes may run on async compute.
+            const vk::PhysicalDeviceLimits limits = m_PhysicalDevice->GetHandle().getProperties().limits;
+            if (m_Device->SupportsHostQueryReset() && limits.timestampComputeAndGraphics && limits.timestampPeriod > 0.0f)
+            {
+                vk::QueryPoolCreateInfo queryPoolInfo;
+                queryPoolInfo.queryType = vk::QueryType::eTimestamp;
+                queryPoolInfo.queryCount = TIMESTAMP_QUERY_COUNT;
+                for (auto& pool : m_TimestampQueryPools)
+                {
+                    pool = m_Device->GetHandle().createQueryPool(queryPoolInfo);
+                    m_Device->GetHandle().resetQueryPool(pool, 0, TIMESTAMP_QUERY_COUNT);
+                }
+                for (auto& readback : m_TimestampReadback) readback.assign(TIMESTAMP_QUERY_COUNT * 2, 0);
+                m_TimestampPeriod = limits.timestampPeriod;
+            }
             OPAL_INFO("Core/Vulkan", "Vulkan Initialized.");
         }
         catch (...)
@@ -72,6 +97,10 @@ namespace Mixture::Vulkan
     Context::~Context()
     {
         m_Device->WaitForIdle();
+        for (auto& events : m_SplitBarrierEvents)
+            for (const vk::Event event : events) m_Device->GetHandle().destroyEvent(event);
+        for (const vk::QueryPool pool : m_TimestampQueryPools)
+            if (pool) m_Device->GetHandle().destroyQueryPool(pool);
         for (auto& cleanup : m_TransferCleanups)
             for (auto& action : cleanup) action();
         for (auto& upload : m_PendingTransferUploads)
@@ -111,14 +140,45 @@ namespace Mixture::Vulkan
         m_ActiveTransferCommandBuffer = nullptr;
     }
 
-    uint32_t Context::GetSwapchainWidth() const { return m_Swapchain->GetExtent().width; }
-    uint32_t Context::GetSwapchainHeight() const { return m_Swapchain->GetExtent().height; }
+    uint32_t Context::GetSwapchainWidth() const
+    {
+        return m_Headless ? m_OffscreenBackbuffers[0]->GetWidth() : m_Swapchain->GetExtent().width;
+    }
+
+    uint32_t Context::GetSwapchainHeight() const
+    {
+        return m_Headless ? m_OffscreenBackbuffers[0]->GetHeight() : m_Swapchain->GetExtent().height;
+    }
 
     RHI::IGraphicsDevice& Context::GetDevice() const { return *m_Device; }
 
     void Context::OnResize(uint32_t width, uint32_t height)
     {
-        RecreateSwapchain(width, height);
+        if (!m_Headless)
+        {
+            RecreateSwapchain(width, height);
+            return;
+        }
+
+        if (width == 0 || height == 0) return;
+        m_Device->WaitForIdle();
+        CreateOffscreenBackbuffers(width, height);
+    }
+
+    void Context::CreateOffscreenBackbuffers(uint32_t width, uint32_t height)
+    {
+        RHI::TextureDesc desc;
+        desc.Width = width;
+        desc.Height = height;
+        desc.PixelFormat = RHI::Format::R8G8B8A8_UNORM;
+        desc.Usage = RHI::TextureUsage::ColorAttachment | RHI::TextureUsage::Sampled | RHI::TextureUsage::TransferSource;
+        desc.DebugName = "Offscreen Backbuffer";
+        for (auto& backbuffer : m_OffscreenBackbuffers)
+        {
+            backbuffer = m_Device->CreateTexture(desc);
+            if (!backbuffer) throw std::runtime_error("Failed to create the offscreen backbuffer");
+        }
+        OPAL_LOG_DEBUG("Core/Vulkan", "Offscreen backbuffers created at {} x {}", width, height);
     }
 
     bool Context::RecreateSwapchain(uint32_t width, uint32_t height)
@@ -149,7 +209,8 @@ namespace Mixture::Vulkan
         }
 
         // Wait for the PREVIOUS frame (using this index) to finish
-        if (m_InFlightFences->Wait(m_CurrentFrame) != vk::Result::eSuccess)
+        if (m_InFlightFences->Wait(m_CurrentFrame) != vk::Result::eSuccess ||
+            m_AsyncComputeFences->Wait(m_CurrentFrame) != vk::Result::eSuccess)
         {
             OPAL_ERROR("Core/Vulkan", "Wait for fences failed!");
             return nullptr;
@@ -159,9 +220,38 @@ namespace Mixture::Vulkan
 
         m_DescriptorAllocators->Get(m_CurrentFrame)->ResetPools();
 
-        uint32_t imageIndex;
-        bool acquired = m_Swapchain->AcquireNextImage(&imageIndex, m_ImageAvailableSemaphores->Get(m_CurrentFrame));
-        if (!acquired)
+        for (auto& [thread, threadPool] : m_ThreadCommandPools[m_CurrentFrame])
+        {
+            threadPool.Pool->Reset();
+            threadPool.NextBuffer = 0;
+        }
+        for (auto& queuePool : m_QueueCommandPools[m_CurrentFrame])
+        {
+            if (!queuePool.Pool) continue;
+            queuePool.Pool->Reset();
+            queuePool.NextBuffer = 0;
+        }
+        m_QueuedCommandLists.clear();
+
+        auto& splitBarrierEvents = m_SplitBarrierEvents[m_CurrentFrame];
+        for (uint32_t index = 0; index < m_UsedSplitBarrierEvents[m_CurrentFrame]; ++index)
+            m_Device->GetHandle().resetEvent(splitBarrierEvents[index]);
+        m_UsedSplitBarrierEvents[m_CurrentFrame] = 0;
+
+        if (const vk::QueryPool timestampPool = m_TimestampQueryPools[m_CurrentFrame])
+        {
+            // Queries the last frame did not write keep an availability of zero, which
+            // is all eNotReady reports here.
+            auto& readback = m_TimestampReadback[m_CurrentFrame];
+            (void)m_Device->GetHandle().getQueryPoolResults(timestampPool, 0, TIMESTAMP_QUERY_COUNT,
+                readback.size() * sizeof(uint64_t), readback.data(), 2 * sizeof(uint64_t),
+                vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability);
+            m_Device->GetHandle().resetQueryPool(timestampPool, 0, TIMESTAMP_QUERY_COUNT);
+        }
+
+        // Headless slots own their backbuffer, so there is no image to acquire.
+        uint32_t imageIndex = m_CurrentFrame;
+        if (!m_Headless && !m_Swapchain->AcquireNextImage(&imageIndex, m_ImageAvailableSemaphores->Get(m_CurrentFrame)))
         {
             RecreateSwapchainFromWindow();
             return nullptr;
@@ -181,6 +271,7 @@ namespace Mixture::Vulkan
 
         m_IsFrameStarted = true;
 
+        if (m_Headless) return m_OffscreenBackbuffers[m_CurrentFrame].get();
         return m_Swapchain->GetTexture(imageIndex);
     }
 
@@ -193,32 +284,52 @@ namespace Mixture::Vulkan
         }
 
         const auto plan = BuildFrameSubmissionPlan(m_QueueActivity[m_CurrentFrame]);
+        const bool hasQueuedCompute = std::any_of(m_QueuedCommandLists.begin(), m_QueuedCommandLists.end(),
+            [](const QueuedCommandList& queued) { return queued.Queue == RHI::QueueType::Compute; });
         if (plan.SubmitTransfer)
-            m_TransferQueue->Submit(m_CurrentFrame, { m_TransferFinishedSemaphores->Get(m_CurrentFrame) });
+        {
+            Vector<vk::Semaphore> transferSignals{ m_TransferFinishedSemaphores->Get(m_CurrentFrame) };
+            if (hasQueuedCompute) transferSignals.push_back(m_TransferToComputeSemaphores->Get(m_CurrentFrame));
+            m_TransferQueue->Submit(m_CurrentFrame, std::move(transferSignals));
+        }
         if (plan.SubmitCompute)
             m_ComputeQueue->Submit(m_CurrentFrame, { m_ComputeFinishedSemaphores->Get(m_CurrentFrame) });
 
-        Vector<vk::Semaphore> waitSemaphores{ m_ImageAvailableSemaphores->Get(m_CurrentFrame) };
-        Vector<vk::PipelineStageFlags> waitStages{ vk::PipelineStageFlagBits::eColorAttachmentOutput };
-        if (plan.WaitForTransfer)
+        if (!m_QueuedCommandLists.empty())
         {
-            waitSemaphores.push_back(m_TransferFinishedSemaphores->Get(m_CurrentFrame));
-            waitStages.push_back(vk::PipelineStageFlagBits::eAllCommands);
+            SubmitQueuedCommandLists(plan);
         }
-        if (plan.WaitForCompute)
+        else
         {
-            waitSemaphores.push_back(m_ComputeFinishedSemaphores->Get(m_CurrentFrame));
-            waitStages.push_back(vk::PipelineStageFlagBits::eVertexInput);
+            Vector<vk::Semaphore> waitSemaphores;
+            Vector<vk::PipelineStageFlags> waitStages;
+            Vector<vk::Semaphore> signalSemaphores;
+            if (!m_Headless)
+            {
+                waitSemaphores.push_back(m_ImageAvailableSemaphores->Get(m_CurrentFrame));
+                waitStages.push_back(vk::PipelineStageFlagBits::eColorAttachmentOutput);
+                signalSemaphores.push_back(m_RenderFinishedSemaphores->Get(m_ImageIndex));
+            }
+            if (plan.WaitForTransfer)
+            {
+                waitSemaphores.push_back(m_TransferFinishedSemaphores->Get(m_CurrentFrame));
+                waitStages.push_back(vk::PipelineStageFlagBits::eAllCommands);
+            }
+            if (plan.WaitForCompute)
+            {
+                waitSemaphores.push_back(m_ComputeFinishedSemaphores->Get(m_CurrentFrame));
+                waitStages.push_back(vk::PipelineStageFlagBits::eVertexInput);
+            }
+
+            m_GraphicsQueue->Submit(m_CurrentFrame, std::move(signalSemaphores),
+                std::move(waitSemaphores), std::move(waitStages),
+                m_InFlightFences->Get(m_CurrentFrame)
+            );
         }
 
-        m_GraphicsQueue->Submit(m_CurrentFrame, { m_RenderFinishedSemaphores->Get(m_ImageIndex) },
-            std::move(waitSemaphores), std::move(waitStages),
-            m_InFlightFences->Get(m_CurrentFrame)
-        );
-
         // Present
-        bool success = m_Swapchain->Present(m_ImageIndex, m_RenderFinishedSemaphores->Get(m_ImageIndex), m_PresentQueue->GetHandle());
-        if (!success)
+        if (!m_Headless &&
+            !m_Swapchain->Present(m_ImageIndex, m_RenderFinishedSemaphores->Get(m_ImageIndex), m_PresentQueue->GetHandle()))
             RecreateSwapchainFromWindow();
 
         // ADVANCE FRAME: 0 -> 1 -> 0 -> 1
@@ -234,7 +345,221 @@ namespace Mixture::Vulkan
                 m_TransferQueue->GetBuffer(m_CurrentFrame),
                 m_ComputeQueue->GetBuffer(m_CurrentFrame),
                 &m_QueueActivity[m_CurrentFrame],
-            }, m_Swapchain->GetImages()[m_ImageIndex]
+            }
         );
     }
+
+    Scope<RHI::ICommandList> Context::CreateSecondaryCommandList()
+    {
+        ThreadCommandPool* threadPool = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_ThreadCommandPoolMutex);
+            auto& entry = m_ThreadCommandPools[m_CurrentFrame][std::this_thread::get_id()];
+            if (!entry.Pool)
+                entry.Pool = CreateScope<CommandPool>(*m_Device, m_PhysicalDevice->GetQueueFamilies().Graphics.value());
+            threadPool = &entry;
+        }
+
+        // Only the owning thread touches its pool until BeginFrame recycles the slot.
+        if (threadPool->NextBuffer == threadPool->Buffers.size())
+        {
+            vk::CommandBufferAllocateInfo allocInfo;
+            allocInfo.commandPool = threadPool->Pool->GetHandle();
+            allocInfo.level = vk::CommandBufferLevel::eSecondary;
+            allocInfo.commandBufferCount = 1;
+            threadPool->Buffers.push_back(m_Device->GetHandle().allocateCommandBuffers(allocInfo).front());
+        }
+
+        FrameCommandContext commandContext;
+        commandContext.graphicsCommandBuffer = threadPool->Buffers[threadPool->NextBuffer++];
+        commandContext.Activity = &m_QueueActivity[m_CurrentFrame];
+        commandContext.Kind = CommandListKind::Secondary;
+        return CreateScope<CommandList>(commandContext);
+    }
+
+    bool Context::SupportsAsyncCompute() const
+    {
+        return m_ComputeQueue->GetFamilyIndex() != m_GraphicsQueue->GetFamilyIndex();
+    }
+
+    uint32_t Context::GetQueueFamilyIndex(RHI::QueueType queue) const
+    {
+        return queue == RHI::QueueType::Compute ? m_ComputeQueue->GetFamilyIndex() : m_GraphicsQueue->GetFamilyIndex();
+    }
+
+    vk::Event Context::GetSplitBarrierEvent(uint32_t splitIndex)
+    {
+        // Passes of one frame may be recorded on several threads.
+        std::lock_guard<std::mutex> lock(m_SplitBarrierEventMutex);
+        auto& events = m_SplitBarrierEvents[m_CurrentFrame];
+        while (events.size() <= splitIndex) events.push_back(m_Device->GetHandle().createEvent({}));
+
+        auto& used = m_UsedSplitBarrierEvents[m_CurrentFrame];
+        used = std::max(used, splitIndex + 1);
+        return events[splitIndex];
+    }
+
+    uint32_t Context::GetTimestampQueryCount() const
+    {
+        return m_TimestampQueryPools[0] ? TIMESTAMP_QUERY_COUNT : 0;
+    }
+
+    bool Context::ReadTimestamps(uint32_t frameIndex, uint32_t firstQuery, std::span<uint64_t> timestamps) const
+    {
+        if (frameIndex >= m_TimestampReadback.size()) return false;
+        const auto& readback = m_TimestampReadback[frameIndex];
+        if (static_cast<size_t>(firstQuery) + timestamps.size() > readback.size() / 2) return false;
+
+        for (size_t index = 0; index < timestamps.size(); ++index)
+        {
+            const size_t query = firstQuery + index;
+            if (readback[query * 2 + 1] == 0) return false;
+            timestamps[index] = readback[query * 2];
+        }
+        return true;
+    }
+
+    Scope<RHI::ICommandList> Context::CreateQueueCommandList(RHI::QueueType queue)
+    {
+        auto& queuePool = m_QueueCommandPools[m_CurrentFrame][static_cast<size_t>(queue)];
+        if (!queuePool.Pool)
+            queuePool.Pool = CreateScope<CommandPool>(*m_Device, GetQueueFamilyIndex(queue));
+
+        if (queuePool.NextBuffer == queuePool.Buffers.size())
+        {
+            vk::CommandBufferAllocateInfo allocInfo;
+            allocInfo.commandPool = queuePool.Pool->GetHandle();
+            allocInfo.level = vk::CommandBufferLevel::ePrimary;
+            allocInfo.commandBufferCount = 1;
+            queuePool.Buffers.push_back(m_Device->GetHandle().allocateCommandBuffers(allocInfo).front());
+        }
+
+        FrameCommandContext commandContext;
+        commandContext.graphicsCommandBuffer = queuePool.Buffers[queuePool.NextBuffer++];
+        commandContext.Activity = &m_QueueActivity[m_CurrentFrame];
+        commandContext.Kind = CommandListKind::Queue;
+        commandContext.Queue = queue;
+        return CreateScope<CommandList>(commandContext);
+    }
+
+    uint32_t Context::QueueCommandList(Scope<RHI::ICommandList> commandList, std::span<const uint32_t> waitFor)
+    {
+        QueuedCommandList queued;
+        queued.WaitFor.assign(waitFor.begin(), waitFor.end());
+        if (commandList)
+        {
+            auto* vulkanList = static_cast<CommandList*>(commandList.get());
+            queued.Queue = vulkanList->GetQueue();
+            queued.CommandBuffer = vulkanList->GetGraphicsCommandBuffer();
+        }
+        m_QueuedCommandLists.push_back(std::move(queued));
+        return static_cast<uint32_t>(m_QueuedCommandLists.size() - 1);
+    }
+
+    void Context::SubmitQueuedCommandLists(const FrameSubmissionPlan& plan)
+    {
+        const bool hasFrameList = std::any_of(m_QueuedCommandLists.begin(), m_QueuedCommandLists.end(),
+            [](const QueuedCommandList& queued) { return !queued.CommandBuffer; });
+        if (!hasFrameList) m_QueuedCommandLists.push_back({});
+
+        const size_t count = m_QueuedCommandLists.size();
+        size_t lastGraphics = 0;
+        size_t lastCompute = count;
+        uint32_t edgeCount = 0;
+        for (size_t index = 0; index < count; ++index)
+        {
+            if (m_QueuedCommandLists[index].Queue == RHI::QueueType::Compute) lastCompute = index;
+            else lastGraphics = index;
+            edgeCount += static_cast<uint32_t>(m_QueuedCommandLists[index].WaitFor.size());
+        }
+
+        // Every submission of this slot finished before BeginFrame returned, so the
+        // semaphores may be replaced by a larger set.
+        auto& edgeSemaphores = m_QueueWaitSemaphores[m_CurrentFrame];
+        if (edgeCount > 0 && (!edgeSemaphores || edgeSemaphores->GetCount() < edgeCount))
+            edgeSemaphores = CreateScope<Semaphores>(*m_Device, edgeCount);
+
+        Vector<Vector<vk::Semaphore>> signals(count);
+        Vector<Vector<vk::Semaphore>> waits(count);
+        Vector<Vector<vk::PipelineStageFlags>> waitStages(count);
+        uint32_t nextEdge = 0;
+        for (size_t index = 0; index < count; ++index)
+        {
+            for (const uint32_t wait : m_QueuedCommandLists[index].WaitFor)
+            {
+                if (wait >= index)
+                {
+                    OPAL_ERROR("Core/Vulkan", "Queued command list {} waits on later submission {}", index, wait);
+                    continue;
+                }
+
+                // Ownership acquires sit at the top of the waiting list, so nothing may start early.
+                const vk::Semaphore semaphore = edgeSemaphores->Get(nextEdge++);
+                signals[wait].push_back(semaphore);
+                waits[index].push_back(semaphore);
+                waitStages[index].push_back(vk::PipelineStageFlagBits::eAllCommands);
+            }
+        }
+
+        bool firstGraphics = true;
+        bool firstCompute = true;
+        for (size_t index = 0; index < count; ++index)
+        {
+            const auto& queued = m_QueuedCommandLists[index];
+            if (queued.Queue == RHI::QueueType::Compute)
+            {
+                if (firstCompute && plan.WaitForTransfer)
+                {
+                    waits[index].push_back(m_TransferToComputeSemaphores->Get(m_CurrentFrame));
+                    waitStages[index].push_back(vk::PipelineStageFlagBits::eAllCommands);
+                }
+                firstCompute = false;
+
+                vk::Fence fence;
+                if (index == lastCompute)
+                {
+                    m_AsyncComputeFences->Reset(m_CurrentFrame);
+                    fence = m_AsyncComputeFences->Get(m_CurrentFrame);
+                }
+                m_ComputeQueue->Submit(queued.CommandBuffer, std::move(signals[index]),
+                    std::move(waits[index]), std::move(waitStages[index]), fence);
+                continue;
+            }
+
+            if (firstGraphics)
+            {
+                if (plan.WaitForTransfer)
+                {
+                    waits[index].push_back(m_TransferFinishedSemaphores->Get(m_CurrentFrame));
+                    waitStages[index].push_back(vk::PipelineStageFlagBits::eAllCommands);
+                }
+                if (plan.WaitForCompute)
+                {
+                    waits[index].push_back(m_ComputeFinishedSemaphores->Get(m_CurrentFrame));
+                    waitStages[index].push_back(vk::PipelineStageFlagBits::eVertexInput);
+                }
+            }
+            firstGraphics = false;
+
+            // Graphics lists queued before the frame list must not touch the swapchain image.
+            const vk::Fence fence = index == lastGraphics ? m_InFlightFences->Get(m_CurrentFrame) : vk::Fence{};
+            if (!queued.CommandBuffer)
+            {
+                if (!m_Headless)
+                {
+                    waits[index].push_back(m_ImageAvailableSemaphores->Get(m_CurrentFrame));
+                    waitStages[index].push_back(vk::PipelineStageFlagBits::eColorAttachmentOutput);
+                    signals[index].push_back(m_RenderFinishedSemaphores->Get(m_ImageIndex));
+                }
+                m_GraphicsQueue->Submit(m_CurrentFrame, std::move(signals[index]),
+                    std::move(waits[index]), std::move(waitStages[index]), fence);
+            }
+            else
+            {
+                m_GraphicsQueue->Submit(queued.CommandBuffer, std::move(signals[index]),
+                    std::move(waits[index]), std::move(waitStages[index]), fence);
+            }
+        }
+        m_QueuedCommandLists.clear();
+    }
 }
@@ -3,6 +3,7 @@
 
 #include "Platform/Vulkan/Resources/Texture.hpp"
 #include "Platform/Vulkan/Resources/Buffer.hpp"
+#include "Platform/Vulkan/Resources/MemoryHeap.hpp"
 
 #include "Platform/Vulkan/Pipeline/Pipeline.hpp"
 #include "Platform/Vulkan/Pipeline/Shader.hpp"
@@ -29,14 +30,13 @@ namespace Mixture::Vulkan
 		for (const uint32_t family : queueFamilies)
 			queueCreateInfos.emplace_back(vk::DeviceQueueCreateFlags(), family, 1, &queuePriority);
 
-		Vector<const char*> deviceExtensions = {
-			VK_KHR_SWAPCHAIN_EXTENSION_NAME
-		};
+		Vector<const char*> deviceExtensions;
+		if (m_PhysicalDevice->RequiresSwapchain()) deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
 
         // Check for Portability Subset (MacOS / MoltenVK)
         std::vector<vk::ExtensionProperties> availableExtensions =
             m_PhysicalDevice->GetHandle().enumerateDeviceExtensionProperties();
-        if (!PhysicalDevice::HasRequiredExtensions(availableExtensions))
+        if (!PhysicalDevice::HasRequiredExtensions(availableExtensions, m_PhysicalDevice->RequiresSwapchain()))
             throw std::runtime_error("Selected Vulkan device does not support VK_KHR_swapchain");
 
         for (const auto& ext : availableExtensions)
@@ -48,17 +48,27 @@ namespace Mixture::Vulkan
             }
         }
 
+        vk::PhysicalDeviceHostQueryResetFeatures hostQueryResetFeatures;
+
         vk::PhysicalDeviceBufferDeviceAddressFeatures bufferDeviceAddressFeatures;
         bufferDeviceAddressFeatures.bufferDeviceAddress = VK_TRUE;
+        bufferDeviceAddressFeatures.pNext = &hostQueryResetFeatures;
+
+        // Core and mandatory since Vulkan 1.3, which device selection already requires.
+        vk::PhysicalDeviceSynchronization2Features synchronization2Features;
+        synchronization2Features.synchronization2 = VK_TRUE;
+        synchronization2Features.pNext = &bufferDeviceAddressFeatures;
 
         vk::PhysicalDeviceDynamicRenderingFeatures dynamicRenderingFeatures;
         dynamicRenderingFeatures.dynamicRendering = VK_TRUE;
-        dynamicRenderingFeatures.pNext = &bufferDeviceAddressFeatures;
+        dynamicRenderingFeatures.pNext = &synchronization2Features;
 
         vk::PhysicalDeviceFeatures deviceFeatures;
         deviceFeatures.samplerAnisotropy = VK_TRUE;
 
+        vk::PhysicalDeviceHostQueryResetFeatures availableHostQueryReset;
         vk::PhysicalDeviceBufferDeviceAddressFeatures availableBufferDeviceAddress;
+        availableBufferDeviceAddress.pNext = &availableHostQueryReset;
         vk::PhysicalDeviceDynamicRenderingFeatures availableDynamicRendering;
         availableDynamicRendering.pNext = &availableBufferDeviceAddress;
         vk::PhysicalDeviceFeatures2 availableFeatures;
@@ -68,6 +78,10 @@ namespace Mixture::Vulkan
             availableDynamicRendering.dynamicRendering, availableBufferDeviceAddress.bufferDeviceAddress))
             throw std::runtime_error("Selected Vulkan device is missing required anisotropy, dynamic-rendering, or buffer-address features");
 
+        // Optional: without it the context simply reports no timestamp queries.
+        m_HostQueryReset = availableHostQueryReset.hostQueryReset == VK_TRUE;
+        hostQueryResetFeatures.hostQueryReset = availableHostQueryReset.hostQueryReset;
+
         vk::DeviceCreateInfo createInfo;
         createInfo.setQueueCreateInfos(queueCreateInfos);
         createInfo.pEnabledFeatures = &deviceFeatures;
@@ -150,4 +164,63 @@ namespace Mixture::Vulkan
     {
         return CreateRef<Pipeline>(shared_from_this(), desc);
     }
+
+    std::optional<RHI::MemoryRequirements> Device::GetMemoryRequirements(const RHI::TextureDesc& desc) const
+    {
+        if (!RHI::IsTextureUploadValid(desc, {})) return std::nullopt;
+
+        const vk::ImageCreateInfo imageInfo(Texture::GetImageCreateInfo(desc));
+        vk::DeviceImageMemoryRequirements query;
+        query.pCreateInfo = &imageInfo;
+        const vk::MemoryRequirements requirements = m_Device.getImageMemoryRequirements(query).memoryRequirements;
+        return RHI::MemoryRequirements{ requirements.size, requirements.alignment, requirements.memoryTypeBits };
+    }
+
+    std::optional<RHI::MemoryRequirements> Device::GetMemoryRequirements(const RHI::BufferDesc& desc) const
+    {
+        if (!RHI::IsBufferUploadValid(desc, {})) return std::nullopt;
+
+        const vk::BufferCreateInfo bufferInfo = Buffer::GetBufferCreateInfo(desc);
+        vk::DeviceBufferMemoryRequirements query;
+        query.pCreateInfo = &bufferInfo;
+        const vk::MemoryRequirements requirements = m_Device.getBufferMemoryRequirements(query).memoryRequirements;
+        return RHI::MemoryRequirements{ requirements.size, requirements.alignment, requirements.memoryTypeBits };
+    }
+
+    Ref<RHI::IMemoryHeap> Device::CreateMemoryHeap(const RHI::MemoryRequirements& requirements)
+    {
+        try
+        {
+            return CreateRef<MemoryHeap>(shared_from_this(), requirements);
+        }
+        catch (const std::exception& err)
+        {
+            OPAL_WARN("Core/Vulkan", "Falling back to unaliased transients: {}", err.what());
+            return nullptr;
+        }
+    }
+
+    Ref<RHI::ITexture> Device::CreatePlacedTexture(const RHI::TextureDesc& desc,
+        const Ref<RHI::IMemoryHeap>& heap, uint64_t offset)
+    {
+        auto vulkanHeap = std::static_pointer_cast<MemoryHeap>(heap);
+        if (!vulkanHeap || !RHI::IsTextureUploadValid(desc, {}))
+        {
+            OPAL_ERROR("Core/Vulkan", "Rejected placed texture '{}' with invalid heap or description", desc.DebugName);
+            return nullptr;
+        }
+        return CreateRef<Texture>(shared_from_this(), desc, std::move(vulkanHeap), offset);
+    }
+
+    Ref<RHI::IBuffer> Device::CreatePlacedBuffer(const RHI::BufferDesc& desc,
+        const Ref<RHI::IMemoryHeap>& heap, uint64_t offset)
+    {
+        auto vulkanHeap = std::static_pointer_cast<MemoryHeap>(heap);
+        if (!vulkanHeap || !RHI::IsBufferUploadValid(desc, {}))
+        {
+            OPAL_ERROR("Core/Vulkan", "Rejected placed buffer '{}' with invalid heap or description", desc.DebugName);
+            return nullptr;
+        }
+        return CreateRef<Buffer>(shared_from_this(), desc, std::move(vulkanHeap), offset);
+    }
 }
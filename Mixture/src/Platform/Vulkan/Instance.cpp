@@ -72,11 +72,16 @@ namespace Mixture::Vulkan
             VK_API_VERSION_1_3                                                      // API Version
         );
 
-        uint32_t glfwExtensionCount = 0;
-        const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-        if (!glfwExtensions || glfwExtensionCount == 0)
-            throw std::runtime_error("GLFW did not provide required Vulkan instance extensions");
-        std::vector<const char*> extensions(glfwExtensions, glfwExtensions + glfwExtensionCount);
+        // Headless contexts never create a surface, so GLFW does not have to be initialized.
+        std::vector<const char*> extensions;
+        if (!appDescription.Headless)
+        {
+            uint32_t glfwExtensionCount = 0;
+            const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+            if (!glfwExtensions || glfwExtensionCount == 0)
+                throw std::runtime_error("GLFW did not provide required Vulkan instance extensions");
+            extensions.assign(glfwExtensions, glfwExtensions + glfwExtensionCount);
+        }
 
 #ifdef __APPLE__
         extensions.push_back(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME);
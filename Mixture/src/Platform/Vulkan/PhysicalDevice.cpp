@@ -26,6 +26,7 @@ namespace Mixture::Vulkan
         if (devices.empty())
             throw std::runtime_error("No Vulkan-capable physical devices were found");
 
+        m_RequiresSwapchain = !Context::Get().IsHeadless();
         m_PhysicalDevice = SelectBestDevice(devices);
         m_Indices = FindQueueFamilies(m_PhysicalDevice);
 
@@ -40,9 +41,9 @@ namespace Mixture::Vulkan
         return std::string_view(m_Properties.deviceName);
     }
 
-    bool PhysicalDevice::HasRequiredExtensions(const Vector<vk::ExtensionProperties>& extensions)
+    bool PhysicalDevice::HasRequiredExtensions(const Vector<vk::ExtensionProperties>& extensions, bool requiresSwapchain)
     {
-        return std::any_of(extensions.begin(), extensions.end(), [](const vk::ExtensionProperties& extension) {
+        return !requiresSwapchain || std::any_of(extensions.begin(), extensions.end(), [](const vk::ExtensionProperties& extension) {
             return std::strcmp(extension.extensionName, VK_KHR_SWAPCHAIN_EXTENSION_NAME) == 0;
         });
     }
@@ -102,12 +103,15 @@ namespace Mixture::Vulkan
         }
 
         const auto extensions = device.enumerateDeviceExtensionProperties();
-        if (!HasRequiredExtensions(extensions)) return -1;
+        if (!HasRequiredExtensions(extensions, m_RequiresSwapchain)) return -1;
         if (!HasRequiredFeatures(features.features.samplerAnisotropy,
             dynamicRenderingFeatures.dynamicRendering, bufferDeviceAddressFeatures.bufferDeviceAddress)) return -1;
 
-        const auto surface = Context::Get().GetSurface().GetHandle();
-        if (!HasUsableSurface(device.getSurfaceFormatsKHR(surface), device.getSurfacePresentModesKHR(surface))) return -1;
+        if (m_RequiresSwapchain)
+        {
+            const auto surface = Context::Get().GetSurface().GetHandle();
+            if (!HasUsableSurface(device.getSurfaceFormatsKHR(surface), device.getSurfacePresentModesKHR(surface))) return -1;
+        }
 
         // Big Score for Discrete GPU (Dedicated Card)
         if (props.deviceType == vk::PhysicalDeviceType::eDiscreteGpu) score += 1000;
@@ -122,7 +126,8 @@ namespace Mixture::Vulkan
     {
         QueueFamilyIndices indices;
         Vector<vk::QueueFamilyProperties> queueFamilies = device.getQueueFamilyProperties();
-        vk::SurfaceKHR surface = Context::Get().GetSurface().GetHandle();
+        // Headless contexts never present, so the graphics family stands in for the present family.
+        const vk::SurfaceKHR surface = m_RequiresSwapchain ? Context::Get().GetSurface().GetHandle() : vk::SurfaceKHR{};
 
         int i = 0;
         for (const auto& queueFamily : queueFamilies)
@@ -130,7 +135,8 @@ namespace Mixture::Vulkan
             // Check for Graphics capability
             if (queueFamily.queueFlags & vk::QueueFlagBits::eGraphics) indices.Graphics = i;
             if (queueFamily.queueFlags & vk::QueueFlagBits::eTransfer) indices.Transfer = i;
-            if (device.getSurfaceSupportKHR(i, surface)) indices.Present = i;
+            if (!surface) indices.Present = indices.Graphics;
+            else if (device.getSurfaceSupportKHR(i, surface)) indices.Present = i;
             if (queueFamily.queueFlags & vk::QueueFlagBits::eCompute) indices.Compute = i;
 
             if (indices.IsComplete()) break;
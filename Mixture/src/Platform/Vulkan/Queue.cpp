@@ -29,6 +29,16 @@ namespace Mixture::Vulkan
                        Vector<vk::Semaphore> waitSemaphores,
                        Vector<vk::PipelineStageFlags> waitStages,
                        vk::Fence fence)
+    {
+        Submit(m_Buffers->Get(frameIndex), std::move(signalSemaphores),
+            std::move(waitSemaphores), std::move(waitStages), fence);
+    }
+
+    void Queue::Submit(vk::CommandBuffer commandBuffer,
+                       Vector<vk::Semaphore> signalSemaphores,
+                       Vector<vk::Semaphore> waitSemaphores,
+                       Vector<vk::PipelineStageFlags> waitStages,
+                       vk::Fence fence)
     {
         if (waitSemaphores.size() != waitStages.size())
         {
@@ -41,7 +51,7 @@ namespace Mixture::Vulkan
         {
             vk::SubmitInfo submitInfo;
             submitInfo.commandBufferCount = 1;
-            submitInfo.pCommandBuffers = m_Buffers->GetPointer(frameIndex);
+            submitInfo.pCommandBuffers = &commandBuffer;
             submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
             submitInfo.pSignalSemaphores = signalSemaphores.data();
             submitInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
@@ -1,6 +1,7 @@
 #include "mxpch.hpp"
 #include "Platform/Vulkan/Resources/Buffer.hpp"
 #include "Platform/Vulkan/Resources/AllocationPolicy.hpp"
+#include "Platform/Vulkan/Resources/MemoryHeap.hpp"
 
 #include "Platform/Vulkan/Device.hpp"
 #include "Platform/Vulkan/Queue.hpp"
@@ -18,10 +19,7 @@ namespace Mixture::Vulkan
 
         // Create the GPU Buffer
         // We generally allocate GPU_ONLY for best performance.
-        vk::BufferCreateInfo bufferInfo = {};
-        bufferInfo.size = desc.Size;
-        bufferInfo.usage = EnumMapper::MapBufferUsage(desc.Usage) |= vk::BufferUsageFlagBits::eTransferDst;
-        bufferInfo.sharingMode = vk::SharingMode::eExclusive;
+        vk::BufferCreateInfo bufferInfo = GetBufferCreateInfo(desc);
 
         VmaAllocationCreateInfo allocInfo = AllocationPolicy::DeviceLocal();
         // TODO: For frequent CPU updates (Uniforms), we might want VMA_MEMORY_USAGE_CPU_TO_GPU
@@ -80,11 +78,35 @@ namespace Mixture::Vulkan
         }
     }
 
+    Buffer::Buffer(Ref<Device> device, const RHI::BufferDesc& desc, Ref<MemoryHeap> heap, uint64_t offset)
+        : m_Device(std::move(device)), m_Desc(desc), m_Heap(std::move(heap))
+    {
+        if (!m_Device || !m_Heap) throw std::invalid_argument("Placed buffer requires an owning device and heap");
+
+        const vk::Buffer buffer = m_Device->GetHandle().createBuffer(GetBufferCreateInfo(desc));
+        if (vmaBindBufferMemory2(m_Device->GetAllocator(), m_Heap->GetAllocation(), offset, buffer, nullptr) != VK_SUCCESS)
+        {
+            m_Device->GetHandle().destroyBuffer(buffer);
+            throw std::runtime_error("Failed to bind placed Vulkan buffer into its aliasing heap");
+        }
+        m_Buffer = buffer;
+    }
+
     Buffer::~Buffer()
     {
         if (m_Buffer)
         {
+            // Placed buffers have no allocation of their own; VMA then only destroys the buffer.
             vmaDestroyBuffer(m_Device->GetAllocator(), m_Buffer, m_Allocation);
         }
     }
+
+    vk::BufferCreateInfo Buffer::GetBufferCreateInfo(const RHI::BufferDesc& desc)
+    {
+        vk::BufferCreateInfo bufferInfo = {};
+        bufferInfo.size = desc.Size;
+        bufferInfo.usage = EnumMapper::MapBufferUsage(desc.Usage) |= vk::BufferUsageFlagBits::eTransferDst;
+        bufferInfo.sharingMode = vk::SharingMode::eExclusive;
+        return bufferInfo;
+    }
 }
@@ -0,0 +1,34 @@
+#include "mxpch.hpp"
+#include "Platform/Vulkan/Resources/MemoryHeap.hpp"
+#include "Platform/Vulkan/Resources/AllocationPolicy.hpp"
+
+#include "Platform/Vulkan/Device.hpp"
+
+#include <stdexcept>
+
+namespace Mixture::Vulkan
+{
+    MemoryHeap::MemoryHeap(Ref<Device> device, const RHI::MemoryRequirements& requirements)
+        : m_Device(std::move(device)), m_Size(requirements.Size)
+    {
+        if (!m_Device) throw std::invalid_argument("Memory heap requires an owning device");
+        if (requirements.Size == 0) throw std::invalid_argument("Memory heap requires a non-zero size");
+
+        VkMemoryRequirements memoryRequirements = {};
+        memoryRequirements.size = requirements.Size;
+        memoryRequirements.alignment = requirements.Alignment;
+        memoryRequirements.memoryTypeBits = requirements.MemoryTypeBits;
+
+        VmaAllocationCreateInfo allocInfo = AllocationPolicy::AliasingHeap();
+        if (vmaAllocateMemory(m_Device->GetAllocator(), &memoryRequirements, &allocInfo, &m_Allocation, nullptr) != VK_SUCCESS)
+            throw std::runtime_error("Failed to allocate Vulkan aliasing heap");
+    }
+
+    MemoryHeap::~MemoryHeap()
+    {
+        if (m_Allocation)
+        {
+            vmaFreeMemory(m_Device->GetAllocator(), m_Allocation);
+        }
+    }
+}
@@ -1,6 +1,8 @@
 #include "mxpch.hpp"
 #include "Platform/Vulkan/Resources/Texture.hpp"
 #include "Platform/Vulkan/Resources/AllocationPolicy.hpp"
+#include "Platform/Vulkan/Resources/MemoryHeap.hpp"
+#include "Mixture/Render/ResourceStateTracker.hpp"
 
 #include "Platform/Vulkan/Device.hpp"
 #include "Platform/Vulkan/Context.hpp"
@@ -11,8 +13,9 @@
 namespace Mixture::Vulkan
 {
     Texture::Texture(Ref<Device> device, const RHI::TextureDesc& spec, std::span<const std::byte> data)
-        : m_Device(std::move(device)), m_Width(spec.Width), m_Height(spec.Height), m_Format(spec.PixelFormat),
-          m_Usage(spec.Usage), m_DebugName(spec.DebugName), m_OwnsImage(true)
+        : m_Device(std::move(device)), m_Width(spec.Width), m_Height(spec.Height), m_MipLevels(spec.MipLevels),
+          m_ArrayLayers(spec.ArrayLayers), m_Format(spec.PixelFormat), m_Usage(spec.Usage), m_DebugName(spec.DebugName),
+          m_OwnsImage(true)
     {
         if (!m_Device) throw std::invalid_argument("Texture requires an owning device");
         if (!data.empty()) m_Usage |= RHI::TextureUsage::TransferDestination;
@@ -72,11 +75,12 @@ namespace Mixture::Vulkan
                     barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
                     barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
                     barrier.image = destinationImage;
+                    // The data fills mip 0 of layer 0, but every subresource ends in the final state.
                     barrier.subresourceRange.aspectMask = aspect;
                     barrier.subresourceRange.baseMipLevel = 0;
-                    barrier.subresourceRange.levelCount = 1;
+                    barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
                     barrier.subresourceRange.baseArrayLayer = 0;
-                    barrier.subresourceRange.layerCount = 1;
+                    barrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
                     barrier.srcAccessMask = vk::AccessFlagBits::eNone;
                     barrier.dstAccessMask = vk::AccessFlagBits::eTransferWrite;
                     cmd.pipelineBarrier(vk::PipelineStageFlagBits::eTopOfPipe, vk::PipelineStageFlagBits::eTransfer,
@@ -99,9 +103,19 @@ namespace Mixture::Vulkan
                         vk::DependencyFlags(), 0, nullptr, 0, nullptr, 1, &barrier);
                 },
                 [allocator, stagingBuffer, stagingAllocation]() { vmaDestroyBuffer(allocator, stagingBuffer, stagingAllocation); });
+            ResourceStateTracker::Get().SetState(this, finalState);
         }
     }
 
+    Texture::Texture(Ref<Device> device, const RHI::TextureDesc& spec, Ref<MemoryHeap> heap, uint64_t offset)
+        : m_Device(std::move(device)), m_Width(spec.Width), m_Height(spec.Height), m_MipLevels(spec.MipLevels),
+          m_ArrayLayers(spec.ArrayLayers), m_Format(spec.PixelFormat), m_Usage(spec.Usage), m_DebugName(spec.DebugName),
+          m_Heap(std::move(heap)), m_HeapOffset(offset), m_OwnsImage(true)
+    {
+        if (!m_Device || !m_Heap) throw std::invalid_argument("Placed texture requires an owning device and heap");
+        Invalidate();
+    }
+
     Texture::Texture(Ref<Device> device, vk::Format format, vk::Image image, vk::ImageView imageView,
         uint32_t width, uint32_t height)
         : m_Device(std::move(device)), m_Format(EnumMapper::MapFormat(format)), m_Image(image)
@@ -124,14 +138,17 @@ namespace Mixture::Vulkan
             auto device = m_Device->GetHandle();
             auto allocator = m_Device->GetAllocator();
 
+            for (const vk::ImageView view : m_AttachmentViews) device.destroyImageView(view);
             if (m_ImageView) device.destroyImageView(m_ImageView);
             if (m_Sampler) device.destroySampler(m_Sampler);
-            if (m_Image && m_Allocation) vmaDestroyImage(allocator, m_Image, m_Allocation);
+            // Placed images have no allocation of their own; VMA then only destroys the image.
+            if (m_Image) vmaDestroyImage(allocator, m_Image, m_Allocation);
         }
 
         // Reset handles
         m_Image = nullptr;
         m_ImageView = nullptr;
+        m_AttachmentViews.clear();
         m_Allocation = nullptr;
     }
 
@@ -147,47 +164,81 @@ namespace Mixture::Vulkan
         auto allocator = device.GetAllocator();
 
         // Image Info
-        VkImageCreateInfo imageInfo = {};
-        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-        imageInfo.imageType = VK_IMAGE_TYPE_2D;
-        imageInfo.format = static_cast<VkFormat>(EnumMapper::MapFormat(m_Format));
-        imageInfo.extent.width = m_Width;
-        imageInfo.extent.height = m_Height;
-        imageInfo.extent.depth = 1;
-        imageInfo.mipLevels = 1;
-        imageInfo.arrayLayers = 1;
-        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
-        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-        imageInfo.usage = static_cast<VkImageUsageFlags>(MapTextureUsage(m_Usage));
-
-        // Allocation Info (VMA)
-        VmaAllocationCreateInfo allocInfo = AllocationPolicy::DeviceLocal();
+        RHI::TextureDesc spec;
+        spec.Width = m_Width;
+        spec.Height = m_Height;
+        spec.PixelFormat = m_Format;
+        spec.Usage = m_Usage;
+        spec.MipLevels = m_MipLevels;
+        spec.ArrayLayers = m_ArrayLayers;
+        VkImageCreateInfo imageInfo = GetImageCreateInfo(spec);
 
         // Create Image
         // (Cast to C handles for VMA)
         VkImage rawImage;
-        if (vmaCreateImage(allocator, &imageInfo, &allocInfo, &rawImage, &m_Allocation, nullptr) != VK_SUCCESS)
-            throw std::runtime_error("Failed to allocate Vulkan texture image");
+        if (m_Heap)
+        {
+            // Placed: bind into the shared heap at the planned offset
+            rawImage = device.GetHandle().createImage(vk::ImageCreateInfo(imageInfo));
+            if (vmaBindImageMemory2(allocator, m_Heap->GetAllocation(), m_HeapOffset, rawImage, nullptr) != VK_SUCCESS)
+            {
+                device.GetHandle().destroyImage(rawImage);
+                throw std::runtime_error("Failed to bind placed Vulkan texture into its aliasing heap");
+            }
+        }
+        else
+        {
+            // Allocation Info (VMA)
+            VmaAllocationCreateInfo allocInfo = RHI::HasUsage(m_Usage, RHI::TextureUsage::TransientAttachment)
+                ? AllocationPolicy::TransientAttachment() : AllocationPolicy::DeviceLocal();
+
+            if (vmaCreateImage(allocator, &imageInfo, &allocInfo, &rawImage, &m_Allocation, nullptr) != VK_SUCCESS)
+                throw std::runtime_error("Failed to allocate Vulkan texture image");
+        }
 
         m_Image = rawImage;
 
         // Create View
         vk::ImageViewCreateInfo viewInfo;
         viewInfo.image = m_Image;
-        viewInfo.viewType = vk::ImageViewType::e2D;
+        viewInfo.viewType = m_ArrayLayers > 1 ? vk::ImageViewType::e2DArray : vk::ImageViewType::e2D;
         viewInfo.format = vk::Format(imageInfo.format);
         viewInfo.subresourceRange.aspectMask = GetImageAspect(m_Format);
         viewInfo.subresourceRange.baseMipLevel = 0;
-        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.levelCount = m_MipLevels;
         viewInfo.subresourceRange.baseArrayLayer = 0;
-        viewInfo.subresourceRange.layerCount = 1;
+        viewInfo.subresourceRange.layerCount = m_ArrayLayers;
 
         try
         {
             m_ImageView = device.GetHandle().createImageView(viewInfo);
+
+            // Passes render to one mip and layer at a time, which needs a view of just that subresource.
+            const bool isAttachment = RHI::HasUsage(m_Usage, RHI::TextureUsage::ColorAttachment) ||
+                RHI::HasUsage(m_Usage, RHI::TextureUsage::DepthStencilAttachment);
+            if (isAttachment && m_MipLevels * m_ArrayLayers > 1)
+            {
+                viewInfo.viewType = vk::ImageViewType::e2D;
+                viewInfo.subresourceRange.levelCount = 1;
+                viewInfo.subresourceRange.layerCount = 1;
+                m_AttachmentViews.reserve(m_MipLevels * m_ArrayLayers);
+                for (uint32_t mip = 0; mip < m_MipLevels; ++mip)
+                {
+                    for (uint32_t layer = 0; layer < m_ArrayLayers; ++layer)
+                    {
+                        viewInfo.subresourceRange.baseMipLevel = mip;
+                        viewInfo.subresourceRange.baseArrayLayer = layer;
+                        m_AttachmentViews.push_back(device.GetHandle().createImageView(viewInfo));
+                    }
+                }
+            }
         }
         catch (...)
         {
+            for (const vk::ImageView view : m_AttachmentViews) device.GetHandle().destroyImageView(view);
+            m_AttachmentViews.clear();
+            if (m_ImageView) device.GetHandle().destroyImageView(m_ImageView);
+            m_ImageView = nullptr;
             vmaDestroyImage(allocator, m_Image, m_Allocation);
             m_Image = nullptr;
             m_Allocation = nullptr;
@@ -207,6 +258,7 @@ namespace Mixture::Vulkan
         samplerInfo.unnormalizedCoordinates = VK_FALSE;
         samplerInfo.compareEnable = VK_FALSE;
         samplerInfo.mipmapMode = vk::SamplerMipmapMode::eLinear;
+        samplerInfo.maxLod = static_cast<float>(m_MipLevels);
 
         try
         {
@@ -214,6 +266,8 @@ namespace Mixture::Vulkan
         }
         catch (...)
         {
+            for (const vk::ImageView view : m_AttachmentViews) device.GetHandle().destroyImageView(view);
+            m_AttachmentViews.clear();
             device.GetHandle().destroyImageView(m_ImageView);
             vmaDestroyImage(allocator, m_Image, m_Allocation);
             m_Image = nullptr;
@@ -223,6 +277,29 @@ namespace Mixture::Vulkan
         }
     }
 
+    VkImageCreateInfo Texture::GetImageCreateInfo(const RHI::TextureDesc& spec)
+    {
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.format = static_cast<VkFormat>(EnumMapper::MapFormat(spec.PixelFormat));
+        imageInfo.extent.width = spec.Width;
+        imageInfo.extent.height = spec.Height;
+        imageInfo.extent.depth = 1;
+        imageInfo.mipLevels = spec.MipLevels;
+        imageInfo.arrayLayers = spec.ArrayLayers;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.usage = static_cast<VkImageUsageFlags>(MapTextureUsage(spec.Usage));
+        return imageInfo;
+    }
+
+    vk::ImageView Texture::GetAttachmentView(uint32_t mipLevel, uint32_t arrayLayer) const
+    {
+        if (m_AttachmentViews.empty()) return m_ImageView;
+        return m_AttachmentViews[mipLevel * m_ArrayLayers + arrayLayer];
+    }
+
     vk::DescriptorImageInfo Texture::GetDescriptorInfo() const
     {
         vk::DescriptorImageInfo info;
@@ -1,6 +1,8 @@
 #include "mxpch.hpp"
 #include "Platform/Vulkan/SingleTimeCommand.hpp"
 
+#include "Mixture/Core/Profiler.hpp"
+
 #include "Platform/Vulkan/Context.hpp"
 #include "Platform/Vulkan/Device.hpp"
 
@@ -106,6 +108,7 @@ namespace Mixture::Vulkan
 
                     try
                     {
+                        MX_PROFILE_SCOPE("GPU Upload Batch");
                         m_Device.GetHandle().resetFences(m_Fence);
                         m_CommandBuffer.reset();
                         vk::CommandBufferBeginInfo beginInfo;
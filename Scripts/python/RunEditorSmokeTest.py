@@ -0,0 +1,56 @@
+import argparse
+import subprocess
+import sys
+from pathlib import Path
+
+from RunTests import find_project_executable
+
+
+def build_command(executable: Path, frames: int) -> list[str]:
+    return [str(executable), "--headless", "--frames", str(frames)]
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description="Render a few headless frames through the Editor layers"
+    )
+    parser.add_argument("--configuration", default="Release")
+    parser.add_argument("--build-root", type=Path, default=Path("bin"))
+    parser.add_argument("--frames", type=int, default=5)
+    parser.add_argument("--timeout", type=float, default=300.0)
+    args = parser.parse_args()
+
+    if args.frames <= 0:
+        print("--frames must be positive; 0 would run until closed", file=sys.stderr)
+        return 1
+
+    repository_root = Path(__file__).resolve().parents[2]
+    build_root = args.build_root
+    if not build_root.is_absolute():
+        build_root = repository_root / build_root
+
+    try:
+        executable = find_project_executable(build_root, args.configuration, "Editor")
+    except (FileNotFoundError, RuntimeError) as error:
+        print(error, file=sys.stderr)
+        return 1
+
+    # The Editor resolves Assets/ relative to the working directory.
+    try:
+        result = subprocess.run(
+            build_command(executable, args.frames),
+            cwd=repository_root,
+            check=False,
+            timeout=args.timeout,
+        )
+    except subprocess.TimeoutExpired:
+        print(f"Editor did not finish {args.frames} headless frames in {args.timeout} s", file=sys.stderr)
+        return 1
+
+    if result.returncode != 0:
+        print(f"Headless Editor run failed with exit code {result.returncode}", file=sys.stderr)
+    return result.returncode
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -4,17 +4,17 @@ import sys
 from pathlib import Path
 
 
-def find_test_executable(build_root: Path, configuration: str) -> Path:
-    executable_names = {"Tests", "Tests.exe"}
+def find_project_executable(build_root: Path, configuration: str, project: str) -> Path:
+    executable_names = {project, f"{project}.exe"}
     candidates = sorted(
         path.resolve()
-        for path in build_root.glob(f"{configuration}-*/Tests/*")
+        for path in build_root.glob(f"{configuration}-*/{project}/*")
         if path.is_file() and path.name in executable_names
     )
 
     if not candidates:
         raise FileNotFoundError(
-            f"No {configuration} test executable found below {build_root}"
+            f"No {configuration} {project} executable found below {build_root}"
         )
     if len(candidates) > 1:
         formatted = "\n".join(f"  - {candidate}" for candidate in candidates)
@@ -22,6 +22,10 @@ def find_test_executable(build_root: Path, configuration: str) -> Path:
     return candidates[0]
 
 
+def find_test_executable(build_root: Path, configuration: str) -> Path:
+    return find_project_executable(build_root, configuration, "Tests")
+
+
 def main() -> int:
     parser = argparse.ArgumentParser(description="Run the generated Mixture test binary")
     parser.add_argument("--configuration", default="Release")
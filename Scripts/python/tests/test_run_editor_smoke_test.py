@@ -0,0 +1,38 @@
+import sys
+import tempfile
+import unittest
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+
+from RunEditorSmokeTest import build_command
+from RunTests import find_project_executable
+
+
+class EditorSmokeTestTests(unittest.TestCase):
+    def setUp(self):
+        self.temporary_directory = tempfile.TemporaryDirectory()
+        self.build_root = Path(self.temporary_directory.name)
+
+    def tearDown(self):
+        self.temporary_directory.cleanup()
+
+    def test_finds_editor_next_to_tests(self):
+        for project in ("Editor", "Tests"):
+            executable = self.build_root / f"Release-linux-x86_64/{project}/{project}"
+            executable.parent.mkdir(parents=True)
+            executable.touch()
+
+        self.assertEqual(
+            find_project_executable(self.build_root, "Release", "Editor"),
+            (self.build_root / "Release-linux-x86_64/Editor/Editor").resolve(),
+        )
+
+    def test_runs_a_bounded_headless_session(self):
+        command = build_command(Path("Editor"), 5)
+
+        self.assertEqual(command[1:], ["--headless", "--frames", "5"])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,18 @@
+#pragma once
+
+/**
+ * @file AllocationCounter.hpp
+ * @brief Global allocation counter shared by the allocation benchmarks of the test binary.
+ */
+
+#include <cstdint>
+
+namespace Mixture::Tests
+{
+    /**
+     * @brief Returns the number of global operator new calls made by any thread since startup.
+     *
+     * Benchmarks sample it before and after a workload to report allocations per iteration.
+     */
+    uint64_t GetAllocationCount();
+}
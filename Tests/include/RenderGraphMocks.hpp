@@ -0,0 +1,179 @@
+#pragma once
+
+/**
+ * @file RenderGraphMocks.hpp
+ * @brief In-memory RHI device and context shared by the render graph tests and benchmarks.
+ */
+
+#include "Mixture/Render/RHI/IGraphicsContext.hpp"
+#include "Mixture/Render/RHI/IGraphicsDevice.hpp"
+
+#include <string>
+#include <unordered_map>
+
+namespace Mixture::Tests
+{
+    class MockTexture final : public RHI::ITexture
+    {
+    public:
+        explicit MockTexture(const RHI::TextureDesc& desc)
+            : m_Desc(desc)
+        {}
+
+        uint32_t GetWidth() const override { return m_Desc.Width; }
+        uint32_t GetHeight() const override { return m_Desc.Height; }
+        RHI::Format GetFormat() const override { return m_Desc.PixelFormat; }
+        uint32_t GetMipLevels() const override { return m_Desc.MipLevels; }
+        uint32_t GetArrayLayers() const override { return m_Desc.ArrayLayers; }
+        std::string_view GetDebugName() const override { return m_Desc.DebugName; }
+
+    private:
+        RHI::TextureDesc m_Desc;
+    };
+
+    class MockBuffer final : public RHI::IBuffer
+    {
+    public:
+        explicit MockBuffer(const RHI::BufferDesc& desc)
+            : m_Desc(desc)
+        {}
+
+        uint64_t GetSize() const override { return m_Desc.Size; }
+        RHI::BufferUsage GetUsage() const override { return m_Desc.Usage; }
+
+    private:
+        RHI::BufferDesc m_Desc;
+    };
+
+    class MockShader final : public RHI::IShader
+    {
+    public:
+        explicit MockShader(RHI::ShaderIdentity identity)
+            : m_Identity(identity)
+        {}
+
+        RHI::ShaderIdentity GetIdentity() const override { return m_Identity; }
+        RHI::ShaderStage GetStage() const override { return m_Identity.Stage; }
+
+    private:
+        RHI::ShaderIdentity m_Identity;
+    };
+
+    class MockPipeline final : public RHI::IPipeline
+    {
+    public:
+        MockPipeline(size_t& destructionCount, bool valid)
+            : m_DestructionCount(destructionCount), m_Valid(valid)
+        {}
+
+        ~MockPipeline() override { ++m_DestructionCount; }
+        bool IsValid() const override { return m_Valid; }
+
+    private:
+        size_t& m_DestructionCount;
+        bool m_Valid;
+    };
+
+    class MockMemoryHeap final : public RHI::IMemoryHeap
+    {
+    public:
+        explicit MockMemoryHeap(uint64_t size) : m_Size(size) {}
+
+        uint64_t GetSize() const override { return m_Size; }
+
+    private:
+        uint64_t m_Size;
+    };
+
+    class MockGraphicsDevice final : public RHI::IGraphicsDevice
+    {
+    public:
+        Ref<RHI::IShader> CreateShader(const void*, size_t, RHI::ShaderStage,
+            RHI::ShaderIdentity identity) override
+        {
+            return CreateRef<MockShader>(identity);
+        }
+
+        Ref<RHI::IBuffer> CreateBuffer(const RHI::BufferDesc& desc, std::span<const std::byte>) override
+        {
+            ++BufferCreationCount;
+            return CreateRef<MockBuffer>(desc);
+        }
+
+        Ref<RHI::ITexture> CreateTexture(const RHI::TextureDesc& desc, std::span<const std::byte>) override
+        {
+            ++TextureCreationCount;
+            return CreateRef<MockTexture>(desc);
+        }
+
+        Ref<RHI::IPipeline> CreatePipeline(const RHI::PipelineDesc&) override
+        {
+            ++PipelineCreationCount;
+            return CreateRef<MockPipeline>(PipelineDestructionCount, NextPipelineValid);
+        }
+
+        std::optional<RHI::MemoryRequirements> GetMemoryRequirements(const RHI::TextureDesc& desc) const override
+        {
+            if (!SupportsAliasing) return std::nullopt;
+            return RHI::MemoryRequirements{ RHI::GetTextureUploadSize(desc).value_or(0), 256, 0b1 };
+        }
+
+        std::optional<RHI::MemoryRequirements> GetMemoryRequirements(const RHI::BufferDesc& desc) const override
+        {
+            if (!SupportsAliasing) return std::nullopt;
+            return RHI::MemoryRequirements{ desc.Size, 256, 0b1 };
+        }
+
+        Ref<RHI::IMemoryHeap> CreateMemoryHeap(const RHI::MemoryRequirements& requirements) override
+        {
+            if (!SupportsAliasing) return nullptr;
+            ++HeapCreationCount;
+            return CreateRef<MockMemoryHeap>(requirements.Size);
+        }
+
+        Ref<RHI::ITexture> CreatePlacedTexture(const RHI::TextureDesc& desc,
+            const Ref<RHI::IMemoryHeap>&, uint64_t offset) override
+        {
+            ++PlacedCreationCount;
+            PlacedOffsets[std::string(desc.DebugName)] = offset;
+            return CreateRef<MockTexture>(desc);
+        }
+
+        Ref<RHI::IBuffer> CreatePlacedBuffer(const RHI::BufferDesc& desc,
+            const Ref<RHI::IMemoryHeap>&, uint64_t offset) override
+        {
+            ++PlacedCreationCount;
+            PlacedOffsets[desc.DebugName] = offset;
+            return CreateRef<MockBuffer>(desc);
+        }
+
+        void WaitForIdle() override {}
+
+        bool SupportsAliasing = false;
+        size_t HeapCreationCount = 0;
+        size_t PlacedCreationCount = 0;
+        std::unordered_map<std::string, uint64_t> PlacedOffsets;
+        size_t BufferCreationCount = 0;
+        size_t TextureCreationCount = 0;
+        size_t PipelineCreationCount = 0;
+        size_t PipelineDestructionCount = 0;
+        bool NextPipelineValid = true;
+    };
+
+    class HeadlessGraphicsContext final : public RHI::IGraphicsContext
+    {
+    public:
+        RHI::GraphicsAPI GetAPI() const override { return RHI::GraphicsAPI::None; }
+        RHI::IGraphicsDevice& GetDevice() const override { return m_Device; }
+        void OnResize(uint32_t, uint32_t) override {}
+        RHI::ITexture* BeginFrame() override { return nullptr; }
+        void EndFrame() override {}
+        Scope<RHI::ICommandList> GetCommandBuffer() override { return nullptr; }
+        uint32_t GetSwapchainWidth() const override { return 0; }
+        uint32_t GetSwapchainHeight() const override { return 0; }
+        uint32_t GetCurrentFrameIndex() const override { return 0; }
+
+    private:
+        mutable MockGraphicsDevice m_Device;
+    };
+}
@@ -0,0 +1,34 @@
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__GNUC__) && !defined(__clang__)
+    // GCC flags the malloc/free pair below once the replacement operators get inlined.
+    #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace
+{
+    // Counts every global allocation in the test binary so benchmarks can report allocations per iteration.
+    std::atomic<uint64_t> s_AllocationCount = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace Mixture::Tests
+{
+    uint64_t GetAllocationCount()
+    {
+        return s_AllocationCount.load(std::memory_order_relaxed);
+    }
+}
@@ -5,12 +5,19 @@
 #include "Mixture/Assets/Shaders/ShaderAsset.hpp"
 #include "Mixture/Assets/Shaders/ShaderCompiler.hpp"
 #include "Mixture/Assets/Shaders/IShaderReflector.hpp"
+#include "Mixture/Assets/Shaders/ShaderSerializer.hpp"
 #include "Mixture/Assets/Textures/TextureAsset.hpp"
+#include "Mixture/Assets/Textures/TextureSerializer.hpp"
+#include "Mixture/Core/Threading/TaskSystem.hpp"
 #include "Mixture/Util/FileStreamReader.hpp"
+#include "Mixture/Util/MappedFile.hpp"
 #include <fstream>
 #include <thread>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include "Mixture/Util/FileSystemWatcher.hpp"
 
@@ -380,16 +387,42 @@ TEST_F(AssetManagerTests, LoadsAssetsOnOwnedExecutorAndWaitsForIdle)
     EXPECT_EQ(shader->GetBufferSize(), 4u);
     EXPECT_EQ(manager.GetResource<TextureAsset>(loaded), nullptr);
 
+    // Mapped reads finish at once, so hold the I/O thread in a callback while the load to cancel is queued.
+    const std::filesystem::path gatePath = shaderDirectory / "Gate.spv";
     const std::filesystem::path cancelledPath = shaderDirectory / "Cancelled.spv";
+    for (const auto& path : { gatePath, cancelledPath })
     {
-        std::ofstream stream(cancelledPath, std::ios::binary);
-        stream.seekp((32 * 1024 * 1024) - 1);
-        stream.put('\0');
+        const std::array<char, 4> bytecode{ 0x03, 0x02, 0x23, 0x07 };
+        std::ofstream stream(path, std::ios::binary);
+        stream.write(bytecode.data(), static_cast<std::streamsize>(bytecode.size()));
+    }
+
+    std::mutex gateMutex;
+    std::condition_variable gateCondition;
+    bool gateEntered = false;
+    bool gateReleased = false;
+    manager.AddReloadCallback([&](AssetType, UUID) {
+        std::unique_lock<std::mutex> lock(gateMutex);
+        if (gateEntered) return;
+        gateEntered = true;
+        gateCondition.notify_all();
+        gateCondition.wait(lock, [&] { return gateReleased; });
+    });
+
+    ASSERT_TRUE(manager.GetAsset(AssetType::Shader, gatePath.filename()).ID.IsValid());
+    {
+        std::unique_lock<std::mutex> lock(gateMutex);
+        ASSERT_TRUE(gateCondition.wait_for(lock, std::chrono::seconds(10), [&] { return gateEntered; }));
     }
 
     const AssetHandle cancelled = manager.GetAsset(AssetType::Shader, cancelledPath.filename());
     ASSERT_TRUE(cancelled.ID.IsValid());
     EXPECT_TRUE(manager.CancelLoad(cancelled.ID));
+    {
+        std::lock_guard<std::mutex> lock(gateMutex);
+        gateReleased = true;
+    }
+    gateCondition.notify_all();
     manager.WaitForIdle();
     EXPECT_FALSE(manager.IsAssetLoaded(cancelled.ID));
 
@@ -542,6 +575,275 @@ TEST_F(AssetManagerTests, SteadyStateLookupAvoidsMetadataFileAccess)
     std::filesystem::remove_all(root);
 }
 
+namespace
+{
+    void WriteTestShader(const std::filesystem::path& path)
+    {
+        const std::array<char, 4> bytecode{ 0x03, 0x02, 0x23, 0x07 };
+        std::ofstream stream(path, std::ios::binary);
+        stream.write(bytecode.data(), static_cast<std::streamsize>(bytecode.size()));
+    }
+
+    /** Writes an uncompressed 32-bit TGA, which the texture decoder reads without extra codecs. */
+    void WriteTestTexture(const std::filesystem::path& path, uint16_t width, uint16_t height)
+    {
+        std::array<uint8_t, 18> header{};
+        header[2] = 2;
+        header[12] = static_cast<uint8_t>(width & 0xFF);
+        header[13] = static_cast<uint8_t>(width >> 8);
+        header[14] = static_cast<uint8_t>(height & 0xFF);
+        header[15] = static_cast<uint8_t>(height >> 8);
+        header[16] = 32;
+        header[17] = 8;
+
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+        for (size_t index = 0; index < pixels.size(); ++index)
+            pixels[index] = static_cast<uint8_t>(index * 31 + index / 4096);
+
+        std::ofstream stream(path, std::ios::binary);
+        stream.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+        stream.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+    }
+
+    /** Writes an uncompressed 32-bit RGBA DDS, the pre-cooked layout textures are served from without a copy. */
+    std::vector<uint8_t> WriteTestDDS(const std::filesystem::path& path, uint32_t width, uint32_t height)
+    {
+        std::array<uint32_t, 32> header{};
+        header[0] = 0x20534444;  // "DDS "
+        header[1] = 124;
+        header[2] = 0x100F;      // caps, height, width, pitch, pixel format
+        header[3] = height;
+        header[4] = width;
+        header[5] = width * 4;
+        header[19] = 32;
+        header[20] = 0x41;       // RGB with alpha
+        header[22] = 32;
+        header[23] = 0x000000FF;
+        header[24] = 0x0000FF00;
+        header[25] = 0x00FF0000;
+        header[26] = 0xFF000000;
+        header[27] = 0x1000;     // texture
+
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+        for (size_t index = 0; index < pixels.size(); ++index)
+            pixels[index] = static_cast<uint8_t>(index * 7);
+
+        std::ofstream stream(path, std::ios::binary);
+        stream.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(sizeof(header)));
+        stream.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+        return pixels;
+    }
+
+    UUID WriteTestMetadata(AssetType type, const std::filesystem::path& path)
+    {
+        AssetMetadata metadata;
+        metadata.ID = UUID();
+        metadata.Type = type;
+        metadata.FilePath = path;
+        AssetSerializer::WriteMetadata(metadata);
+        return metadata.ID;
+    }
+}
+
+TEST_F(AssetManagerTests, QueuedLoadsAreReadInPriorityOrder)
+{
+    // Decoding inline on the I/O thread keeps completions in the order the reads were served.
+    ASSERT_FALSE(TaskSystem::IsInitialized());
+
+    AssetManager& manager = AssetManager::Get();
+    const std::filesystem::path root = std::filesystem::temp_directory_path()
+        / ("MixtureAssetPriority-" + std::to_string(static_cast<uint64_t>(UUID())));
+    const std::filesystem::path shaderDirectory = root / "Shader";
+    std::filesystem::create_directories(shaderDirectory);
+
+    std::unordered_map<std::string, UUID> ids;
+    for (const char* name : { "Gate", "A", "B", "C", "D" })
+    {
+        const std::filesystem::path path = shaderDirectory / (std::string(name) + ".spv");
+        WriteTestShader(path);
+        ids[name] = WriteTestMetadata(AssetType::Shader, path);
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool gateEntered = false;
+    bool gateReleased = false;
+    std::vector<UUID> completed;
+    manager.AddReloadCallback([&](AssetType, UUID id) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (id == ids.at("Gate"))
+        {
+            gateEntered = true;
+            condition.notify_all();
+            condition.wait(lock, [&] { return gateReleased; });
+            return;
+        }
+        completed.push_back(id);
+    });
+
+    ConfigureTestAssetRoot(manager, root);
+    ASSERT_TRUE(manager.GetAsset(AssetType::Shader, "Gate.spv").ID.IsValid());
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(condition.wait_for(lock, std::chrono::seconds(10), [&] { return gateEntered; }));
+    }
+
+    // The I/O thread is held inside the gate's callback, so everything below stays queued.
+    manager.GetAsset(AssetType::Shader, "A.spv", AssetLoadPriority::Prefetch);
+    manager.GetAsset(AssetType::Shader, "B.spv", AssetLoadPriority::Prefetch);
+    manager.GetAsset(AssetType::Shader, "C.spv", AssetLoadPriority::Normal);
+    manager.GetAsset(AssetType::Shader, "D.spv", AssetLoadPriority::VisibleNow);
+
+    // Requesting again never lowers a priority, but can raise it.
+    manager.GetAsset(AssetType::Shader, "C.spv", AssetLoadPriority::Prefetch);
+    manager.GetAsset(AssetType::Shader, "A.spv", AssetLoadPriority::Normal);
+    EXPECT_TRUE(manager.SetLoadPriority(ids["B"], AssetLoadPriority::VisibleNow));
+    EXPECT_FALSE(manager.SetLoadPriority(UUID(), AssetLoadPriority::VisibleNow));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        gateReleased = true;
+    }
+    condition.notify_all();
+    manager.WaitForIdle();
+
+    const std::vector<UUID> expected{ ids["D"], ids["B"], ids["C"], ids["A"] };
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        EXPECT_EQ(completed, expected);
+    }
+    EXPECT_FALSE(manager.SetLoadPriority(ids["A"], AssetLoadPriority::VisibleNow));
+
+    manager.Shutdown();
+    std::filesystem::remove_all(root);
+}
+
+TEST_F(AssetManagerTests, ServesPreCookedTexturesWithoutHoldingWatchedFiles)
+{
+    AssetManager& manager = AssetManager::Get();
+    ASSERT_TRUE(manager.IsHotReloadEnabled());
+
+    const std::filesystem::path root = std::filesystem::temp_directory_path()
+        / ("MixtureAssetCooked-" + std::to_string(static_cast<uint64_t>(UUID())));
+    std::filesystem::create_directories(root / "Texture");
+    const std::filesystem::path watchedPath = root / "Texture" / "Watched.dds";
+    const std::vector<uint8_t> pixels = WriteTestDDS(watchedPath, 64, 32);
+
+    const auto loadTexture = [&manager](const char* path) -> Ref<TextureAsset>
+    {
+        manager.GetAsset(AssetType::Texture, path);
+        manager.WaitForIdle();
+        const AssetHandle handle = manager.GetAsset(AssetType::Texture, path);
+        return handle ? manager.GetResource<TextureAsset>(handle) : nullptr;
+    };
+
+    // Watched files are read into memory, so rewriting one in place cannot invalidate the asset.
+    ConfigureTestAssetRoot(manager, root);
+    Ref<TextureAsset> watched = loadTexture("Watched.dds");
+    ASSERT_NE(watched, nullptr);
+    {
+        std::ofstream stream(watchedPath, std::ios::binary | std::ios::trunc);
+    }
+    EXPECT_EQ(watched->GetWidth(), 64u);
+    EXPECT_EQ(watched->GetHeight(), 32u);
+    ASSERT_EQ(watched->GetDataSize(), pixels.size());
+    EXPECT_EQ(std::memcmp(watched->GetData(), pixels.data(), pixels.size()), 0);
+
+    // Without hot reload, cooked files are served from their mappings.
+    manager.SetHotReloadEnabled(false);
+    EXPECT_FALSE(manager.IsHotReloadEnabled());
+    WriteTestDDS(root / "Texture" / "Cooked.dds", 64, 32);
+    Ref<TextureAsset> cooked = loadTexture("Cooked.dds");
+    ASSERT_NE(cooked, nullptr);
+    ASSERT_EQ(cooked->GetDataSize(), pixels.size());
+    EXPECT_EQ(std::memcmp(cooked->GetData(), pixels.data(), pixels.size()), 0);
+
+    watched.reset();
+    cooked.reset();
+    manager.Shutdown();
+    EXPECT_TRUE(manager.IsHotReloadEnabled());
+    std::filesystem::remove_all(root);
+}
+
+TEST_F(AssetManagerTests, LoadingThroughputBenchmark)
+{
+    constexpr size_t textureCount = 48;
+    constexpr size_t shaderCount = 16;
+    constexpr uint16_t textureExtent = 256;
+
+    AssetManager& manager = AssetManager::Get();
+    const std::filesystem::path root = std::filesystem::temp_directory_path()
+        / ("MixtureAssetThroughput-" + std::to_string(static_cast<uint64_t>(UUID())));
+    std::filesystem::create_directories(root / "Texture");
+    std::filesystem::create_directories(root / "Shader");
+
+    std::vector<std::pair<AssetType, std::filesystem::path>> assets;
+    uintmax_t totalBytes = 0;
+    for (size_t index = 0; index < textureCount; ++index)
+    {
+        const std::filesystem::path path = root / "Texture" / ("Texture" + std::to_string(index) + ".tga");
+        WriteTestTexture(path, textureExtent, textureExtent);
+        WriteTestMetadata(AssetType::Texture, path);
+        assets.emplace_back(AssetType::Texture, path.filename());
+        totalBytes += std::filesystem::file_size(path);
+    }
+    for (size_t index = 0; index < shaderCount; ++index)
+    {
+        const std::filesystem::path path = root / "Shader" / ("Shader" + std::to_string(index) + ".spv");
+        WriteTestShader(path);
+        WriteTestMetadata(AssetType::Shader, path);
+        assets.emplace_back(AssetType::Shader, path.filename());
+        totalBytes += std::filesystem::file_size(path);
+    }
+
+    // Every run starts from an empty cache and registry, so it reads and decodes everything.
+    const auto loadAll = [&]() -> double
+    {
+        manager.Init();
+        ConfigureTestAssetRoot(manager, root);
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<AssetHandle> handles;
+        handles.reserve(assets.size());
+        for (const auto& [type, path] : assets)
+            handles.push_back(manager.GetAsset(type, path));
+        manager.WaitForIdle();
+        const double milliseconds = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+
+        for (const AssetHandle& handle : handles)
+        {
+            EXPECT_TRUE(handle.ID.IsValid());
+            EXPECT_TRUE(manager.IsAssetLoaded(handle.ID));
+        }
+        manager.Shutdown();
+        return milliseconds;
+    };
+
+    manager.Shutdown();
+    const double inlineMs = loadAll();
+
+    const uint32_t threads = std::max(2u, std::thread::hardware_concurrency());
+    TaskSystem::Init(threads);
+    const double workerMs = loadAll();
+    TaskSystem::Shutdown();
+
+    const double megabytes = static_cast<double>(totalBytes) / (1024.0 * 1024.0);
+    const auto assetsPerSecond = [&](double milliseconds) { return assets.size() * 1000.0 / std::max(milliseconds, 0.001); };
+    const auto megabytesPerSecond = [&](double milliseconds) { return megabytes * 1000.0 / std::max(milliseconds, 0.001); };
+    RecordProperty("Assets", std::to_string(assets.size()));
+    RecordProperty("Megabytes", std::to_string(megabytes));
+    RecordProperty("DecodeWorkers", std::to_string(threads));
+    RecordProperty("InlineDecodeMs", std::to_string(inlineMs));
+    RecordProperty("InlineDecodeAssetsPerSecond", std::to_string(assetsPerSecond(inlineMs)));
+    RecordProperty("InlineDecodeMegabytesPerSecond", std::to_string(megabytesPerSecond(inlineMs)));
+    RecordProperty("WorkerDecodeMs", std::to_string(workerMs));
+    RecordProperty("WorkerDecodeAssetsPerSecond", std::to_string(assetsPerSecond(workerMs)));
+    RecordProperty("WorkerDecodeMegabytesPerSecond", std::to_string(megabytesPerSecond(workerMs)));
+
+    std::filesystem::remove_all(root);
+}
+
 // --- AssetSerializer Metadata Tests ---
 
 TEST(AssetSerializerTests, MetadataRoundTrip)
@@ -634,6 +936,32 @@ TEST(FileStreamReaderTests, ReportsCompleteAndFailedReads)
     std::filesystem::remove(path);
 }
 
+TEST(MappedFileTests, MapsFileContentsAndRejectsMissingOrEmptyFiles)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path()
+        / ("MixtureMappedFile-" + std::to_string(static_cast<uint64_t>(UUID())));
+    {
+        std::ofstream stream(path, std::ios::binary);
+        stream << "abcd";
+    }
+
+    Ref<MappedFile> file = MappedFile::Open(path);
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(file->GetSize(), 4u);
+    EXPECT_EQ(std::memcmp(file->GetData().data(), "abcd", 4), 0);
+
+    EXPECT_EQ(MappedFile::Open(path.string() + ".missing"), nullptr);
+    EXPECT_EQ(MappedFile::Open(path.parent_path()), nullptr);
+
+    // The mapping outlives the file's directory entry.
+    file.reset();
+    {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    }
+    EXPECT_EQ(MappedFile::Open(path), nullptr);
+    std::filesystem::remove(path);
+}
+
 // --- Asset Types Tests ---
 
 TEST(AssetTypeTests, TextureAsset)
@@ -669,6 +997,59 @@ TEST(AssetTypeTests, ShaderAsset)
     EXPECT_EQ(ptr[0], 0xDE);
 }
 
+TEST(AssetTypeTests, PreCookedAssetsReferenceTheMappedFile)
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path()
+        / ("MixtureCookedAssets-" + std::to_string(static_cast<uint64_t>(UUID())));
+    std::filesystem::create_directories(directory);
+    const std::filesystem::path shaderPath = directory / "Cooked.spv";
+    const std::filesystem::path texturePath = directory / "Cooked.dds";
+    WriteTestShader(shaderPath);
+    const std::vector<uint8_t> pixels = WriteTestDDS(texturePath, 8, 4);
+
+    AssetMetadata metadata;
+    metadata.ID = UUID();
+    metadata.Type = AssetType::Shader;
+    metadata.FilePath = shaderPath;
+    Ref<MappedFile> shaderFile = MappedFile::Open(shaderPath);
+    ASSERT_NE(shaderFile, nullptr);
+    Ref<ShaderAsset> shader = std::dynamic_pointer_cast<ShaderAsset>(
+        ShaderSerializer().Load(shaderFile->GetData(), shaderFile, metadata));
+    ASSERT_NE(shader, nullptr);
+    EXPECT_EQ(shader->GetBufferPointer(), shaderFile->GetData().data());
+    EXPECT_EQ(shader->GetBufferSize(), 4u);
+
+    metadata.Type = AssetType::Texture;
+    metadata.FilePath = texturePath;
+    Ref<MappedFile> textureFile = MappedFile::Open(texturePath);
+    ASSERT_NE(textureFile, nullptr);
+    Ref<TextureAsset> texture = std::dynamic_pointer_cast<TextureAsset>(
+        TextureSerializer().Load(textureFile->GetData(), textureFile, metadata));
+    ASSERT_NE(texture, nullptr);
+    EXPECT_EQ(texture->GetWidth(), 8u);
+    EXPECT_EQ(texture->GetHeight(), 4u);
+    EXPECT_EQ(texture->GetFormat(), RHI::Format::R8G8B8A8_UNORM);
+    EXPECT_EQ(texture->GetData(), textureFile->GetData().data() + 128);
+    ASSERT_EQ(texture->GetDataSize(), pixels.size());
+
+    // The assets keep their mappings alive after the loader lets go.
+    shaderFile.reset();
+    textureFile.reset();
+    EXPECT_EQ(static_cast<const uint8_t*>(shader->GetBufferPointer())[0], 0x03);
+    EXPECT_EQ(std::memcmp(texture->GetData(), pixels.data(), pixels.size()), 0);
+    shader.reset();
+    texture.reset();
+
+    // Truncated pixel data is rejected instead of read past the mapping.
+    std::filesystem::resize_file(texturePath, 128 + pixels.size() - 1);
+    Ref<MappedFile> truncated = MappedFile::Open(texturePath);
+    ASSERT_NE(truncated, nullptr);
+    EXPECT_EQ(TextureSerializer().Load(truncated->GetData(), truncated, metadata), nullptr);
+
+    truncated.reset();
+    std::filesystem::remove_all(directory);
+}
+
 // --- Shader Compiler Tests ---
 
 TEST_F(AssetManagerTests, ShaderCompilerProducesValidOutputWhenAvailable)
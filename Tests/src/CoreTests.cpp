@@ -3,9 +3,12 @@
 #include "Mixture/Core/Time.hpp"
 #include "Mixture/Core/LayerStack.hpp"
 #include "Mixture/Core/Application.hpp"
+#include "Mixture/Core/Profiler.hpp"
 #include "Opal/Log.hpp"
 #include <cstdlib>
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 #include <thread>
 
 namespace Mixture::Tests {
@@ -253,4 +256,114 @@ namespace Mixture::Tests {
         EXPECT_THROW(Window(WindowProps("Invalid", 0, 480)), std::invalid_argument);
     }
 
+    // --- Profiler.hpp Tests ---
+
+    TEST(CoreTests, ProfilerWritesScopesOfEveryThreadAsChromeTrace)
+    {
+        { MX_PROFILE_SCOPE("Profiler Test Before Capture"); }
+
+        Profiler::BeginCapture();
+        {
+            const std::string passName = "Profiler \"Quoted\" Pass";
+            MX_PROFILE_SCOPE("Profiler Test Outer");
+            MX_PROFILE_SCOPE_COPY(passName);
+        }
+        std::thread worker([]()
+        {
+            Opal::LogRegistry::SetThreadName("Profiler Test Thread");
+            MX_PROFILE_SCOPE("Profiler Test Worker");
+        });
+        worker.join();
+        EXPECT_TRUE(Profiler::EndCapture());
+        EXPECT_FALSE(Profiler::IsCapturing());
+        { MX_PROFILE_SCOPE("Profiler Test After Capture"); }
+
+        std::ostringstream stream;
+        Profiler::WriteChromeTrace(stream);
+        const std::string trace = stream.str();
+        EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+        EXPECT_NE(trace.find("\"name\":\"Profiler Test Outer\",\"ph\":\"X\""), std::string::npos);
+        EXPECT_NE(trace.find("\"name\":\"Profiler \\\"Quoted\\\" Pass\""), std::string::npos);
+        EXPECT_NE(trace.find("\"name\":\"Profiler Test Worker\""), std::string::npos);
+        EXPECT_NE(trace.find("\"args\":{\"name\":\"Profiler Test Thread\"}"), std::string::npos);
+        EXPECT_EQ(trace.find("Profiler Test Before Capture"), std::string::npos);
+        EXPECT_EQ(trace.find("Profiler Test After Capture"), std::string::npos);
+    }
+
+    TEST(CoreTests, ProfilerReusesRingsOfExitedThreadsAndRelabelsTracks)
+    {
+        const auto recordOnNewThread = [](const char* threadName)
+        {
+            std::thread worker([threadName]()
+            {
+                Opal::LogRegistry::SetThreadName(threadName);
+                MX_PROFILE_SCOPE("Profiler Test Short-Lived Thread");
+            });
+            worker.join();
+        };
+
+        Profiler::BeginCapture();
+        recordOnNewThread("Profiler Test First Thread");
+        EXPECT_TRUE(Profiler::EndCapture());
+        const size_t ringCount = Profiler::GetThreadRingCount();
+
+        // Exited threads' rings are reused by later captures, and their tracks do not carry over.
+        for (int capture = 0; capture < 4; ++capture)
+        {
+            Profiler::BeginCapture();
+            recordOnNewThread("Profiler Test Second Thread");
+            EXPECT_TRUE(Profiler::EndCapture());
+        }
+        EXPECT_EQ(Profiler::GetThreadRingCount(), ringCount);
+
+        std::ostringstream stream;
+        Profiler::WriteChromeTrace(stream);
+        EXPECT_EQ(stream.str().find("Profiler Test First Thread"), std::string::npos);
+        EXPECT_NE(stream.str().find("\"args\":{\"name\":\"Profiler Test Second Thread\"}"), std::string::npos);
+
+        // A thread renamed after recording is labelled with its new name in the next capture.
+        std::thread worker([]()
+        {
+            Opal::LogRegistry::SetThreadName("Profiler Test Early Name");
+            Profiler::BeginCapture();
+            { MX_PROFILE_SCOPE("Profiler Test Early Scope"); }
+            Profiler::EndCapture();
+
+            Opal::LogRegistry::SetThreadName("Profiler Test Late Name");
+            Profiler::BeginCapture();
+            { MX_PROFILE_SCOPE("Profiler Test Late Scope"); }
+            Profiler::EndCapture();
+        });
+        worker.join();
+
+        std::ostringstream relabelled;
+        Profiler::WriteChromeTrace(relabelled);
+        EXPECT_NE(relabelled.str().find("\"args\":{\"name\":\"Profiler Test Late Name\"}"), std::string::npos);
+        EXPECT_EQ(relabelled.str().find("Profiler Test Early Name"), std::string::npos);
+    }
+
+    TEST(CoreTests, ProfilerEndsFrameLimitedCapturesAndWritesTheTrace)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "MixtureProfilerTest.json";
+        std::filesystem::remove(path);
+
+        Profiler::BeginCapture(path, 2);
+        {
+            const std::string longName(Profiler::MaxCopiedNameLength + 10, 'x');
+            MX_PROFILE_SCOPE_COPY(longName);
+        }
+        Profiler::MarkFrame();
+        EXPECT_TRUE(Profiler::IsCapturing());
+        Profiler::MarkFrame();
+        EXPECT_FALSE(Profiler::IsCapturing());
+
+        std::ifstream file(path);
+        ASSERT_TRUE(file);
+        const std::string trace((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        const std::string truncated = "\"" + std::string(Profiler::MaxCopiedNameLength, 'x') + "\"";
+        EXPECT_NE(trace.find(truncated), std::string::npos);
+        file.close();
+        std::filesystem::remove(path);
+    }
+
 }
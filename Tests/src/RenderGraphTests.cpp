@@ -1,10 +1,14 @@
 #include <gtest/gtest.h>
 
+#include "Mixture/Core/Threading/TaskSystem.hpp"
 #include "Mixture/Render/Graph/RenderGraph.hpp"
 #include "Mixture/Render/Graph/RenderGraphDefinitions.hpp"
 #include "Mixture/Render/Graph/RenderGraphResourceCache.hpp"
 #include "Mixture/Render/Graph/RenderGraphRegistry.hpp"
+#include "Mixture/Render/DynamicResolution.hpp"
 #include "Mixture/Render/PipelineCache.hpp"
+#include "Mixture/Render/RenderStats.hpp"
+#include "Mixture/Render/ResourceStateTracker.hpp"
 #include "Mixture/Render/ShaderLibrary.hpp"
 #include "Mixture/Render/RHI/IGraphicsContext.hpp"
 #include "Mixture/Assets/AssetManager.hpp"
@@ -21,8 +25,14 @@
 #include "Platform/Vulkan/Instance.hpp"
 #include "Platform/Vulkan/PhysicalDevice.hpp"
 
+#include "AllocationCounter.hpp"
+#include "RenderGraphMocks.hpp"
+
+#include <array>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <optional>
 #include <type_traits>
 #include <chrono>
 
@@ -44,6 +54,62 @@ namespace Mixture::Tests
             return write;
         }
 
+        RGResourceNode MakeTransient(size_t index, const char* name, int32_t firstPass, int32_t lastPass)
+        {
+            RGResourceNode node;
+            node.Handle = RGResourceHandle::FromIndex(index);
+            node.Name = name;
+            node.Type = RGResourceType::Texture;
+            node.TextureDesc.Width = 64;
+            node.TextureDesc.Height = 64;
+            node.TextureDesc.DebugName = name;
+            node.FirstPassIndex = firstPass;
+            node.LastPassIndex = lastPass;
+            return node;
+        }
+
+        /**
+         * Declares a chain of passes that each read the previous pass's output, with
+         * an unrelated side-effect pass interleaved every eighth pass.
+         */
+        void DeclareChain(RenderGraph& graph, RHI::ITexture& output, size_t passCount, uint32_t width)
+        {
+            struct ChainData
+            {
+                RGResourceHandle Input;
+                RGResourceHandle Output;
+            };
+
+            const RGResourceHandle backbuffer = graph.ImportResource("Output", &output);
+            RHI::TextureDesc desc;
+            desc.Width = width;
+            desc.Height = 64;
+
+            RGResourceHandle previous;
+            for (size_t index = 0; index < passCount; ++index)
+            {
+                const bool isLast = index + 1 == passCount;
+                const RGResourceHandle target = isLast ? backbuffer
+                    : graph.CreateResource("Chain_" + std::to_string(index), desc);
+
+                if (index % 8 == 7)
+                {
+                    graph.AddPass<int>("Marker_" + std::to_string(index),
+                        [](RenderGraphBuilder& builder, int&) { builder.SetSideEffect(); },
+                        [](const RenderGraphRegistry&, const int&, RHI::ICommandList*) {});
+                }
+
+                graph.AddPass<ChainData>("Chain_" + std::to_string(index),
+                    [&](RenderGraphBuilder& builder, ChainData& data)
+                    {
+                        if (previous.IsValid()) data.Input = builder.Read(previous);
+                        data.Output = builder.Write(target);
+                    },
+                    [](const RenderGraphRegistry&, const ChainData&, RHI::ICommandList*) {});
+                previous = target;
+            }
+        }
+
         void ExpectOrder(const Vector<RGPassNode>& passes, std::initializer_list<const char*> expected)
         {
             ASSERT_EQ(passes.size(), expected.size());
@@ -56,117 +122,368 @@ namespace Mixture::Tests
             }
         }
 
-        class MockTexture final : public RHI::ITexture
+        /** Records the name of every command so tests can inspect the recorded stream. */
+        class MockCommandList final : public RHI::ICommandList
         {
         public:
-            explicit MockTexture(const RHI::TextureDesc& desc)
-                : m_Desc(desc)
-            {}
-
-            uint32_t GetWidth() const override { return m_Desc.Width; }
-            uint32_t GetHeight() const override { return m_Desc.Height; }
-            RHI::Format GetFormat() const override { return m_Desc.PixelFormat; }
-            std::string_view GetDebugName() const override { return m_Desc.DebugName; }
+            void Begin() override { Commands.push_back("Begin"); }
+            void End() override { Commands.push_back("End"); }
+            void BeginRendering(const RHI::RenderingInfo& info) override
+            {
+                Commands.push_back("BeginRendering");
+                for (const auto& attachment : info.ColorAttachments)
+                {
+                    LoadOps.push_back(attachment.LoadOp);
+                    StoreOps.push_back(attachment.StoreOp);
+                    AttachmentMips.push_back(attachment.MipLevel);
+                }
+                RenderAreas.emplace_back(info.RenderAreaWidth, info.RenderAreaHeight);
+                if (info.DepthAttachment)
+                {
+                    LoadOps.push_back(info.DepthAttachment->LoadOp);
+                    StoreOps.push_back(info.DepthAttachment->StoreOp);
+                }
+            }
+            void EndRendering() override { Commands.push_back("EndRendering"); }
+            void ExecuteSecondary(std::span<RHI::ICommandList* const> commandLists) override
+            {
+                Commands.push_back("ExecuteSecondary");
+                for (auto* commandList : commandLists)
+                {
+                    SecondaryCommands.push_back(static_cast<MockCommandList*>(commandList)->Commands);
+                }
+            }
 
-        private:
-            RHI::TextureDesc m_Desc;
+            void SetViewport(float, float, float, float, float, float) override {}
+            void SetScissor(int32_t, int32_t, uint32_t, uint32_t) override {}
+            void BindPipeline(RHI::IPipeline*) override {}
+            void BindVertexBuffer(RHI::IBuffer*, uint32_t, uint64_t) override {}
+            void BindIndexBuffer(RHI::IBuffer*, uint64_t) override {}
+            void PipelineBarrier(RHI::ITexture*, RHI::ResourceState, RHI::ResourceState,
+                RHI::QueueType sourceQueue, RHI::QueueType destinationQueue, const RHI::TextureSubresourceRange& subresources) override
+            {
+                Commands.push_back(sourceQueue == destinationQueue ? "Barrier" : "QueueTransfer");
+                TextureBarrierRanges.push_back(subresources);
+            }
+            void PipelineBarrier(RHI::IBuffer*, RHI::ResourceState, RHI::ResourceState,
+                RHI::QueueType sourceQueue, RHI::QueueType destinationQueue, const RHI::BufferRange& range) override
+            {
+                Commands.push_back(sourceQueue == destinationQueue ? "Barrier" : "QueueTransfer");
+                BufferBarrierRanges.push_back(range);
+            }
+            void PipelineBarriers(std::span<const RHI::ResourceBarrier> barriers) override
+            {
+                BarrierBatches.push_back(barriers.size());
+                ICommandList::PipelineBarriers(barriers);
+            }
+            void BeginSplitBarriers(uint32_t splitIndex, std::span<const RHI::ResourceBarrier>) override
+            {
+                SplitBegins.push_back(splitIndex);
+            }
+            void EndSplitBarriers(uint32_t splitIndex, std::span<const RHI::ResourceBarrier> barriers) override
+            {
+                SplitEnds.push_back(splitIndex);
+                ICommandList::EndSplitBarriers(splitIndex, barriers);
+            }
+            void WriteTimestamp(uint32_t queryIndex) override { Timestamps.push_back(queryIndex); }
+            void PushConstants(RHI::IPipeline*, RHI::ShaderStage, const void*, uint32_t) override {}
+            void SetUniformBuffer(uint32_t, RHI::IBuffer*, uint32_t, const RHI::BufferRange&) override {}
+            void SetTexture(uint32_t, RHI::ITexture*, uint32_t) override {}
+            void Draw(uint32_t, uint32_t, uint32_t, uint32_t) override {}
+            void DrawIndexed(uint32_t, uint32_t, uint32_t, int32_t, uint32_t) override {}
+
+            Vector<std::string> Commands;
+            /** Commands of every replayed secondary list, captured in replay order. */
+            Vector<Vector<std::string>> SecondaryCommands;
+            /** Size of every PipelineBarriers batch, including completed split barriers. */
+            Vector<size_t> BarrierBatches;
+            Vector<uint32_t> SplitBegins;
+            Vector<uint32_t> SplitEnds;
+            /** Query index of every WriteTimestamp. */
+            Vector<uint32_t> Timestamps;
+            /** Load and store op of every attachment bound by BeginRendering, color attachments first. */
+            Vector<RHI::LoadOp> LoadOps;
+            Vector<RHI::StoreOp> StoreOps;
+            /** Mip level of every color attachment and the render area of every BeginRendering. */
+            Vector<uint32_t> AttachmentMips;
+            Vector<std::pair<uint32_t, uint32_t>> RenderAreas;
+            /** Subresources of every recorded texture barrier. */
+            Vector<RHI::TextureSubresourceRange> TextureBarrierRanges;
+            /** Bytes of every recorded buffer barrier. */
+            Vector<RHI::BufferRange> BufferBarrierRanges;
         };
 
-        class MockBuffer final : public RHI::IBuffer
+        class ParallelRecordingContext final : public RHI::IGraphicsContext
         {
         public:
-            explicit MockBuffer(const RHI::BufferDesc& desc)
-                : m_Desc(desc)
-            {}
+            RHI::GraphicsAPI GetAPI() const override { return RHI::GraphicsAPI::None; }
+            RHI::IGraphicsDevice& GetDevice() const override { return m_Device; }
+            void OnResize(uint32_t, uint32_t) override {}
+            RHI::ITexture* BeginFrame() override { return nullptr; }
+            void EndFrame() override {}
+            Scope<RHI::ICommandList> GetCommandBuffer() override { return CreateScope<MockCommandList>(); }
+            uint32_t GetSwapchainWidth() const override { return 0; }
+            uint32_t GetSwapchainHeight() const override { return 0; }
+            uint32_t GetCurrentFrameIndex() const override { return 0; }
 
-            uint64_t GetSize() const override { return m_Desc.Size; }
-            RHI::BufferUsage GetUsage() const override { return m_Desc.Usage; }
+            bool SupportsParallelRecording() const override { return true; }
+            Scope<RHI::ICommandList> CreateSecondaryCommandList() override
+            {
+                ++SecondaryCount;
+                return CreateScope<MockCommandList>();
+            }
+
+            std::atomic<size_t> SecondaryCount = 0;
 
         private:
-            RHI::BufferDesc m_Desc;
+            mutable MockGraphicsDevice m_Device;
         };
 
-        class MockShader final : public RHI::IShader
+        /** Serves seeded timestamp ticks for the frame slot selected by the test. */
+        class TimestampContext final : public RHI::IGraphicsContext
         {
         public:
-            explicit MockShader(RHI::ShaderIdentity identity)
-                : m_Identity(identity)
-            {}
+            RHI::GraphicsAPI GetAPI() const override { return RHI::GraphicsAPI::None; }
+            RHI::IGraphicsDevice& GetDevice() const override { return m_Device; }
+            void OnResize(uint32_t, uint32_t) override {}
+            RHI::ITexture* BeginFrame() override { return nullptr; }
+            void EndFrame() override {}
+            Scope<RHI::ICommandList> GetCommandBuffer() override { return CreateScope<MockCommandList>(); }
+            uint32_t GetSwapchainWidth() const override { return 0; }
+            uint32_t GetSwapchainHeight() const override { return 0; }
+            uint32_t GetCurrentFrameIndex() const override { return FrameIndex; }
 
-            RHI::ShaderIdentity GetIdentity() const override { return m_Identity; }
-            RHI::ShaderStage GetStage() const override { return m_Identity.Stage; }
+            uint32_t GetTimestampQueryCount() const override { return QueryCount; }
+            double GetTimestampPeriod() const override { return 1000.0; }
+            bool ReadTimestamps(uint32_t frameIndex, uint32_t firstQuery, std::span<uint64_t> timestamps) const override
+            {
+                if (frameIndex >= Ticks.size() || firstQuery + timestamps.size() > Ticks[frameIndex].size()) return false;
+                std::copy_n(Ticks[frameIndex].begin() + firstQuery, timestamps.size(), timestamps.begin());
+                return true;
+            }
+
+            uint32_t FrameIndex = 0;
+            uint32_t QueryCount = 0;
+            /** Ticks of one microsecond each, indexed by frame slot and query. */
+            Vector<Vector<uint64_t>> Ticks;
 
         private:
-            RHI::ShaderIdentity m_Identity;
+            mutable MockGraphicsDevice m_Device;
         };
 
-        class MockPipeline final : public RHI::IPipeline
+        class AsyncComputeContext final : public RHI::IGraphicsContext
         {
         public:
-            MockPipeline(size_t& destructionCount, bool valid)
-                : m_DestructionCount(destructionCount), m_Valid(valid)
-            {}
-
-            ~MockPipeline() override { ++m_DestructionCount; }
-            bool IsValid() const override { return m_Valid; }
+            struct QueuedList
+            {
+                bool FrameList = false;
+                RHI::QueueType Queue = RHI::QueueType::Graphics;
+                Vector<uint32_t> WaitFor;
+                Vector<std::string> Commands;
+            };
 
-        private:
-            size_t& m_DestructionCount;
-            bool m_Valid;
-        };
+            RHI::GraphicsAPI GetAPI() const override { return RHI::GraphicsAPI::None; }
+            RHI::IGraphicsDevice& GetDevice() const override { return m_Device; }
+            void OnResize(uint32_t, uint32_t) override {}
+            RHI::ITexture* BeginFrame() override { return nullptr; }
+            void EndFrame() override {}
+            Scope<RHI::ICommandList> GetCommandBuffer() override { return CreateScope<MockCommandList>(); }
+            uint32_t GetSwapchainWidth() const override { return 0; }
+            uint32_t GetSwapchainHeight() const override { return 0; }
+            uint32_t GetCurrentFrameIndex() const override { return 0; }
 
-        class MockGraphicsDevice final : public RHI::IGraphicsDevice
-        {
-        public:
-            Ref<RHI::IShader> CreateShader(const void*, size_t, RHI::ShaderStage,
-                RHI::ShaderIdentity identity) override
+            bool SupportsAsyncCompute() const override { return true; }
+            Scope<RHI::ICommandList> CreateQueueCommandList(RHI::QueueType queue) override
             {
-                return CreateRef<MockShader>(identity);
+                m_PendingQueues.push_back(queue);
+                return CreateScope<MockCommandList>();
             }
 
-            Ref<RHI::IBuffer> CreateBuffer(const RHI::BufferDesc& desc, std::span<const std::byte>) override
+            uint32_t QueueCommandList(Scope<RHI::ICommandList> commandList, std::span<const uint32_t> waitFor) override
             {
-                ++BufferCreationCount;
-                return CreateRef<MockBuffer>(desc);
+                QueuedList& queued = Queued.emplace_back();
+                queued.FrameList = commandList == nullptr;
+                queued.WaitFor.assign(waitFor.begin(), waitFor.end());
+                if (commandList)
+                {
+                    queued.Queue = m_PendingQueues.front();
+                    m_PendingQueues.erase(m_PendingQueues.begin());
+                    queued.Commands = static_cast<MockCommandList*>(commandList.get())->Commands;
+                }
+                return static_cast<uint32_t>(Queued.size() - 1);
             }
 
-            Ref<RHI::ITexture> CreateTexture(const RHI::TextureDesc& desc, std::span<const std::byte>) override
+            Vector<QueuedList> Queued;
+
+        private:
+            mutable MockGraphicsDevice m_Device;
+            Vector<RHI::QueueType> m_PendingQueues;
+        };
+
+        /**
+         * Declares a graphics producer, a compute pass consuming it and a graphics
+         * consumer of the compute result writing @p output.
+         */
+        void DeclareAsyncCompute(RenderGraph& graph, RHI::IBuffer& output)
+        {
+            struct ComputeData {};
+
+            RHI::BufferDesc desc;
+            desc.Size = 256;
+            const RGResourceHandle input = graph.CreateResource("Input", desc);
+            const RGResourceHandle simulated = graph.CreateResource("Simulated", desc);
+            const RGResourceHandle imported = graph.ImportResource("Output", &output);
+
+            auto record = [](const char* name)
             {
-                ++TextureCreationCount;
-                return CreateRef<MockTexture>(desc);
-            }
+                return [name](const RenderGraphRegistry&, const ComputeData&, RHI::ICommandList* commandList)
+                {
+                    static_cast<MockCommandList*>(commandList)->Commands.push_back(name);
+                };
+            };
+
+            graph.AddPass<ComputeData>("Produce",
+                [&](RenderGraphBuilder& builder, ComputeData&) { builder.Write(input); },
+                record("Produce"));
+            graph.AddPass<ComputeData>("Simulate",
+                [&](RenderGraphBuilder& builder, ComputeData&)
+                {
+                    builder.SetQueue(RHI::QueueType::Compute);
+                    builder.Read(input);
+                    builder.Write(simulated);
+                },
+                record("Simulate"));
+            graph.AddPass<ComputeData>("Present",
+                [&](RenderGraphBuilder& builder, ComputeData&)
+                {
+                    builder.Read(simulated);
+                    builder.Write(imported);
+                },
+                record("Present"));
+        }
 
-            Ref<RHI::IPipeline> CreatePipeline(const RHI::PipelineDesc&) override
+        /** Declares three producers followed by one consumer reading all of them and writing @p output. */
+        void DeclareWideFanIn(RenderGraph& graph, RHI::IBuffer& output)
+        {
+            struct WideFanInData {};
+
+            RHI::BufferDesc desc;
+            desc.Size = 256;
+            const std::array<RGResourceHandle, 3> inputs = {
+                graph.CreateResource("A", desc), graph.CreateResource("B", desc), graph.CreateResource("C", desc) };
+            const RGResourceHandle imported = graph.ImportResource("Output", &output);
+
+            for (const RGResourceHandle input : inputs)
             {
-                ++PipelineCreationCount;
-                return CreateRef<MockPipeline>(PipelineDestructionCount, NextPipelineValid);
+                graph.AddPass<WideFanInData>("Produce",
+                    [input](RenderGraphBuilder& builder, WideFanInData&) { builder.Write(input); },
+                    [](const RenderGraphRegistry&, const WideFanInData&, RHI::ICommandList*) {});
             }
+            graph.AddPass<WideFanInData>("Consume",
+                [&](RenderGraphBuilder& builder, WideFanInData&)
+                {
+                    for (const RGResourceHandle input : inputs) builder.Read(input);
+                    builder.Write(imported);
+                },
+                [](const RenderGraphRegistry&, const WideFanInData&, RHI::ICommandList*) {});
+        }
 
-            void WaitForIdle() override {}
-
-            size_t BufferCreationCount = 0;
-            size_t TextureCreationCount = 0;
-            size_t PipelineCreationCount = 0;
-            size_t PipelineDestructionCount = 0;
-            bool NextPipelineValid = true;
-        };
+        /**
+         * Declares an opaque and a transparent pass drawing into the same color and depth
+         * targets, followed by a pass resolving the color target into @p output.
+         */
+        void DeclareLayeredScene(RenderGraph& graph, RHI::ITexture& output)
+        {
+            struct SceneData {};
+
+            RHI::TextureDesc colorDesc;
+            colorDesc.Width = 64;
+            colorDesc.Height = 64;
+            RHI::TextureDesc depthDesc = colorDesc;
+            depthDesc.PixelFormat = RHI::Format::D32_FLOAT;
+            const RGResourceHandle color = graph.CreateResource("Color", colorDesc);
+            const RGResourceHandle depth = graph.CreateResource("Depth", depthDesc);
+            const RGResourceHandle imported = graph.ImportResource("Output", &output);
+
+            auto record = [](const char* name)
+            {
+                return [name](const RenderGraphRegistry&, const SceneData&, RHI::ICommandList* commandList)
+                {
+                    static_cast<MockCommandList*>(commandList)->Commands.push_back(name);
+                };
+            };
+
+            graph.AddPass<SceneData>("Opaque",
+                [&](RenderGraphBuilder& builder, SceneData&)
+                {
+                    builder.Write(color);
+                    builder.Write(depth);
+                },
+                record("Opaque"));
+            graph.AddPass<SceneData>("Transparent",
+                [&](RenderGraphBuilder& builder, SceneData&)
+                {
+                    RGAttachmentInfo colorInfo;
+                    colorInfo.Handle = color;
+                    colorInfo.LoadOp = RHI::LoadOp::Load;
+                    RGAttachmentInfo depthInfo = colorInfo;
+                    depthInfo.Handle = depth;
+                    builder.Write(colorInfo);
+                    builder.Write(depthInfo);
+                },
+                record("Transparent"));
+            graph.AddPass<SceneData>("Resolve",
+                [&](RenderGraphBuilder& builder, SceneData&)
+                {
+                    builder.Read(color);
+                    builder.Write(imported);
+                },
+                record("Resolve"));
+        }
 
-        class HeadlessGraphicsContext final : public RHI::IGraphicsContext
+        /**
+         * Declares two independent producers, a consumer of both and an unrelated
+         * side-effect pass. Every pass logs its name into the list it records into.
+         */
+        void DeclareFanIn(RenderGraph& graph, RHI::IBuffer& output)
         {
-        public:
-            RHI::GraphicsAPI GetAPI() const override { return RHI::GraphicsAPI::None; }
-            RHI::IGraphicsDevice& GetDevice() const override { return m_Device; }
-            void OnResize(uint32_t, uint32_t) override {}
-            RHI::ITexture* BeginFrame() override { return nullptr; }
-            void EndFrame() override {}
-            Scope<RHI::ICommandList> GetCommandBuffer() override { return nullptr; }
-            uint32_t GetSwapchainWidth() const override { return 0; }
-            uint32_t GetSwapchainHeight() const override { return 0; }
-            uint32_t GetCurrentFrameIndex() const override { return 0; }
+            struct FanInData
+            {
+                RGResourceHandle Target;
+            };
 
-        private:
-            mutable MockGraphicsDevice m_Device;
-        };
+            RHI::BufferDesc desc;
+            desc.Size = 256;
+            const RGResourceHandle first = graph.CreateResource("First", desc);
+            const RGResourceHandle second = graph.CreateResource("Second", desc);
+            const RGResourceHandle imported = graph.ImportResource("Output", &output);
+
+            auto record = [](const char* name)
+            {
+                return [name](const RenderGraphRegistry&, const FanInData&, RHI::ICommandList* commandList)
+                {
+                    static_cast<MockCommandList*>(commandList)->Commands.push_back(name);
+                };
+            };
+
+            graph.AddPass<FanInData>("ProduceFirst",
+                [&](RenderGraphBuilder& builder, FanInData& data) { data.Target = builder.Write(first); },
+                record("ProduceFirst"));
+            graph.AddPass<FanInData>("ProduceSecond",
+                [&](RenderGraphBuilder& builder, FanInData& data) { data.Target = builder.Write(second); },
+                record("ProduceSecond"));
+            graph.AddPass<FanInData>("Marker",
+                [](RenderGraphBuilder& builder, FanInData&) { builder.SetSideEffect(); },
+                record("Marker"));
+            graph.AddPass<FanInData>("Combine",
+                [&](RenderGraphBuilder& builder, FanInData& data)
+                {
+                    builder.Read(first);
+                    builder.Read(second);
+                    data.Target = builder.Write(imported);
+                },
+                record("Combine"));
+        }
 
         template<typename T>
         concept HasImGuiLifecycle = requires(T& context, RHI::ICommandList* commandList)
@@ -312,6 +629,13 @@ namespace Mixture::Tests
             { vk::SurfaceFormatKHR{} }, { vk::PresentModeKHR::eFifo }));
     }
 
+    TEST(VulkanCapabilityTests, HeadlessDevicesDoNotRequireTheSwapchainExtension)
+    {
+        Vector<vk::ExtensionProperties> noExtensions;
+        EXPECT_TRUE(Vulkan::PhysicalDevice::HasRequiredExtensions(noExtensions, false));
+        EXPECT_FALSE(Vulkan::PhysicalDevice::HasRequiredExtensions(noExtensions, true));
+    }
+
     TEST(VulkanTexturePolicyTests, SupportsAllUsageAndAspectClasses)
     {
         const auto usage = Vulkan::MapTextureUsage(
@@ -348,6 +672,42 @@ namespace Mixture::Tests
         EXPECT_LT(elapsed, std::chrono::seconds(2));
     }
 
+    TEST(RenderGraphTests, ResolvesHashedNamesAndAliasChains)
+    {
+        static_assert("Backbuffer"_rg.Hash == RGResourceName::Hash64("Backbuffer"));
+        static_assert(RGResourceName("").Hash == 14695981039346656037ull);
+        static_assert("SceneColor"_rg != "SceneDepth"_rg);
+
+        MockGraphicsDevice device;
+        RHI::TextureDesc desc;
+        MockTexture swapchain(desc);
+        MockTexture viewport(desc);
+        RenderGraph graph(device);
+
+        const RGResourceHandle swapchainHandle = graph.ImportResource("SwapchainBackbuffer", &swapchain);
+        const RGResourceHandle viewportHandle = graph.ImportResource(std::string("ViewportTarget"), &viewport);
+        graph.AddAlias("Backbuffer", "Presented");
+        graph.AddAlias("Presented", "SwapchainBackbuffer");
+        EXPECT_EQ(graph.GetResource("Backbuffer"_rg), swapchainHandle);
+
+        graph.AddAlias("Presented", "ViewportTarget");
+        EXPECT_EQ(graph.GetResource("Backbuffer"_rg), viewportHandle);
+
+        // Resolved chains are reused, so repeated lookups neither hash nor allocate.
+        const uint64_t before = GetAllocationCount();
+        for (int lookup = 0; lookup < 1000; ++lookup)
+            EXPECT_EQ(graph.GetResource("Backbuffer"_rg), viewportHandle);
+        EXPECT_EQ(GetAllocationCount() - before, 0u);
+
+        graph.AddAlias("ViewportTarget", "Backbuffer");
+        EXPECT_FALSE(graph.GetResource("Backbuffer"_rg).IsValid());
+
+        graph.Clear();
+        EXPECT_FALSE(graph.GetResource("Backbuffer"_rg).IsValid());
+        EXPECT_EQ(graph.ImportResource("SwapchainBackbuffer"_rg, &swapchain), RGResourceHandle::FromIndex(0));
+        EXPECT_EQ(graph.GetResource("SwapchainBackbuffer"), RGResourceHandle::FromIndex(0));
+    }
+
     TEST(RenderGraphTests, PreservesReadAfterWriteDependency)
     {
         const RGResourceHandle resource{ 0 };
@@ -514,6 +874,1103 @@ namespace Mixture::Tests
         std::filesystem::remove_all(directory, error);
     }
 
+    TEST(RenderGraphTests, ReplaysCompiledScheduleForUnchangedTopology)
+    {
+        MockGraphicsDevice device;
+        RHI::TextureDesc outputDesc;
+        outputDesc.Width = 64;
+        outputDesc.Height = 64;
+        MockTexture output(outputDesc);
+
+        RenderGraph cached(device);
+        RenderGraph fresh(device);
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            cached.Clear();
+            DeclareChain(cached, output, 24, 64);
+            cached.Compile();
+        }
+        DeclareChain(fresh, output, 24, 64);
+        fresh.Compile();
+
+        EXPECT_EQ(cached.GetCompileStatistics().CacheMisses, 1u);
+        EXPECT_EQ(cached.GetCompileStatistics().CacheHits, 2u);
+
+        const auto directory = std::filesystem::temp_directory_path() /
+            ("mixture-compile-cache-" + std::to_string(reinterpret_cast<uintptr_t>(&device)));
+        ASSERT_TRUE(cached.DumpDiagnostics(directory / "cached.json"));
+        ASSERT_TRUE(fresh.DumpDiagnostics(directory / "fresh.json"));
+
+        auto readFile = [](const std::filesystem::path& path)
+        {
+            std::ifstream input(path);
+            return std::string(std::istreambuf_iterator<char>(input), {});
+        };
+        EXPECT_EQ(readFile(directory / "cached.json"), readFile(directory / "fresh.json"));
+
+        // A changed resource description must invalidate the schedule.
+        cached.Clear();
+        DeclareChain(cached, output, 24, 128);
+        cached.Compile();
+        EXPECT_EQ(cached.GetCompileStatistics().CacheMisses, 2u);
+
+        cached.InvalidateCompiledGraph();
+        cached.Clear();
+        DeclareChain(cached, output, 24, 128);
+        cached.Compile();
+        EXPECT_EQ(cached.GetCompileStatistics().CacheMisses, 3u);
+
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+    TEST(RenderGraphTests, CompileCacheBenchmarkFor200PassGraphs)
+    {
+        constexpr size_t passCount = 200;
+        constexpr int frames = 50;
+
+        MockGraphicsDevice device;
+        RHI::TextureDesc outputDesc;
+        MockTexture output(outputDesc);
+        RenderGraph graph(device);
+
+        auto timeCompiles = [&](bool changeTopology)
+        {
+            std::chrono::nanoseconds total{ 0 };
+            for (int frame = 0; frame < frames; ++frame)
+            {
+                graph.Clear();
+                DeclareChain(graph, output, passCount, changeTopology ? 64 + frame : 64);
+
+                const auto start = std::chrono::steady_clock::now();
+                graph.Compile();
+                total += std::chrono::steady_clock::now() - start;
+            }
+            return std::chrono::duration<double, std::micro>(total).count() / frames;
+        };
+
+        const double missMicroseconds = timeCompiles(true);
+        const double hitMicroseconds = timeCompiles(false);
+
+        const auto& stats = graph.GetCompileStatistics();
+        RecordProperty("FullCompileMicroseconds", std::to_string(missMicroseconds));
+        RecordProperty("CachedCompileMicroseconds", std::to_string(hitMicroseconds));
+        RecordProperty("CacheHits", std::to_string(stats.CacheHits));
+        RecordProperty("CacheMisses", std::to_string(stats.CacheMisses));
+
+        EXPECT_EQ(stats.CacheMisses, static_cast<uint64_t>(frames + 1));
+        EXPECT_EQ(stats.CacheHits, static_cast<uint64_t>(frames - 1));
+        EXPECT_LT(hitMicroseconds, missMicroseconds);
+    }
+
+    TEST(RenderGraphTests, SteadyStateFrameCycleBenchmark)
+    {
+        constexpr size_t passCount = 200;
+        constexpr int warmupFrames = 4;
+        constexpr int frames = 100;
+
+        MockGraphicsDevice device;
+        RHI::TextureDesc outputDesc;
+        MockTexture output(outputDesc);
+        RenderGraph graph(device);
+
+        // The first frames intern names, grow the node arrays and fill the compile cache.
+        for (int frame = 0; frame < warmupFrames; ++frame)
+        {
+            graph.Clear();
+            DeclareChain(graph, output, passCount, 64);
+            graph.Compile();
+        }
+
+        const uint64_t before = GetAllocationCount();
+        const auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            graph.Clear();
+            DeclareChain(graph, output, passCount, 64);
+            graph.AddAlias("Backbuffer", "Output");
+            EXPECT_TRUE(graph.GetResource("Backbuffer").IsValid());
+            graph.Compile();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const double allocationsPerFrame = static_cast<double>(GetAllocationCount() - before) / frames;
+        const double frameMicroseconds = std::chrono::duration<double, std::micro>(elapsed).count() / frames;
+
+        RecordProperty("FrameCycleMicroseconds", std::to_string(frameMicroseconds));
+        RecordProperty("AllocationsPerFrame", std::to_string(allocationsPerFrame));
+
+        EXPECT_EQ(graph.GetCompileStatistics().CacheHits, static_cast<uint64_t>(warmupFrames - 1 + frames));
+        EXPECT_LT(allocationsPerFrame, 1.0);
+    }
+
+    TEST(RenderGraphTests, SortAndCullBenchmarkFor1000Passes)
+    {
+        constexpr size_t passCount = 1000;
+        constexpr int iterations = 20;
+
+        // A chain into the imported output with a dead transient branch every fourth pass.
+        Vector<RGResourceNode> resources(passCount + 1);
+        for (size_t index = 0; index < resources.size(); ++index)
+        {
+            resources[index].Handle = RGResourceHandle::FromIndex(index);
+            resources[index].Type = index == passCount ? RGResourceType::ImportedTexture : RGResourceType::Texture;
+        }
+
+        Vector<RGPassNode> declared;
+        size_t deadPasses = 0;
+        for (size_t index = 0; index < passCount; ++index)
+        {
+            declared.push_back(MakePass("Pass"));
+            if (index % 4 == 3 && index + 1 < passCount)
+            {
+                ++deadPasses;
+                declared.back().Reads.push_back(RGResourceHandle::FromIndex(index - 1));
+                declared.back().Writes.push_back(AttachmentWrite(RGResourceHandle::FromIndex(index)));
+                continue;
+            }
+            const size_t input = index % 4 == 0 && index > 0 ? index - 2 : index - 1;
+            if (index > 0) declared.back().Reads.push_back(RGResourceHandle::FromIndex(input));
+            const size_t output = index + 1 == passCount ? passCount : index;
+            declared.back().Writes.push_back(AttachmentWrite(RGResourceHandle::FromIndex(output)));
+        }
+
+        uint64_t allocations = 0;
+        std::chrono::nanoseconds total{ 0 };
+        size_t livePasses = 0;
+        for (int iteration = 0; iteration < iterations; ++iteration)
+        {
+            Vector<RGPassNode> passes = declared;
+
+            const uint64_t before = GetAllocationCount();
+            const auto start = std::chrono::steady_clock::now();
+            RenderGraphAlgorithms::CullPasses(passes, resources);
+            ASSERT_TRUE(RenderGraphAlgorithms::SortPasses(passes));
+            total += std::chrono::steady_clock::now() - start;
+            allocations += GetAllocationCount() - before;
+            livePasses = passes.size();
+        }
+
+        const double microseconds = std::chrono::duration<double, std::micro>(total).count() / iterations;
+        const double allocationsPerRun = static_cast<double>(allocations) / iterations;
+        RecordProperty("CullAndSortMicroseconds", std::to_string(microseconds));
+        RecordProperty("AllocationsPerRun", std::to_string(allocationsPerRun));
+
+        EXPECT_EQ(livePasses, passCount - deadPasses);
+        // Dense scratch arrays only: the allocation count does not grow with the graph.
+        EXPECT_LE(allocationsPerRun, 16.0);
+    }
+
+    TEST(RenderGraphTests, AssignsDependencyLevelsFromResourceHazards)
+    {
+        const auto first = RGResourceHandle::FromIndex(0);
+        const auto second = RGResourceHandle::FromIndex(1);
+        const auto output = RGResourceHandle::FromIndex(2);
+
+        Vector<RGPassNode> passes;
+        passes.push_back(MakePass("WriteFirst"));
+        passes.back().Writes.push_back(AttachmentWrite(first));
+        passes.push_back(MakePass("WriteSecond"));
+        passes.back().Writes.push_back(AttachmentWrite(second));
+        passes.push_back(MakePass("Combine"));
+        passes.back().Reads = { first, second };
+        passes.back().Writes.push_back(AttachmentWrite(output));
+        passes.push_back(MakePass("ReadFirst"));
+        passes.back().Reads = { first };
+        passes.push_back(MakePass("OverwriteFirst"));
+        passes.back().Writes.push_back(AttachmentWrite(first));
+
+        EXPECT_EQ(RenderGraphAlgorithms::CalculateDependencyLevels(passes), 3u);
+        EXPECT_EQ(passes[0].DependencyLevel, 0u);
+        EXPECT_EQ(passes[1].DependencyLevel, 0u);
+        EXPECT_EQ(passes[2].DependencyLevel, 1u); // Read-after-write on both producers.
+        EXPECT_EQ(passes[3].DependencyLevel, 1u); // Independent of the other reader.
+        EXPECT_EQ(passes[4].DependencyLevel, 2u); // Write-after-read on both readers.
+    }
+
+    TEST(RenderGraphTests, RecordsIndependentPassesIntoSecondaryListsInScheduleOrder)
+    {
+        TaskSystem::Init(2);
+
+        ParallelRecordingContext context;
+        RHI::BufferDesc outputDesc;
+        outputDesc.Size = 256;
+        MockBuffer output(outputDesc);
+        RenderGraph graph(context.GetDevice());
+        graph.SetParallelRecording(true);
+        DeclareFanIn(graph, output);
+        graph.Compile();
+        EXPECT_EQ(graph.GetDependencyLevelCount(), 2u);
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+        TaskSystem::Shutdown();
+
+        ASSERT_EQ(primary.Commands, Vector<std::string>{ "ExecuteSecondary" });
+        ASSERT_EQ(primary.SecondaryCommands.size(), 4u);
+        EXPECT_EQ(context.SecondaryCount.load(), 4u);
+
+        const std::array<const char*, 4> expectedOrder = { "ProduceFirst", "ProduceSecond", "Marker", "Combine" };
+        for (size_t index = 0; index < expectedOrder.size(); ++index)
+        {
+            const auto& commands = primary.SecondaryCommands[index];
+            ASSERT_GE(commands.size(), 3u);
+            EXPECT_EQ(commands.front(), "Begin");
+            EXPECT_EQ(commands[commands.size() - 2], expectedOrder[index]);
+            EXPECT_EQ(commands.back(), "End");
+        }
+    }
+
+    TEST(RenderGraphTests, RecordsSeriallyWithoutTaskSystemOrWhenDisabled)
+    {
+        ParallelRecordingContext context;
+        RHI::BufferDesc outputDesc;
+        outputDesc.Size = 256;
+        MockBuffer output(outputDesc);
+        RenderGraph graph(context.GetDevice());
+
+        auto recordFrame = [&]()
+        {
+            graph.Clear();
+            DeclareFanIn(graph, output);
+            graph.Compile();
+
+            MockCommandList primary;
+            graph.Execute(&primary, &context);
+
+            Vector<std::string> names;
+            for (const auto& command : primary.Commands)
+            {
+                if (command != "Barrier") names.push_back(command);
+            }
+            return names;
+        };
+
+        const Vector<std::string> expected = { "ProduceFirst", "ProduceSecond", "Marker", "Combine" };
+        graph.SetParallelRecording(true);
+        EXPECT_EQ(recordFrame(), expected);
+
+        // Parallel recording is opt-in, as callbacks have to be safe to run concurrently.
+        TaskSystem::Init(2);
+        EXPECT_FALSE(RenderGraph(context.GetDevice()).IsParallelRecordingEnabled());
+        graph.SetParallelRecording(false);
+        EXPECT_EQ(recordFrame(), expected);
+        TaskSystem::Shutdown();
+
+        EXPECT_EQ(context.SecondaryCount.load(), 0u);
+    }
+
+    TEST(RenderGraphTests, SplitsSubmissionsAtCrossQueueDependencies)
+    {
+        Vector<RGPassNode> passes;
+        passes.push_back(MakePass("Graphics"));
+        passes.push_back(MakePass("Compute"));
+        passes.back().Queue = RHI::QueueType::Compute;
+        passes.back().QueueDependencies = { 0 };
+        passes.push_back(MakePass("Overlapping"));
+        passes.push_back(MakePass("Consume"));
+        passes.back().QueueDependencies = { 1 };
+
+        const auto submissions = RenderGraphAlgorithms::BuildSubmissions(passes);
+        ASSERT_EQ(submissions.size(), 4u);
+        EXPECT_EQ(submissions[0].Passes, Vector<uint32_t>{ 0 });
+        EXPECT_EQ(submissions[1].Queue, RHI::QueueType::Compute);
+        EXPECT_EQ(submissions[1].Passes, Vector<uint32_t>{ 1 });
+        EXPECT_EQ(submissions[1].WaitSubmissions, Vector<uint32_t>{ 0 });
+        // The independent pass runs while the compute submission is in flight.
+        EXPECT_EQ(submissions[2].Passes, Vector<uint32_t>{ 2 });
+        EXPECT_TRUE(submissions[2].WaitSubmissions.empty());
+        EXPECT_EQ(submissions[3].Passes, Vector<uint32_t>{ 3 });
+        EXPECT_EQ(submissions[3].WaitSubmissions, Vector<uint32_t>{ 1 });
+    }
+
+    TEST(RenderGraphTests, TransfersOwnershipBetweenQueues)
+    {
+        AsyncComputeContext context;
+        RHI::BufferDesc outputDesc;
+        outputDesc.Size = 256;
+        MockBuffer output(outputDesc);
+        RenderGraph graph(context.GetDevice());
+        DeclareAsyncCompute(graph, output);
+        graph.Compile();
+
+        const auto& submissions = graph.GetSubmissions();
+        ASSERT_EQ(submissions.size(), 3u);
+        EXPECT_EQ(submissions[1].Queue, RHI::QueueType::Compute);
+        EXPECT_EQ(submissions[1].WaitSubmissions, Vector<uint32_t>{ 0 });
+        EXPECT_EQ(submissions[2].WaitSubmissions, Vector<uint32_t>{ 1 });
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+
+        ASSERT_EQ(context.Queued.size(), 3u);
+        EXPECT_EQ(context.Queued[0].Queue, RHI::QueueType::Graphics);
+        EXPECT_EQ(context.Queued[0].Commands, (Vector<std::string>{ "Begin", "Barrier", "Produce", "QueueTransfer", "End" }));
+        EXPECT_EQ(context.Queued[1].Queue, RHI::QueueType::Compute);
+        EXPECT_EQ(context.Queued[1].WaitFor, Vector<uint32_t>{ 0 });
+        EXPECT_EQ(context.Queued[1].Commands,
+            (Vector<std::string>{ "Begin", "QueueTransfer", "Barrier", "Simulate", "QueueTransfer", "End" }));
+
+        // The last graphics submission is recorded into the frame's own list.
+        EXPECT_TRUE(context.Queued[2].FrameList);
+        EXPECT_EQ(context.Queued[2].WaitFor, Vector<uint32_t>{ 1 });
+        EXPECT_EQ(primary.Commands, (Vector<std::string>{ "QueueTransfer", "Barrier", "Present" }));
+    }
+
+    TEST(RenderGraphTests, RecordsComputePassesOnTheGraphicsQueueWithoutAsyncCompute)
+    {
+        ParallelRecordingContext context;
+        RHI::BufferDesc outputDesc;
+        outputDesc.Size = 256;
+        MockBuffer output(outputDesc);
+        RenderGraph graph(context.GetDevice());
+        DeclareAsyncCompute(graph, output);
+        graph.Compile();
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+
+        EXPECT_EQ(primary.Commands,
+            (Vector<std::string>{ "Barrier", "Produce", "Barrier", "Barrier", "Simulate", "Barrier", "Barrier", "Present" }));
+    }
+
+    TEST(RenderGraphTests, BatchesAllBarriersOfAPass)
+    {
+        ParallelRecordingContext context;
+        RHI::BufferDesc outputDesc;
+        outputDesc.Size = 256;
+        MockBuffer output(outputDesc);
+        RenderGraph graph(context.GetDevice());
+        graph.SetSplitBarrierDistance(0);
+        DeclareWideFanIn(graph, output);
+        graph.Compile();
+        EXPECT_EQ(graph.GetSplitBarrierCount(), 0u);
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+
+        // Three reads and the output write of the consumer share one batch.
+        EXPECT_EQ(primary.BarrierBatches, (Vector<size_t>{ 1, 1, 1, 4 }));
+        EXPECT_TRUE(primary.SplitBegins.empty());
+    }
+
+    TEST(RenderGraphTests, SplitsBarriersBetweenDistantPasses)
+    {
+        ParallelRecordingContext context;
+        RHI::BufferDesc outputDesc;
+        outputDesc.Size = 256;
+        MockBuffer output(outputDesc);
+        RenderGraph graph(context.GetDevice());
+        DeclareWideFanIn(graph, output);
+        graph.Compile();
+
+        // A and B are produced two or more passes before the consumer, C right before it.
+        EXPECT_EQ(graph.GetSplitBarrierCount(), 2u);
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+
+        EXPECT_EQ(primary.SplitBegins, (Vector<uint32_t>{ 0, 1 }));
+        EXPECT_EQ(primary.SplitEnds, (Vector<uint32_t>{ 0, 1 }));
+        EXPECT_EQ(primary.BarrierBatches, (Vector<size_t>{ 1, 1, 1, 1, 1, 2 }));
+    }
+
+    TEST(RenderGraphTests, FusesAdjacentPassesSharingAttachments)
+    {
+        ParallelRecordingContext context;
+        RHI::TextureDesc outputDesc;
+        outputDesc.Width = 64;
+        outputDesc.Height = 64;
+        MockTexture output(outputDesc);
+
+        RenderGraph graph(context.GetDevice());
+        DeclareLayeredScene(graph, output);
+        graph.Compile();
+        EXPECT_EQ(graph.GetMergedPassCount(), 1u);
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+
+        EXPECT_EQ(primary.Commands, (Vector<std::string>{ "Barrier", "Barrier", "BeginRendering", "Opaque", "Transparent",
+            "EndRendering", "Barrier", "Barrier", "BeginRendering", "Resolve", "EndRendering" }));
+        // Depth is dead after the fused scope, color is still read by the resolve.
+        EXPECT_EQ(primary.StoreOps, (Vector<RHI::StoreOp>{ RHI::StoreOp::Store, RHI::StoreOp::DontCare, RHI::StoreOp::Store }));
+
+        const auto path = std::filesystem::temp_directory_path() /
+            ("mixture-fused-passes-" + std::to_string(reinterpret_cast<uintptr_t>(&graph)) + ".json");
+        ASSERT_TRUE(graph.DumpDiagnostics(path));
+        std::ifstream input(path);
+        const std::string dump(std::istreambuf_iterator<char>(input), {});
+        EXPECT_NE(dump.find("\"fusedPasses\""), std::string::npos);
+        EXPECT_NE(dump.find("\"store\": \"DontCare\""), std::string::npos);
+        input.close();
+        std::filesystem::remove(path);
+
+        graph.SetRenderPassMerging(false);
+        graph.Clear();
+        DeclareLayeredScene(graph, output);
+        graph.Compile();
+        EXPECT_EQ(graph.GetMergedPassCount(), 0u);
+
+        MockCommandList unmerged;
+        graph.Execute(&unmerged, &context);
+        EXPECT_EQ(std::count(unmerged.Commands.begin(), unmerged.Commands.end(), "BeginRendering"), 3);
+    }
+
+    TEST(RenderGraphTests, ResolvesAttachmentOpsFromLifetimes)
+    {
+        struct AccumulateData {};
+
+        ParallelRecordingContext context;
+        RHI::TextureDesc desc;
+        desc.Width = 64;
+        desc.Height = 64;
+        MockTexture output(desc);
+
+        RenderGraph graph(context.GetDevice());
+        const RGResourceHandle history = graph.CreateResource("History", desc);
+        RHI::TextureDesc depthDesc = desc;
+        depthDesc.PixelFormat = RHI::Format::D32_FLOAT;
+        const RGResourceHandle depth = graph.CreateResource("Depth", depthDesc);
+        const RGResourceHandle imported = graph.ImportResource("Output", &output);
+
+        auto loadWrite = [](RGResourceHandle handle)
+        {
+            RGAttachmentInfo info;
+            info.Handle = handle;
+            info.LoadOp = RHI::LoadOp::Load;
+            return info;
+        };
+
+        graph.AddPass<AccumulateData>("Accumulate",
+            [&](RenderGraphBuilder& builder, AccumulateData&)
+            {
+                builder.Write(loadWrite(history));
+                builder.Write(loadWrite(depth));
+            },
+            [](const RenderGraphRegistry&, const AccumulateData&, RHI::ICommandList*) {});
+        graph.AddPass<AccumulateData>("Present",
+            [&](RenderGraphBuilder& builder, AccumulateData&)
+            {
+                builder.Read(history);
+                builder.Write(loadWrite(imported));
+            },
+            [](const RenderGraphRegistry&, const AccumulateData&, RHI::ICommandList*) {});
+        graph.Compile();
+
+        // Only the depth buffer never leaves the scope that created it.
+        EXPECT_EQ(graph.GetMemorylessResourceCount(), 1u);
+        EXPECT_TRUE(graph.GetResourceNode(depth).Memoryless);
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+
+        // Nothing wrote the transients before, while the imported output keeps its contents.
+        EXPECT_EQ(primary.LoadOps, (Vector<RHI::LoadOp>{ RHI::LoadOp::DontCare, RHI::LoadOp::DontCare, RHI::LoadOp::Load }));
+        EXPECT_EQ(primary.StoreOps, (Vector<RHI::StoreOp>{ RHI::StoreOp::Store, RHI::StoreOp::DontCare, RHI::StoreOp::Store }));
+    }
+
+    TEST(RenderGraphTests, SwapsPersistentResourcesAndCarriesStatesAcrossFrames)
+    {
+        struct TemporalData {};
+
+        ParallelRecordingContext context;
+        MockGraphicsDevice device;
+        RenderGraph graph(device);
+        graph.SetParallelRecording(false);
+
+        RHI::TextureDesc desc;
+        desc.Width = 64;
+        desc.Height = 64;
+
+        RHI::ITexture* previousCurrent = nullptr;
+        auto declareFrame = [&](const RHI::TextureDesc& frameDesc)
+        {
+            graph.Clear();
+            const RGResourceHandle accumulation = graph.CreatePersistentResource("Accumulation", frameDesc);
+            const RGResourceHandle history = graph.GetHistory(accumulation);
+            EXPECT_EQ(graph.GetHistory(accumulation), history);
+            EXPECT_EQ(graph.CreatePersistentResource("Accumulation", frameDesc), accumulation);
+
+            graph.AddPass<TemporalData>("Resolve",
+                [&](RenderGraphBuilder& builder, TemporalData&)
+                {
+                    builder.Read(history);
+                    builder.Write(accumulation);
+                },
+                [](const RenderGraphRegistry&, const TemporalData&, RHI::ICommandList*) {});
+            graph.Compile();
+            return std::pair{ accumulation, history };
+        };
+
+        auto [first, firstHistory] = declareFrame(desc);
+        EXPECT_FALSE(graph.HasValidHistory(first));
+        EXPECT_EQ(device.TextureCreationCount, 2u);
+        EXPECT_EQ(graph.GetTextureDesc(first).InitialState, RHI::ResourceState::Undefined);
+        MockCommandList firstList;
+        graph.Execute(&firstList, &context);
+        previousCurrent = graph.GetResourceNode(first).ExternalTexture;
+
+        // Last frame's target becomes the history and both keep the states they were left in.
+        auto [second, secondHistory] = declareFrame(desc);
+        EXPECT_TRUE(graph.HasValidHistory(second));
+        EXPECT_EQ(graph.GetResourceNode(secondHistory).ExternalTexture, previousCurrent);
+        EXPECT_NE(graph.GetResourceNode(second).ExternalTexture, previousCurrent);
+        EXPECT_EQ(graph.GetTextureDesc(secondHistory).InitialState, RHI::ResourceState::RenderTarget);
+        MockCommandList secondList;
+        graph.Execute(&secondList, &context);
+
+        auto [third, thirdHistory] = declareFrame(desc);
+        EXPECT_EQ(graph.GetTextureDesc(third).InitialState, RHI::ResourceState::ShaderResource);
+        EXPECT_EQ(graph.GetTextureDesc(thirdHistory).InitialState, RHI::ResourceState::RenderTarget);
+        EXPECT_EQ(device.TextureCreationCount, 2u);
+
+        // A resize recreates both versions and drops the history.
+        desc.Width = 128;
+        auto [resized, resizedHistory] = declareFrame(desc);
+        EXPECT_FALSE(graph.HasValidHistory(resized));
+        EXPECT_EQ(device.TextureCreationCount, 4u);
+        EXPECT_EQ(graph.GetTextureDesc(resizedHistory).Width, 128u);
+        EXPECT_EQ(graph.GetTextureDesc(resized).InitialState, RHI::ResourceState::Undefined);
+
+        EXPECT_THROW(graph.GetHistory(resizedHistory), std::invalid_argument);
+    }
+
+    TEST(RenderGraphTests, TracksImportedResourceStatesAcrossExecutions)
+    {
+        struct DrawData {};
+
+        ParallelRecordingContext context;
+        RHI::TextureDesc desc;
+        desc.Width = 64;
+        desc.Height = 64;
+        MockTexture output(desc);
+        RenderGraph graph(context.GetDevice());
+        graph.SetParallelRecording(false);
+
+        auto declareFrame = [&](const RGImportInfo& info)
+        {
+            graph.Clear();
+            const RGResourceHandle imported = graph.ImportResource("Output", &output, info);
+            graph.AddPass<DrawData>("Draw",
+                [&](RenderGraphBuilder& builder, DrawData&) { builder.Write(imported); },
+                [](const RenderGraphRegistry&, const DrawData&, RHI::ICommandList*) {});
+            graph.Compile();
+            return imported;
+        };
+
+        // The requested final state is reached by one more barrier after the last pass.
+        const RGResourceHandle first = declareFrame({ .FinalState = RHI::ResourceState::ShaderResource });
+        EXPECT_EQ(graph.GetTextureDesc(first).InitialState, RHI::ResourceState::Undefined);
+        MockCommandList firstList;
+        graph.Execute(&firstList, &context);
+        EXPECT_EQ(firstList.Commands, (Vector<std::string>{ "Barrier", "BeginRendering", "EndRendering", "Barrier" }));
+        EXPECT_EQ(ResourceStateTracker::Get().GetState(&output), RHI::ResourceState::ShaderResource);
+
+        // The next execution starts where the last one left the texture.
+        const RGResourceHandle second = declareFrame({});
+        EXPECT_EQ(graph.GetTextureDesc(second).InitialState, RHI::ResourceState::ShaderResource);
+        MockCommandList secondList;
+        graph.Execute(&secondList, &context);
+        EXPECT_EQ(secondList.Commands.back(), "EndRendering");
+        EXPECT_EQ(ResourceStateTracker::Get().GetState(&output), RHI::ResourceState::RenderTarget);
+
+        const RGResourceHandle discarded = declareFrame({ .DiscardContents = true });
+        EXPECT_EQ(graph.GetTextureDesc(discarded).InitialState, RHI::ResourceState::Undefined);
+
+        // A new resource at the address of a destroyed one starts out undefined.
+        std::optional<MockTexture> temporary(std::in_place, desc);
+        const RHI::ITexture* address = &*temporary;
+        ResourceStateTracker::Get().SetState(address, RHI::ResourceState::CopyDest);
+        EXPECT_EQ(ResourceStateTracker::Get().GetState(address), RHI::ResourceState::CopyDest);
+        temporary.reset();
+        temporary.emplace(desc);
+        ASSERT_EQ(&*temporary, address);
+        EXPECT_EQ(ResourceStateTracker::Get().GetState(address), RHI::ResourceState::Undefined);
+    }
+
+    TEST(RenderGraphTests, TransitionsIndividualMipsOfAMipChain)
+    {
+        struct MipData {};
+
+        ParallelRecordingContext context;
+        RHI::TextureDesc desc;
+        desc.Width = 64;
+        desc.Height = 64;
+        desc.MipLevels = 4;
+        MockTexture chain(desc);
+        RenderGraph graph(context.GetDevice());
+        graph.SetParallelRecording(false);
+        graph.SetSplitBarrierDistance(0);
+
+        const RGResourceHandle handle = graph.ImportResource("Bloom", &chain,
+            { .DiscardContents = true, .FinalState = RHI::ResourceState::ShaderResource });
+        graph.AddPass<MipData>("Mip0",
+            [&](RenderGraphBuilder& builder, MipData&) { builder.Write(handle.Mip(0)); },
+            [](const RenderGraphRegistry&, const MipData&, RHI::ICommandList*) {});
+        for (uint16_t mip = 1; mip < 4; ++mip)
+        {
+            graph.AddPass<MipData>("Downsample" + std::to_string(mip),
+                [&](RenderGraphBuilder& builder, MipData&)
+                {
+                    builder.Read(handle.Mip(mip - 1));
+                    builder.Write(handle.Mip(mip));
+                },
+                [](const RenderGraphRegistry&, const MipData&, RHI::ICommandList*) {});
+        }
+        graph.Compile();
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+
+        // Every downsample reads the previous mip and writes the next one in a single batch,
+        // and only the last mip is left to reach the final state.
+        EXPECT_EQ(primary.BarrierBatches, (Vector<size_t>{ 1, 2, 2, 2, 1 }));
+        const auto mip = [](uint32_t level) { return RHI::TextureSubresourceRange{ level, 1 }; };
+        EXPECT_EQ(primary.TextureBarrierRanges, (Vector<RHI::TextureSubresourceRange>{
+            mip(0), mip(0), mip(1), mip(1), mip(2), mip(2), mip(3), mip(3) }));
+        EXPECT_EQ(primary.AttachmentMips, (Vector<uint32_t>{ 0, 1, 2, 3 }));
+        EXPECT_EQ(primary.RenderAreas, (Vector<std::pair<uint32_t, uint32_t>>{ { 64, 64 }, { 32, 32 }, { 16, 16 }, { 8, 8 } }));
+        EXPECT_EQ(ResourceStateTracker::Get().GetState(&chain), RHI::ResourceState::ShaderResource);
+    }
+
+    TEST(RenderGraphTests, MergesLayerTransitionsIntoMinimalRanges)
+    {
+        struct ShadowData {};
+
+        ParallelRecordingContext context;
+        RHI::TextureDesc cascadeDesc;
+        cascadeDesc.Width = 64;
+        cascadeDesc.Height = 64;
+        cascadeDesc.PixelFormat = RHI::Format::D32_FLOAT;
+        cascadeDesc.ArrayLayers = 4;
+        MockTexture cascades(cascadeDesc);
+        RHI::TextureDesc outputDesc;
+        outputDesc.Width = 64;
+        outputDesc.Height = 64;
+        MockTexture output(outputDesc);
+        RenderGraph graph(context.GetDevice());
+        graph.SetParallelRecording(false);
+        graph.SetSplitBarrierDistance(0);
+
+        const RGResourceHandle shadows = graph.ImportResource("Cascades", &cascades, { .DiscardContents = true });
+        const RGResourceHandle target = graph.ImportResource("Output", &output, { .DiscardContents = true });
+        for (uint16_t layer = 0; layer < 4; ++layer)
+        {
+            graph.AddPass<ShadowData>("Cascade" + std::to_string(layer),
+                [&](RenderGraphBuilder& builder, ShadowData&) { builder.Write(shadows.Layer(layer)); },
+                [](const RenderGraphRegistry&, const ShadowData&, RHI::ICommandList*) {});
+        }
+        graph.AddPass<ShadowData>("Lighting",
+            [&](RenderGraphBuilder& builder, ShadowData&)
+            {
+                builder.Read(shadows);
+                builder.Write(target);
+            },
+            [](const RenderGraphRegistry&, const ShadowData&, RHI::ICommandList*) {});
+        graph.Compile();
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+
+        // The four cascades reach the same state and are read by a single whole-texture barrier.
+        const auto layer = [](uint32_t index) { return RHI::TextureSubresourceRange{ 0, RHI::TextureSubresourceRange::Remaining, index, 1 }; };
+        EXPECT_EQ(primary.TextureBarrierRanges, (Vector<RHI::TextureSubresourceRange>{
+            layer(0), layer(1), layer(2), layer(3), RHI::TextureSubresourceRange{}, RHI::TextureSubresourceRange{} }));
+        EXPECT_EQ(ResourceStateTracker::Get().GetState(&cascades), RHI::ResourceState::ShaderResource);
+
+        // A frame that only redraws the first cascade would leave the layers in mixed states,
+        // so the other three follow it into the state of the latest access in one barrier.
+        graph.Clear();
+        const RGResourceHandle redrawn = graph.ImportResource("Cascades", &cascades);
+        graph.AddPass<ShadowData>("Cascade0",
+            [&](RenderGraphBuilder& builder, ShadowData&) { builder.Write(redrawn.Layer(0)); },
+            [](const RenderGraphRegistry&, const ShadowData&, RHI::ICommandList*) {});
+        graph.Compile();
+        MockCommandList partial;
+        graph.Execute(&partial, &context);
+        EXPECT_EQ(partial.TextureBarrierRanges, (Vector<RHI::TextureSubresourceRange>{
+            layer(0), RHI::TextureSubresourceRange{ 0, RHI::TextureSubresourceRange::Remaining, 1, 3 } }));
+        EXPECT_EQ(ResourceStateTracker::Get().GetState(&cascades), RHI::ResourceState::DepthStencilWrite);
+    }
+
+    TEST(RenderGraphTests, KeepsPartialWritersOfTransientTextures)
+    {
+        struct PartialData {};
+
+        ParallelRecordingContext context;
+        RHI::TextureDesc outputDesc;
+        outputDesc.Width = 64;
+        outputDesc.Height = 64;
+        MockTexture output(outputDesc);
+        RenderGraph graph(context.GetDevice());
+        graph.SetParallelRecording(false);
+
+        Vector<std::string> executed;
+        const auto record = [&executed](std::string name)
+        {
+            return [&executed, name](const RenderGraphRegistry&, const PartialData&, RHI::ICommandList*) { executed.push_back(name); };
+        };
+
+        RHI::TextureDesc cascadeDesc;
+        cascadeDesc.Width = 64;
+        cascadeDesc.Height = 64;
+        cascadeDesc.PixelFormat = RHI::Format::D32_FLOAT;
+        cascadeDesc.ArrayLayers = 4;
+        RHI::TextureDesc chainDesc;
+        chainDesc.Width = 64;
+        chainDesc.Height = 64;
+        chainDesc.MipLevels = 3;
+
+        const RGResourceHandle target = graph.ImportResource("Output", &output, { .DiscardContents = true });
+        const RGResourceHandle cascades = graph.CreateResource("Cascades", cascadeDesc);
+        const RGResourceHandle chain = graph.CreateResource("Chain", chainDesc);
+        for (uint16_t layer = 0; layer < 4; ++layer)
+        {
+            graph.AddPass<PartialData>("Cascade" + std::to_string(layer),
+                [&](RenderGraphBuilder& builder, PartialData&) { builder.Write(cascades.Layer(layer)); },
+                record("Cascade" + std::to_string(layer)));
+        }
+        for (uint16_t mip = 0; mip < 3; ++mip)
+        {
+            graph.AddPass<PartialData>("Mip" + std::to_string(mip),
+                [&](RenderGraphBuilder& builder, PartialData&) { builder.Write(chain.Mip(mip)); },
+                record("Mip" + std::to_string(mip)));
+        }
+        graph.AddPass<PartialData>("Lighting",
+            [&](RenderGraphBuilder& builder, PartialData&)
+            {
+                builder.Read(cascades);
+                builder.Read(chain);
+                builder.Write(target);
+            },
+            record("Lighting"));
+        graph.Compile();
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+
+        // Each writer fills a different layer or mip of what Lighting reads, so none may be culled.
+        EXPECT_EQ(executed, (Vector<std::string>{ "Cascade0", "Cascade1", "Cascade2", "Cascade3", "Mip0", "Mip1", "Mip2", "Lighting" }));
+    }
+
+    TEST(RenderGraphTests, ValidatesSubresourceRanges)
+    {
+        struct RangeData {};
+
+        ParallelRecordingContext context;
+        RenderGraph graph(context.GetDevice());
+        RHI::TextureDesc desc;
+        desc.Width = 64;
+        desc.Height = 64;
+        desc.MipLevels = 4;
+        const RGResourceHandle texture = graph.CreateResource("Chain", desc);
+        RHI::BufferDesc bufferDesc;
+        bufferDesc.Size = 256;
+        const RGResourceHandle buffer = graph.CreateResource("Buffer", bufferDesc);
+
+        // Ranges spanning every mip are stored like a whole-texture handle.
+        EXPECT_TRUE(graph.ResolveSubresources(texture.Mips(0, 4)).IsWholeResource());
+        EXPECT_TRUE(graph.ResolveSubresources(texture.Mips(2, 2)).HasSameSubresources(texture.Mips(2, 2)));
+        EXPECT_TRUE(texture.Mips(1, 2).Overlaps(texture.Mip(2)));
+        EXPECT_FALSE(texture.Mip(1).Overlaps(texture.Mip(2)));
+
+        EXPECT_THROW(graph.ResolveSubresources(texture.Mip(4)), std::out_of_range);
+        EXPECT_THROW(graph.ResolveSubresources(texture.Mips(3, 2)), std::out_of_range);
+        EXPECT_THROW(graph.ResolveSubresources(texture.Layer(1)), std::out_of_range);
+        EXPECT_THROW(graph.ResolveSubresources(buffer.Mip(0)), std::invalid_argument);
+
+        // An attachment is a single image.
+        EXPECT_THROW(graph.AddPass<RangeData>("Whole",
+            [&](RenderGraphBuilder& builder, RangeData&) { builder.Write(texture); },
+            [](const RenderGraphRegistry&, const RangeData&, RHI::ICommandList*) {}), std::invalid_argument);
+    }
+
+    TEST(RenderGraphTests, SuballocatesTransientBuffersFromTheFrameSlotBuffer)
+    {
+        struct BufferData
+        {
+            RGResourceHandle Target;
+        };
+
+        ParallelRecordingContext context;
+        auto& device = static_cast<MockGraphicsDevice&>(context.GetDevice());
+        RHI::BufferDesc outputDesc;
+        outputDesc.Size = 256;
+        MockBuffer output(outputDesc);
+        RenderGraph graph(device);
+        graph.SetParallelRecording(false);
+
+        Vector<std::pair<RHI::IBuffer*, RHI::BufferRange>> bound;
+        auto bind = [&bound](const RenderGraphRegistry& registry, const BufferData& data, RHI::ICommandList*)
+        {
+            bound.emplace_back(registry.GetBuffer(data.Target), registry.GetBufferRange(data.Target));
+        };
+        auto executeFrame = [&](uint64_t particleBytes)
+        {
+            bound.clear();
+            graph.Clear();
+            const auto particles = graph.CreateResource("Particles", RHI::BufferDesc{ particleBytes, RHI::BufferUsage::Storage });
+            const auto lights = graph.CreateResource("Lights", RHI::BufferDesc{ 300, RHI::BufferUsage::Storage });
+            const auto imported = graph.ImportResource("Output", &output);
+            graph.AddPass<BufferData>("Simulate",
+                [&](RenderGraphBuilder& builder, BufferData& data) { data.Target = builder.Write(particles); }, bind);
+            graph.AddPass<BufferData>("CullLights",
+                [&](RenderGraphBuilder& builder, BufferData& data) { data.Target = builder.Write(lights); }, bind);
+            graph.AddPass<BufferData>("Shade",
+                [&](RenderGraphBuilder& builder, BufferData& data)
+                {
+                    builder.Read(particles);
+                    builder.Read(lights);
+                    data.Target = builder.Write(imported);
+                }, bind);
+            graph.Compile();
+
+            MockCommandList primary;
+            graph.Execute(&primary, &context);
+            return primary.BufferBarrierRanges;
+        };
+
+        // Both transients share one buffer at aligned offsets; the import keeps its own buffer.
+        const auto barrierRanges = executeFrame(100);
+        ASSERT_EQ(bound.size(), 3u);
+        EXPECT_EQ(device.BufferCreationCount, 1u);
+        EXPECT_EQ(bound[0].first, bound[1].first);
+        EXPECT_EQ(bound[0].second, (RHI::BufferRange{ 0, 100 }));
+        EXPECT_EQ(bound[1].second, (RHI::BufferRange{ RenderGraphResourceCache::TransientBufferAlignment, 300 }));
+        EXPECT_EQ(bound[2].first, &output);
+        EXPECT_TRUE(bound[2].second.IsWhole());
+        EXPECT_NE(std::find(barrierRanges.begin(), barrierRanges.end(), bound[0].second), barrierRanges.end());
+        EXPECT_NE(std::find(barrierRanges.begin(), barrierRanges.end(), bound[1].second), barrierRanges.end());
+
+        // A size change only moves the ranges, until the frame no longer fits.
+        executeFrame(101);
+        EXPECT_EQ(device.BufferCreationCount, 1u);
+        EXPECT_EQ(bound[0].second, (RHI::BufferRange{ 0, 101 }));
+        executeFrame(RenderGraphResourceCache::MinimumLinearBufferSize);
+        EXPECT_EQ(device.BufferCreationCount, 2u);
+        EXPECT_EQ(bound[0].first->GetSize(), 2 * RenderGraphResourceCache::MinimumLinearBufferSize);
+    }
+
+    TEST(RenderGraphTests, RendersToTheRequestedExtentOfSizeClassTextures)
+    {
+        struct TargetData
+        {
+            RGResourceHandle Target;
+        };
+
+        ParallelRecordingContext context;
+        RenderGraph graph(context.GetDevice());
+        graph.SetParallelRecording(false);
+        graph.SetTransientPoolPolicy({ .UseSizeClasses = true });
+
+        RHI::TextureDesc desc;
+        desc.Width = 1000;
+        desc.Height = 700;
+        desc.Usage = RHI::TextureUsage::ColorAttachment | RHI::TextureUsage::Sampled;
+        const RGResourceHandle target = graph.CreateResource("Target", desc);
+        RHI::ITexture* physical = nullptr;
+        graph.AddPass<TargetData>("Draw",
+            [&](RenderGraphBuilder& builder, TargetData& data) { data.Target = builder.Write(target); },
+            [](const RenderGraphRegistry&, const TargetData&, RHI::ICommandList*) {});
+        graph.AddPass<TargetData>("Present",
+            [&](RenderGraphBuilder& builder, TargetData& data)
+            {
+                data.Target = builder.Read(target);
+                builder.SetSideEffect();
+            },
+            [&physical](const RenderGraphRegistry& registry, const TargetData& data, RHI::ICommandList*)
+            {
+                physical = registry.GetTexture(data.Target);
+            });
+        graph.Compile();
+
+        MockCommandList primary;
+        graph.Execute(&primary, &context);
+
+        ASSERT_NE(physical, nullptr);
+        EXPECT_EQ(physical->GetWidth(), 1024u);
+        EXPECT_EQ(physical->GetHeight(), 768u);
+        EXPECT_EQ(graph.GetTextureDesc(target).Width, 1000u);
+        EXPECT_EQ(primary.RenderAreas, (Vector<std::pair<uint32_t, uint32_t>>{ { 1000, 700 } }));
+    }
+
+    TEST(RenderGraphTests, KeepsScaledResourcesAllocatedWhileTheRenderScaleChanges)
+    {
+        struct TargetData
+        {
+            RGResourceHandle Target;
+        };
+
+        ParallelRecordingContext context;
+        auto& device = static_cast<MockGraphicsDevice&>(context.GetDevice());
+        RenderGraph graph(device);
+        graph.SetParallelRecording(false);
+
+        RHI::TextureDesc desc;
+        desc.Usage = RHI::TextureUsage::ColorAttachment | RHI::TextureUsage::Sampled;
+        RHI::ITexture* physical = nullptr;
+        const auto renderAtScale = [&](float scale)
+        {
+            graph.Clear();
+            graph.SetViewport({ 1000, 800, scale });
+            const RGResourceHandle target = graph.CreateScaledResource("Scene", desc);
+            graph.AddPass<TargetData>("Draw",
+                [&](RenderGraphBuilder& builder, TargetData& data) { data.Target = builder.Write(target); },
+                [](const RenderGraphRegistry&, const TargetData&, RHI::ICommandList*) {});
+            graph.AddPass<TargetData>("Upscale",
+                [&](RenderGraphBuilder& builder, TargetData& data)
+                {
+                    data.Target = builder.Read(target);
+                    builder.SetSideEffect();
+                },
+                [&physical](const RenderGraphRegistry& registry, const TargetData& data, RHI::ICommandList*)
+                {
+                    physical = registry.GetTexture(data.Target);
+                });
+            graph.Compile();
+
+            MockCommandList primary;
+            graph.Execute(&primary, &context);
+            return primary.RenderAreas;
+        };
+
+        using RenderAreas = Vector<std::pair<uint32_t, uint32_t>>;
+        EXPECT_EQ(renderAtScale(0.5f), (RenderAreas{ { 500, 400 } }));
+        ASSERT_NE(physical, nullptr);
+        EXPECT_EQ(physical->GetWidth(), 1000u);
+        EXPECT_EQ(physical->GetHeight(), 800u);
+        RHI::ITexture* const first = physical;
+
+        EXPECT_EQ(renderAtScale(0.75f), (RenderAreas{ { 750, 600 } }));
+        EXPECT_EQ(physical, first);
+        EXPECT_EQ(device.TextureCreationCount, 1u);
+        EXPECT_EQ(graph.GetCompileStatistics().CacheHits, 1u);
+
+        // A new output extent is a new allocation.
+        graph.Clear();
+        graph.SetViewport({ 1280, 720, 0.75f });
+        EXPECT_EQ(graph.GetTextureDesc(graph.CreateScaledResource("Scene", desc, 0.5f)).Width, 480u);
+        EXPECT_EQ(graph.GetResourceNode(graph.GetResource("Scene"_rg)).AllocationWidth, 640u);
+    }
+
+    TEST(RenderGraphTests, RejectsScaledResourcesWithoutAViewport)
+    {
+        MockGraphicsDevice device;
+        RenderGraph graph(device);
+        EXPECT_THROW(graph.CreateScaledResource("Scene", RHI::TextureDesc{}), std::logic_error);
+
+        graph.SetViewport({ 1000, 800, 1.0f });
+        EXPECT_THROW(graph.CreateScaledResource("Scene", RHI::TextureDesc{}, 0.0f), std::invalid_argument);
+        EXPECT_THROW(graph.SetViewport({ 1000, 800, 0.0f }), std::invalid_argument);
+    }
+
+    TEST(DynamicResolutionTests, LowersTheScaleUntilTheFrameFitsTheBudget)
+    {
+        DynamicResolution controller;
+        EXPECT_FLOAT_EQ(controller.GetScale(), 1.0f);
+
+        // Missing timestamps leave the scale alone.
+        EXPECT_FALSE(controller.Update(-1.0f));
+
+        // 25 ms wants sqrt(16 / 25) = 0.8 but steps are limited to 0.1.
+        EXPECT_TRUE(controller.Update(25.0f));
+        EXPECT_FLOAT_EQ(controller.GetScale(), 0.9f);
+
+        // Frames rendered before the change are not measured.
+        const uint32_t settleFrames = controller.GetSettings().SettleFrames;
+        for (uint32_t frame = 0; frame < settleFrames; ++frame) EXPECT_FALSE(controller.Update(25.0f));
+
+        EXPECT_TRUE(controller.Update(20.0f));
+        EXPECT_FLOAT_EQ(controller.GetScale(), 0.8f);
+
+        // Within the tolerance of the target the scale holds.
+        for (uint32_t frame = 0; frame < settleFrames; ++frame) controller.Update(16.0f);
+        for (uint32_t frame = 0; frame < 10; ++frame) EXPECT_FALSE(controller.Update(16.3f));
+        EXPECT_FLOAT_EQ(controller.GetScale(), 0.8f);
+    }
+
+    TEST(DynamicResolutionTests, RaisesTheScaleWithHeadroomWithinItsRange)
+    {
+        DynamicResolution controller({ .MinScale = 0.5f, .MaxScale = 1.0f, .SettleFrames = 0 });
+
+        for (uint32_t frame = 0; frame < 20; ++frame) controller.Update(100.0f);
+        EXPECT_FLOAT_EQ(controller.GetScale(), 0.5f);
+
+        // 8 ms at 0.5 means about 16 ms at 0.7, so once the average drops the scale climbs without overshooting.
+        for (uint32_t frame = 0; frame < 60; ++frame) controller.Update(8.0f * controller.GetScale() * controller.GetScale() / 0.25f);
+        EXPECT_GE(controller.GetScale(), 0.65f);
+        EXPECT_LE(controller.GetScale(), 0.7f + 1e-4f);
+
+        for (uint32_t frame = 0; frame < 60; ++frame) controller.Update(1.0f);
+        EXPECT_FLOAT_EQ(controller.GetScale(), 1.0f);
+
+        EXPECT_THROW(controller.SetSettings({ .MinScale = 0.8f, .MaxScale = 0.5f }), std::invalid_argument);
+    }
+
+    TEST(RenderGraphTests, TimesPassesOnceTheirFrameSlotComesAround)
+    {
+        TimestampContext context;
+        context.QueryCount = 8;
+        context.Ticks = { { 100, 2100, 2100, 5100 }, {} };
+        RHI::BufferDesc outputDesc;
+        outputDesc.Size = 256;
+        MockBuffer output(outputDesc);
+        RenderGraph graph(context.GetDevice());
+        graph.SetParallelRecording(false);
+
+        auto executeFrame = [&](uint32_t frameIndex)
+        {
+            context.FrameIndex = frameIndex;
+            graph.Clear();
+            DeclareWideFanIn(graph, output);
+            graph.Compile();
+
+            MockCommandList primary;
+            graph.Execute(&primary, &context);
+            return primary.Timestamps;
+        };
+
+        // Every pass gets a query pair, but results wait until the slot is reused.
+        EXPECT_EQ(executeFrame(0), (Vector<uint32_t>{ 0, 1, 2, 3, 4, 5, 6, 7 }));
+        EXPECT_TRUE(graph.GetPassTimings().empty());
+        executeFrame(1);
+        EXPECT_TRUE(graph.GetPassTimings().empty());
+
+        // Slot 0 only had enough seeded ticks for a partial read, so the GPU times are unavailable.
+        executeFrame(0);
+        ASSERT_EQ(graph.GetPassTimings().size(), 4u);
+        EXPECT_EQ(graph.GetPassTimings()[3].Name, "Consume");
+        EXPECT_LT(graph.GetPassTimings()[0].GpuTimeMs, 0.0f);
+
+        context.Ticks[1] = { 100, 2100, 2100, 5100, 5100, 6100, 6100, 7100 };
+        executeFrame(1);
+        const auto& timings = graph.GetPassTimings();
+        ASSERT_EQ(timings.size(), 4u);
+        EXPECT_FLOAT_EQ(timings[0].GpuTimeMs, 2.0f);
+        EXPECT_FLOAT_EQ(timings[1].GpuTimeMs, 3.0f);
+        EXPECT_FLOAT_EQ(timings[3].GpuTimeMs, 1.0f);
+        EXPECT_GE(timings[3].CpuTimeMs, 0.0f);
+
+        const auto& stats = RenderStats::Get().GetStats();
+        ASSERT_EQ(stats.PassTimings.size(), 4u);
+        EXPECT_EQ(stats.PassTimings[3].Name, "Consume");
+        EXPECT_FLOAT_EQ(stats.GpuFrameTimeMs, 7.0f);
+
+        const auto path = std::filesystem::temp_directory_path() /
+            ("mixture-pass-timings-" + std::to_string(reinterpret_cast<uintptr_t>(&graph)) + ".json");
+        ASSERT_TRUE(graph.DumpDiagnostics(path));
+        std::ifstream input(path);
+        const std::string dump(std::istreambuf_iterator<char>(input), {});
+        EXPECT_NE(dump.find("\"timings\""), std::string::npos);
+        EXPECT_NE(dump.find("\"gpuMs\": 3"), std::string::npos);
+        input.close();
+        std::filesystem::remove(path);
+
+        // Without a query pair for every pass, only CPU scopes are recorded.
+        context.QueryCount = 4;
+        EXPECT_TRUE(executeFrame(0).empty());
+    }
+
     TEST(RenderGraphTests, RejectsInvalidHandlesAndHandleOverflow)
     {
         MockGraphicsDevice device;
@@ -600,6 +2057,143 @@ namespace Mixture::Tests
         EXPECT_TRUE(retired.expired());
     }
 
+    TEST(RenderGraphResourceCacheTests, AliasesTransientsWithDisjointLifetimes)
+    {
+        MockGraphicsDevice device;
+        device.SupportsAliasing = true;
+        RenderGraphResourceCache cache(device);
+
+        // GBuffer dies before Bloom is born; Lighting overlaps both.
+        Vector<RGResourceNode> resources;
+        resources.push_back(MakeTransient(0, "GBuffer", 0, 1));
+        resources.push_back(MakeTransient(1, "Lighting", 1, 2));
+        resources.push_back(MakeTransient(2, "Bloom", 2, 3));
+
+        cache.BeginFrame(0);
+        const auto& transients = cache.AcquireTransients(resources);
+
+        ASSERT_EQ(transients.size(), 3u);
+        for (const auto& transient : transients) EXPECT_NE(transient.Texture, nullptr);
+        EXPECT_EQ(device.HeapCreationCount, 1u);
+        EXPECT_EQ(device.TextureCreationCount, 0u);
+        EXPECT_EQ(device.PlacedOffsets["GBuffer"], device.PlacedOffsets["Bloom"]);
+        EXPECT_NE(device.PlacedOffsets["GBuffer"], device.PlacedOffsets["Lighting"]);
+
+        const uint64_t textureBytes = 64 * 64 * 4;
+        const auto& stats = cache.GetStatistics();
+        EXPECT_EQ(stats.AliasedResources, 3u);
+        EXPECT_EQ(stats.RequestedBytes, 3 * textureBytes);
+        EXPECT_EQ(stats.HeapBytes, 2 * textureBytes);
+        EXPECT_EQ(stats.BytesSavedByAliasing, textureBytes);
+    }
+
+    TEST(RenderGraphResourceCacheTests, ReusesAliasedPlacementUntilLifetimesChange)
+    {
+        MockGraphicsDevice device;
+        device.SupportsAliasing = true;
+        RenderGraphResourceCache cache(device);
+
+        Vector<RGResourceNode> resources;
+        resources.push_back(MakeTransient(0, "First", 0, 0));
+        resources.push_back(MakeTransient(1, "Second", 1, 1));
+
+        cache.BeginFrame(0);
+        RHI::ITexture* first = cache.AcquireTransients(resources)[0].Texture.get();
+        cache.BeginFrame(0);
+        EXPECT_EQ(cache.AcquireTransients(resources)[0].Texture.get(), first);
+        EXPECT_EQ(device.HeapCreationCount, 1u);
+        EXPECT_EQ(device.PlacedCreationCount, 2u);
+
+        resources[1].FirstPassIndex = 0;
+        cache.BeginFrame(0);
+        cache.AcquireTransients(resources);
+        EXPECT_EQ(device.HeapCreationCount, 2u);
+        EXPECT_EQ(cache.GetStatistics().BytesSavedByAliasing, 0u);
+    }
+
+    TEST(RenderGraphResourceCacheTests, FallsBackToPoolingWithoutDeviceAliasing)
+    {
+        MockGraphicsDevice device;
+        RenderGraphResourceCache cache(device);
+
+        Vector<RGResourceNode> resources;
+        resources.push_back(MakeTransient(0, "First", 0, 0));
+        resources.push_back(MakeTransient(1, "Second", 1, 1));
+        resources.push_back(MakeTransient(2, "Culled", -1, -1));
+
+        cache.BeginFrame(0);
+        const auto& transients = cache.AcquireTransients(resources);
+
+        EXPECT_NE(transients[0].Texture, nullptr);
+        EXPECT_NE(transients[1].Texture, nullptr);
+        EXPECT_EQ(transients[2].Texture, nullptr);
+        EXPECT_EQ(device.TextureCreationCount, 2u);
+        EXPECT_EQ(cache.GetStatistics().BytesSavedByAliasing, 0u);
+    }
+
+    TEST(RenderGraphResourceCacheTests, ReusesSizeClassesWhileTheResolutionChanges)
+    {
+        MockGraphicsDevice device;
+        RenderGraphResourceCache cache(device);
+        cache.SetPolicy({ .UseSizeClasses = true });
+
+        Vector<RGResourceNode> resources;
+        resources.push_back(MakeTransient(0, "Scene", 0, 0));
+        const auto acquireAtSize = [&](uint32_t width, uint32_t height)
+        {
+            resources[0].TextureDesc.Width = width;
+            resources[0].TextureDesc.Height = height;
+            cache.BeginFrame(0);
+            return cache.AcquireTransients(resources)[0].Texture;
+        };
+
+        // A window drag within one size class keeps hitting the first allocation.
+        const auto first = acquireAtSize(1000, 700);
+        EXPECT_EQ(first->GetWidth(), 1024u);
+        EXPECT_EQ(first->GetHeight(), 768u);
+        EXPECT_EQ(cache.GetStatistics().PoolMisses, 1u);
+        EXPECT_EQ(acquireAtSize(1010, 720), first);
+        EXPECT_EQ(acquireAtSize(1024, 768), first);
+        EXPECT_EQ(cache.GetStatistics().PoolHits, 1u);
+        EXPECT_EQ(device.TextureCreationCount, 1u);
+
+        EXPECT_NE(acquireAtSize(1025, 768), first);
+        EXPECT_EQ(device.TextureCreationCount, 2u);
+    }
+
+    TEST(RenderGraphResourceCacheTests, EvictsIdleEntriesLeastRecentlyUsedFirstOverBudget)
+    {
+        MockGraphicsDevice device;
+        RenderGraphResourceCache cache(device);
+        cache.SetPolicy({ .BudgetBytes = 41000 });
+
+        Vector<RGResourceNode> resources;
+        resources.push_back(MakeTransient(0, "Target", 0, 0));
+        const auto acquire = [&](uint32_t frameIndex, uint32_t width, uint32_t height)
+        {
+            resources[0].TextureDesc.Width = width;
+            resources[0].TextureDesc.Height = height;
+            cache.BeginFrame(frameIndex);
+            return std::weak_ptr<RHI::ITexture>(cache.AcquireTransients(resources)[0].Texture);
+        };
+
+        // Two frame slots, each keeping its previous entry idle for one more use.
+        const auto oldest = acquire(0, 64, 64);  // 16 KiB
+        const auto older = acquire(1, 32, 32);   // 4 KiB
+        const auto newer = acquire(0, 32, 32);   // 4 KiB, the 64x64 entry is idle now
+        EXPECT_EQ(cache.GetStatistics().PooledBytes, 24576u);
+        EXPECT_EQ(cache.GetStatistics().PoolEvictions, 0u);
+
+        // 32 KiB more exceeds the budget; evicting the least recently used idle entry suffices.
+        const auto current = acquire(1, 128, 64);
+        EXPECT_EQ(cache.GetStatistics().PoolEvictions, 1u);
+        EXPECT_EQ(cache.GetStatistics().PooledBytes, 40960u);
+        EXPECT_TRUE(oldest.expired());
+        EXPECT_FALSE(older.expired());
+        EXPECT_FALSE(newer.expired());
+        EXPECT_FALSE(current.expired());
+    }
+
     TEST(RenderGraphRegistryTests, ReleasesTransientMappingsAtTheEndOfTheirLifetime)
     {
         RenderGraphRegistry registry;
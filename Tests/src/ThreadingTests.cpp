@@ -1,11 +1,117 @@
 #include <gtest/gtest.h>
 #include "Mixture/Core/Threading/TaskSystem.hpp"
+#include "AllocationCounter.hpp"
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <thread>
 #include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <vector>
 
 namespace Mixture::Tests {
 
+    namespace
+    {
+        /** @brief The former TaskSystem design (one mutex-guarded queue shared by every worker), kept as a benchmark baseline. */
+        class SingleQueueThreadPool
+        {
+        public:
+            explicit SingleQueueThreadPool(uint32_t threadCount)
+            {
+                for (uint32_t i = 0; i < threadCount; ++i)
+                {
+                    m_Threads.emplace_back([this]()
+                    {
+                        while (true)
+                        {
+                            std::function<void()> task;
+                            {
+                                std::unique_lock<std::mutex> lock(m_Mutex);
+                                m_Condition.wait(lock, [this] { return !m_Queue.empty() || !m_Running; });
+                                if (!m_Running && m_Queue.empty()) return;
+                                task = std::move(m_Queue.front());
+                                m_Queue.pop();
+                            }
+                            task();
+                        }
+                    });
+                }
+            }
+
+            ~SingleQueueThreadPool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    m_Running = false;
+                }
+                m_Condition.notify_all();
+                for (auto& thread : m_Threads) thread.join();
+            }
+
+            void Submit(std::function<void()> task)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    m_Queue.push(std::move(task));
+                }
+                m_Condition.notify_one();
+            }
+
+        private:
+            std::queue<std::function<void()>> m_Queue;
+            std::mutex m_Mutex;
+            std::condition_variable m_Condition;
+            bool m_Running = true;
+            std::vector<std::thread> m_Threads;
+        };
+
+        /**
+         * @brief Fan-out workload: a handful of root tasks that each spawn many small children,
+         * which is the submission pattern per-worker deques are meant to speed up.
+         */
+        template<typename SubmitFn>
+        double RunFanOutWorkload(SubmitFn submit, int roots, int childrenPerRoot)
+        {
+            // Shared by value so the task that finishes last can still touch it after the wait returns.
+            struct FanOutState
+            {
+                std::atomic<int> Remaining = 0;
+                std::atomic<uint64_t> Sink = 0;
+                std::promise<void> Done;
+            };
+            const auto state = std::make_shared<FanOutState>();
+            // Roots count too, so no root is still running its loop once the wait returns.
+            state->Remaining = roots * (childrenPerRoot + 1);
+            std::future<void> finished = state->Done.get_future();
+
+            const auto start = std::chrono::steady_clock::now();
+            for (int root = 0; root < roots; ++root)
+            {
+                submit([submit, state, root, childrenPerRoot]()
+                {
+                    for (int child = 0; child < childrenPerRoot; ++child)
+                    {
+                        submit([state, root, child]()
+                        {
+                            state->Sink.fetch_add(static_cast<uint64_t>(root ^ child), std::memory_order_relaxed);
+                            if (state->Remaining.fetch_sub(1) == 1) state->Done.set_value();
+                        });
+                    }
+                    if (state->Remaining.fetch_sub(1) == 1) state->Done.set_value();
+                });
+            }
+            finished.wait();
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+
     class TaskSystemTests : public ::testing::Test
     {
     protected:
@@ -143,4 +249,258 @@ namespace Mixture::Tests {
         EXPECT_THROW(TaskSystem::SubmitFuture([]() { return 42; }), std::runtime_error);
     }
 
+    TEST_F(TaskSystemTests, StatisticsTrackNestedSubmissions)
+    {
+        constexpr int children = 64;
+        std::atomic<int> completed = 0;
+
+        auto root = TaskSystem::SubmitFuture([&completed]() {
+            for (int i = 0; i < children; ++i)
+                TaskSystem::Submit([&completed]() { ++completed; });
+        });
+        root.get();
+
+        int timeout = 500;
+        while (completed < children && timeout-- > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ASSERT_EQ(completed, children);
+
+        TaskSystem::Statistics stats = TaskSystem::GetStatistics();
+        timeout = 500;
+        while (stats.TasksExecuted < stats.TasksSubmitted && timeout-- > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            stats = TaskSystem::GetStatistics();
+        }
+
+        EXPECT_EQ(stats.WorkerCount, 2u);
+        EXPECT_EQ(stats.TasksSubmitted, static_cast<uint64_t>(children + 1));
+        EXPECT_EQ(stats.TasksExecuted, stats.TasksSubmitted);
+        EXPECT_EQ(stats.LocalSubmissions, static_cast<uint64_t>(children));
+        EXPECT_LE(stats.Steals, stats.TasksExecuted);
+        ASSERT_EQ(stats.QueueDepths.size(), 2u);
+        EXPECT_EQ(std::accumulate(stats.QueueDepths.begin(), stats.QueueDepths.end(), size_t(0)), 0u);
+    }
+
+    TEST_F(TaskSystemTests, FanOutBenchmarkAgainstSingleQueue)
+    {
+        constexpr int roots = 8;
+        constexpr int childrenPerRoot = 4096;
+        const uint32_t threads = std::max(2u, std::thread::hardware_concurrency());
+
+        TaskSystem::Shutdown();
+        TaskSystem::Init(threads);
+
+        double singleQueueMs = 0.0;
+        {
+            SingleQueueThreadPool pool(threads);
+            singleQueueMs = RunFanOutWorkload([&pool](std::function<void()> task) { pool.Submit(std::move(task)); },
+                roots, childrenPerRoot);
+        }
+
+        const double workStealingMs = RunFanOutWorkload([](std::function<void()> task) { TaskSystem::Submit(std::move(task)); },
+            roots, childrenPerRoot);
+
+        const TaskSystem::Statistics stats = TaskSystem::GetStatistics();
+        RecordProperty("Tasks", std::to_string(roots * childrenPerRoot));
+        RecordProperty("Threads", std::to_string(threads));
+        RecordProperty("SingleQueueMs", std::to_string(singleQueueMs));
+        RecordProperty("WorkStealingMs", std::to_string(workStealingMs));
+        RecordProperty("Steals", std::to_string(stats.Steals));
+        RecordProperty("IdleMs", std::to_string(stats.IdleNanoseconds / 1000000));
+
+        // The timings are reported only; wall-clock comparisons are too noisy to gate a test run.
+        EXPECT_GE(stats.LocalSubmissions, static_cast<uint64_t>(roots * childrenPerRoot));
+    }
+
+    TEST_F(TaskSystemTests, ScheduledJobRunsAfterAllDependencies)
+    {
+        std::atomic<int> finishedParents = 0;
+        std::atomic<int> parentsSeenByChild = -1;
+
+        TaskHandle a = TaskSystem::Schedule([&finishedParents]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            ++finishedParents;
+        });
+        TaskHandle b = TaskSystem::Schedule([&finishedParents]() { ++finishedParents; });
+        TaskHandle c = TaskSystem::Schedule([&]() { parentsSeenByChild = finishedParents.load(); }, { a, b });
+
+        TaskSystem::WaitAndHelp(c);
+
+        EXPECT_TRUE(a.IsFinished());
+        EXPECT_TRUE(b.IsFinished());
+        EXPECT_TRUE(c.IsFinished());
+        EXPECT_EQ(parentsSeenByChild, 2);
+    }
+
+    TEST_F(TaskSystemTests, ContinuationOfFinishedJobStillRuns)
+    {
+        TaskHandle first = TaskSystem::Schedule([]() {});
+        TaskSystem::WaitAndHelp(first);
+
+        std::atomic<bool> ran = false;
+        TaskHandle second = TaskSystem::Then(first, [&ran]() { ran = true; });
+        TaskSystem::WaitAndHelp(second);
+
+        EXPECT_TRUE(ran);
+        EXPECT_TRUE(TaskHandle().IsFinished());
+    }
+
+    TEST_F(TaskSystemTests, ParallelForCoversRangeExactlyOnce)
+    {
+        constexpr size_t count = 1000;
+        std::vector<std::atomic<int>> visits(count);
+
+        TaskHandle loop = TaskSystem::ParallelFor(count, 64, [&visits](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) ++visits[i];
+        });
+        TaskSystem::WaitAndHelp(loop);
+
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(visits[i], 1) << "index " << i;
+
+        TaskHandle empty = TaskSystem::ParallelFor(0, 16, [](size_t, size_t) { FAIL(); });
+        EXPECT_TRUE(empty.IsFinished());
+    }
+
+    TEST_F(TaskSystemTests, ParallelForWaitsForDependenciesAndFeedsContinuation)
+    {
+        std::atomic<bool> prepared = false;
+        std::atomic<bool> chunkSawUnprepared = false;
+        std::atomic<size_t> sum = 0;
+
+        TaskHandle prepare = TaskSystem::Schedule([&prepared]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            prepared = true;
+        });
+        TaskHandle loop = TaskSystem::ParallelFor(256, 16, [&](size_t begin, size_t end) {
+            if (!prepared) chunkSawUnprepared = true;
+            for (size_t i = begin; i < end; ++i) sum += i;
+        }, std::span<const TaskHandle>(&prepare, 1));
+
+        size_t observed = 0;
+        TaskHandle finish = TaskSystem::Then(loop, [&]() { observed = sum.load(); });
+        TaskSystem::WaitAndHelp(finish);
+
+        EXPECT_FALSE(chunkSawUnprepared);
+        EXPECT_EQ(observed, 255u * 256u / 2u);
+    }
+
+    TEST_F(TaskSystemTests, WaitAndHelpInsideWorkerDoesNotDeadlock)
+    {
+        // One worker: the outer job can only finish if the waiting worker executes the inner jobs itself.
+        TaskSystem::Shutdown();
+        TaskSystem::Init(1);
+
+        std::atomic<int> inner = 0;
+        TaskHandle outer = TaskSystem::Schedule([&inner]() {
+            TaskHandle loop = TaskSystem::ParallelFor(8, 1, [&inner](size_t, size_t) { ++inner; });
+            TaskSystem::WaitAndHelp(loop);
+        });
+        TaskSystem::WaitAndHelp(outer);
+
+        EXPECT_EQ(inner, 8);
+    }
+
+    TEST(JobTests, SmallCapturesAreStoredInline)
+    {
+        int calls = 0;
+        std::array<uint64_t, 6> payload = {};
+        Job small([&calls, payload]() { calls += static_cast<int>(payload.size()); });
+        EXPECT_TRUE(small.IsInline());
+
+        std::array<uint64_t, 16> largePayload = {};
+        Job large([&calls, largePayload]() { calls += static_cast<int>(largePayload.size()); });
+        EXPECT_FALSE(large.IsInline());
+
+        Job moved = std::move(small);
+        EXPECT_FALSE(small);
+        moved();
+        large();
+        EXPECT_EQ(calls, 6 + 16);
+
+        EXPECT_FALSE(Job(std::function<void()>()));
+        EXPECT_FALSE(Job(nullptr));
+    }
+
+    TEST(JobTests, OwnsMoveOnlyCaptures)
+    {
+        auto value = std::make_unique<int>(7);
+        int observed = 0;
+        Job job([&observed, value = std::move(value)]() { observed = *value; });
+        Job other;
+        other = std::move(job);
+        other();
+        EXPECT_EQ(observed, 7);
+    }
+
+    TEST_F(TaskSystemTests, SubmitIntoDeliversValuesAndExceptions)
+    {
+        TaskResult<int> value;
+        TaskSystem::SubmitInto(value, [](int a, int b) { return a * b; }, 6, 7);
+        EXPECT_EQ(value.Get(), 42);
+        EXPECT_TRUE(value.IsReady());
+
+        TaskResult<void> failure;
+        TaskSystem::SubmitInto(failure, []() { throw std::runtime_error("boom"); });
+        EXPECT_THROW(failure.Get(), std::runtime_error);
+
+        // A finished result can be reused for the next task.
+        TaskSystem::SubmitInto(value, []() { return 5; });
+        EXPECT_EQ(value.Get(), 5);
+
+        TaskSystem::Shutdown();
+        TaskResult<int> rejected;
+        EXPECT_THROW(TaskSystem::SubmitInto(rejected, []() { return 1; }), std::runtime_error);
+        EXPECT_TRUE(rejected.IsReady());
+    }
+
+    TEST_F(TaskSystemTests, SmallJobsSubmitWithoutHeapAllocations)
+    {
+        constexpr int jobCount = 512;
+        std::atomic<int> completed = 0;
+
+        auto submitBatch = [&completed]() {
+            completed = 0;
+            const uint64_t before = GetAllocationCount();
+            for (int i = 0; i < jobCount; ++i)
+                TaskSystem::Submit([&completed]() { completed.fetch_add(1, std::memory_order_relaxed); });
+            const uint64_t allocations = GetAllocationCount() - before;
+            while (completed < jobCount)
+                std::this_thread::yield();
+            return allocations;
+        };
+
+        submitBatch(); // Warm up job pools and queue storage.
+        const uint64_t submitAllocations = submitBatch();
+
+        std::array<TaskResult<int>, 64> results;
+        for (size_t i = 0; i < results.size(); ++i) // Warm-up
+            TaskSystem::SubmitInto(results[i], [i]() { return static_cast<int>(i); });
+        for (auto& result : results) result.Wait();
+
+        const uint64_t beforeResults = GetAllocationCount();
+        for (size_t i = 0; i < results.size(); ++i)
+            TaskSystem::SubmitInto(results[i], [i]() { return static_cast<int>(i) * 2; });
+        for (auto& result : results) result.Wait();
+        const uint64_t resultAllocations = GetAllocationCount() - beforeResults;
+
+        const uint64_t beforeFutures = GetAllocationCount();
+        std::vector<std::future<int>> futures;
+        futures.reserve(results.size());
+        for (size_t i = 0; i < results.size(); ++i)
+            futures.push_back(TaskSystem::SubmitFuture([i]() { return static_cast<int>(i); }));
+        for (auto& future : futures) future.get();
+        const uint64_t futureAllocations = GetAllocationCount() - beforeFutures;
+
+        RecordProperty("SubmitAllocationsPerJob", std::to_string(static_cast<double>(submitAllocations) / jobCount));
+        RecordProperty("SubmitIntoAllocationsPerJob", std::to_string(static_cast<double>(resultAllocations) / results.size()));
+        RecordProperty("SubmitFutureAllocationsPerJob", std::to_string(static_cast<double>(futureAllocations) / results.size()));
+
+        EXPECT_EQ(submitAllocations, 0u);
+        EXPECT_EQ(resultAllocations, 0u);
+        for (size_t i = 0; i < results.size(); ++i)
+            EXPECT_EQ(results[i].Get(), static_cast<int>(i) * 2);
+    }
+
 }
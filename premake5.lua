@@ -77,6 +77,7 @@ group ""
 
 group "Test"
     include "Tests/premake5.lua"
+    include "Benchmarks/premake5.lua"
 group ""
 
 include "Editor/premake5.lua"